@@ -0,0 +1,439 @@
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+/*
+ * ═══════════════════════════════════════════════════════════════════════
+ * BLACKROAD HOST SHIM - Arduino core on Linux
+ * ═══════════════════════════════════════════════════════════════════════
+ *
+ * Just enough of the ESP32 Arduino core to build src/main.cpp natively
+ * (pio run -e native). Everything is deterministic:
+ *   - millis()/micros() run on a virtual clock that only moves when the
+ *     firmware delays or the display charges modeled SPI time
+ *   - Serial reads from an injected line queue, writes to stdout
+ *   - GPIO is a pin table; the touch IRQ pin follows the emulated panel
+ *   - random() is a fixed-seed LCG
+ */
+
+#include <stdint.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <ctype.h>
+#include <math.h>
+#include <string>
+#include <algorithm>
+
+using std::min;
+using std::max;
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+#define HIGH 1
+#define LOW  0
+#define INPUT          0x01
+#define OUTPUT         0x03
+#define INPUT_PULLUP   0x05
+#define INPUT_PULLDOWN 0x09
+#define RISING  0x01
+#define FALLING 0x02
+#define CHANGE  0x03
+
+#define PI      3.1415926535897932384626433832795
+#define DEG_TO_RAD 0.017453292519943295769236907684886
+#define HEX 16
+#define DEC 10
+
+#define IRAM_ATTR
+#define DRAM_ATTR
+#define RTC_NOINIT_ATTR
+#define PROGMEM
+#define F(s) (s)
+#define pgm_read_byte(addr) (*(const uint8_t*)(addr))
+#define pgm_read_word(addr) (*(const uint16_t*)(addr))
+
+#define digitalPinToInterrupt(p) (p)
+
+// newlib has strlcpy, older glibc does not
+inline size_t hostStrlcpy(char* dst, const char* src, size_t size) {
+  size_t len = strlen(src);
+  if (size) {
+    size_t n = len < size - 1 ? len : size - 1;
+    memcpy(dst, src, n);
+    dst[n] = '\0';
+  }
+  return len;
+}
+#define strlcpy hostStrlcpy
+
+// ─────────────────────────────────────────────────────────────────────
+// VIRTUAL CLOCK
+// ─────────────────────────────────────────────────────────────────────
+
+extern uint64_t hostClockUs;
+
+inline void hostAdvanceUs(uint64_t us) { hostClockUs += us; }
+inline unsigned long millis() { return (unsigned long)(hostClockUs / 1000); }
+inline unsigned long micros() { return (unsigned long)hostClockUs; }
+inline void delay(unsigned long ms) { hostAdvanceUs((uint64_t)ms * 1000); }
+inline void delayMicroseconds(unsigned int us) { hostAdvanceUs(us); }
+inline void yield() {}
+
+// ─────────────────────────────────────────────────────────────────────
+// GPIO
+// ─────────────────────────────────────────────────────────────────────
+
+#define HOST_PIN_COUNT 40
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t val);
+int digitalRead(uint8_t pin);
+void attachInterrupt(uint8_t pin, void (*isr)(), int mode);
+void detachInterrupt(uint8_t pin);
+
+// Drive an input pin from the host side (fires attached ISRs on edges)
+void hostSetPin(uint8_t pin, int level);
+
+inline void tone(uint8_t, unsigned int, unsigned long = 0) {}
+inline void noTone(uint8_t) {}
+inline void analogWrite(uint8_t, int) {}
+inline double ledcSetup(uint8_t, double freq, uint8_t) { return freq; }
+inline void ledcAttachPin(uint8_t, uint8_t) {}
+inline void ledcWrite(uint8_t, uint32_t) {}
+inline double ledcWriteTone(uint8_t, double freq) { return freq; }
+inline uint16_t analogRead(uint8_t) { return 0; }
+
+// ─────────────────────────────────────────────────────────────────────
+// MATH HELPERS
+// ─────────────────────────────────────────────────────────────────────
+
+inline long map(long x, long in_min, long in_max, long out_min, long out_max) {
+  const long dividend = out_max - out_min;
+  const long divisor = in_max - in_min;
+  const long delta = x - in_min;
+  if (divisor == 0) return -1;
+  return (delta * dividend + (divisor / 2)) / divisor + out_min;
+}
+
+template <typename T, typename L, typename H>
+inline T constrain(T v, L lo, H hi) { return v < lo ? lo : (v > hi ? hi : v); }
+
+void randomSeed(unsigned long seed);
+long random(long howbig);
+long random(long howsmall, long howbig);
+
+inline uint32_t getCpuFrequencyMhz() { return 240; }
+inline bool setCpuFrequencyMhz(uint32_t) { return true; }
+
+// ─────────────────────────────────────────────────────────────────────
+// STRING
+// ─────────────────────────────────────────────────────────────────────
+
+// operator new calls since start (String, std::string, vectors...)
+extern uint64_t hostAllocCount;
+extern uint64_t hostAllocBytes;
+
+#define HOST_STRING_SSO 10   // arduino-esp32 2.x String inline capacity
+
+class String {
+public:
+  String() {}
+  String(const char* c) : s(c ? c : "") { sso(); }
+  String(const std::string& x) : s(x) { sso(); }
+  String(const String& o) : s(o.s) { sso(); }
+  explicit String(char c) : s(1, c) {}
+  String(int v, unsigned char base = DEC) { fromLong(v, base); }
+  String(unsigned int v, unsigned char base = DEC) { fromULong(v, base); }
+  String(long v, unsigned char base = DEC) { fromLong(v, base); }
+  String(unsigned long v, unsigned char base = DEC) { fromULong(v, base); }
+  String(long long v) : s(std::to_string(v)) { sso(); }
+  String(unsigned long long v) : s(std::to_string(v)) { sso(); }
+  String(float v, unsigned int decimals = 2) { fromDouble(v, decimals); }
+  String(double v, unsigned int decimals = 2) { fromDouble(v, decimals); }
+
+  String& operator=(const String& o) { s = o.s; sso(); return *this; }
+  String& operator=(const char* c) { s = c ? c : ""; sso(); return *this; }
+
+  const char* c_str() const { return s.c_str(); }
+  unsigned int length() const { return s.size(); }
+  bool isEmpty() const { return s.empty(); }
+  void reserve(unsigned int n) { s.reserve(n); sso(n); }
+
+  bool concat(const String& o) { s += o.s; sso(); return true; }
+  bool concat(const char* c) { if (c) s += c; sso(); return true; }
+  bool concat(char c) { s += c; sso(); return true; }
+  String& operator+=(const String& o) { s += o.s; sso(); return *this; }
+  String& operator+=(const char* c) { if (c) s += c; sso(); return *this; }
+  String& operator+=(char c) { s += c; sso(); return *this; }
+  String& operator+=(int v) { s += std::to_string(v); sso(); return *this; }
+  String& operator+=(unsigned int v) { s += std::to_string(v); sso(); return *this; }
+  String& operator+=(long v) { s += std::to_string(v); sso(); return *this; }
+  String& operator+=(unsigned long v) { s += std::to_string(v); sso(); return *this; }
+  String& operator+=(float v) { return *this += String(v); }
+  String& operator+=(double v) { return *this += String(v); }
+
+  bool operator==(const String& o) const { return s == o.s; }
+  bool operator==(const char* c) const { return s == (c ? c : ""); }
+  bool operator!=(const String& o) const { return s != o.s; }
+  bool operator!=(const char* c) const { return !(*this == c); }
+  bool operator<(const String& o) const { return s < o.s; }
+  bool equals(const String& o) const { return s == o.s; }
+  bool equalsIgnoreCase(const String& o) const {
+    if (s.size() != o.s.size()) return false;
+    for (size_t i = 0; i < s.size(); i++) {
+      if (tolower((unsigned char)s[i]) != tolower((unsigned char)o.s[i])) return false;
+    }
+    return true;
+  }
+
+  char operator[](unsigned int i) const { return i < s.size() ? s[i] : 0; }
+  char& operator[](unsigned int i) { return s[i]; }
+  char charAt(unsigned int i) const { return (*this)[i]; }
+  void setCharAt(unsigned int i, char c) { if (i < s.size()) s[i] = c; }
+
+  int indexOf(char c, unsigned int from = 0) const { return pos(s.find(c, from)); }
+  int indexOf(const char* c, unsigned int from = 0) const { return pos(s.find(c, from)); }
+  int indexOf(const String& o, unsigned int from = 0) const { return pos(s.find(o.s, from)); }
+  int lastIndexOf(char c) const { return pos(s.rfind(c)); }
+  int lastIndexOf(const String& o) const { return pos(s.rfind(o.s)); }
+
+  String substring(unsigned int from) const { return from >= s.size() ? String() : String(s.substr(from)); }
+  String substring(unsigned int from, unsigned int to) const {
+    if (from > to) std::swap(from, to);
+    if (from >= s.size()) return String();
+    return String(s.substr(from, to - from));
+  }
+
+  bool startsWith(const String& p) const { return s.compare(0, p.s.size(), p.s) == 0; }
+  bool endsWith(const String& p) const {
+    return s.size() >= p.s.size() && s.compare(s.size() - p.s.size(), p.s.size(), p.s) == 0;
+  }
+
+  void trim() {
+    size_t a = s.find_first_not_of(" \t\r\n");
+    size_t b = s.find_last_not_of(" \t\r\n");
+    s = (a == std::string::npos) ? std::string() : s.substr(a, b - a + 1);
+    sso();
+  }
+  void toUpperCase() { for (size_t i = 0; i < s.size(); i++) s[i] = toupper((unsigned char)s[i]); }
+  void toLowerCase() { for (size_t i = 0; i < s.size(); i++) s[i] = tolower((unsigned char)s[i]); }
+  void replace(const String& from, const String& to) {
+    if (from.s.empty()) return;
+    for (size_t p = s.find(from.s); p != std::string::npos; p = s.find(from.s, p + to.s.size())) {
+      s.replace(p, from.s.size(), to.s);
+    }
+  }
+  void replace(char from, char to) { std::replace(s.begin(), s.end(), from, to); }
+  void remove(unsigned int index) { if (index < s.size()) s.erase(index); }
+  void remove(unsigned int index, unsigned int count) { if (index < s.size()) s.erase(index, count); }
+
+  long toInt() const { return atol(s.c_str()); }
+  float toFloat() const { return atof(s.c_str()); }
+  double toDouble() const { return atof(s.c_str()); }
+
+  void toCharArray(char* buf, unsigned int size) const {
+    if (!size) return;
+    strncpy(buf, s.c_str(), size - 1);
+    buf[size - 1] = '\0';
+  }
+  void getBytes(unsigned char* buf, unsigned int size) const { toCharArray((char*)buf, size); }
+
+  // ArduinoJson string adapter hooks
+  size_t write(uint8_t c) { s += (char)c; sso(); return 1; }
+  size_t write(const uint8_t* b, size_t n) { s.append((const char*)b, n); sso(); return n; }
+
+private:
+  std::string s;
+
+  // The device String keeps HOST_STRING_SSO chars inline and mallocs
+  // past that; libstdc++ only spills after 15. Force the spill so
+  // --alloc-check and the heap tracer see what the board's heap would.
+  void sso(size_t want = 0) {
+    size_t n = std::max(s.size(), want);
+    if (n > HOST_STRING_SSO && s.capacity() <= 15) s.reserve(16);
+  }
+
+  static int pos(size_t p) { return p == std::string::npos ? -1 : (int)p; }
+  void fromLong(long v, unsigned char base) {
+    if (base == DEC) { s = std::to_string(v); sso(); return; }
+    fromULong((unsigned long)v, base);
+  }
+  void fromULong(unsigned long v, unsigned char base) {
+    char buf[33];
+    if (base == HEX) snprintf(buf, sizeof(buf), "%lx", v);
+    else snprintf(buf, sizeof(buf), "%lu", v);
+    s = buf;
+    sso();
+  }
+  void fromDouble(double v, unsigned int decimals) {
+    char buf[48];
+    snprintf(buf, sizeof(buf), "%.*f", (int)decimals, v);
+    s = buf;
+    sso();
+  }
+};
+
+inline String operator+(const String& a, const String& b) { String r(a); r += b; return r; }
+inline String operator+(const String& a, const char* b) { String r(a); r += b; return r; }
+inline String operator+(const char* a, const String& b) { String r(a); r += b; return r; }
+inline String operator+(const String& a, char b) { String r(a); r += b; return r; }
+inline String operator+(const String& a, int b) { String r(a); r += b; return r; }
+inline String operator+(const String& a, unsigned int b) { String r(a); r += b; return r; }
+inline String operator+(const String& a, long b) { String r(a); r += b; return r; }
+inline String operator+(const String& a, unsigned long b) { String r(a); r += b; return r; }
+inline String operator+(const String& a, float b) { String r(a); r += b; return r; }
+inline String operator+(const String& a, double b) { String r(a); r += b; return r; }
+
+// ─────────────────────────────────────────────────────────────────────
+// IP ADDRESS
+// ─────────────────────────────────────────────────────────────────────
+
+class IPAddress {
+public:
+  IPAddress() : addr(0) {}
+  IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) : addr(a | (b << 8) | (c << 16) | ((uint32_t)d << 24)) {}
+  String toString() const {
+    char buf[16];
+    snprintf(buf, sizeof(buf), "%u.%u.%u.%u", addr & 0xFF, (addr >> 8) & 0xFF, (addr >> 16) & 0xFF, addr >> 24);
+    return String(buf);
+  }
+  operator uint32_t() const { return addr; }
+private:
+  uint32_t addr;
+};
+
+// ─────────────────────────────────────────────────────────────────────
+// PRINT / STREAM / SERIAL
+// ─────────────────────────────────────────────────────────────────────
+
+class Print {
+public:
+  virtual ~Print() {}
+  virtual size_t write(uint8_t c) = 0;
+  virtual size_t write(const uint8_t* buf, size_t n) {
+    size_t out = 0;
+    while (n--) out += write(*buf++);
+    return out;
+  }
+  size_t write(const char* str) { return str ? write((const uint8_t*)str, strlen(str)) : 0; }
+
+  size_t print(const char* str) { return write(str); }
+  size_t print(const String& str) { return write(str.c_str()); }
+  size_t print(char c) { return write((uint8_t)c); }
+  size_t print(int v, int base = DEC) { return print(String((long)v, base)); }
+  size_t print(unsigned int v, int base = DEC) { return print(String((unsigned long)v, base)); }
+  size_t print(long v, int base = DEC) { return print(String(v, base)); }
+  size_t print(unsigned long v, int base = DEC) { return print(String(v, base)); }
+  size_t print(double v, int digits = 2) { return print(String(v, digits)); }
+  size_t print(const IPAddress& ip) { return print(ip.toString()); }
+
+  size_t println() { return write("\r\n"); }
+  template <typename T> size_t println(const T& v) { size_t n = print(v); return n + println(); }
+  size_t println(int v, int base) { size_t n = print(v, base); return n + println(); }
+  size_t println(double v, int digits) { size_t n = print(v, digits); return n + println(); }
+
+  size_t printf(const char* format, ...) __attribute__((format(printf, 2, 3))) {
+    char stackBuf[256];
+    va_list args;
+    va_start(args, format);
+    int len = vsnprintf(stackBuf, sizeof(stackBuf), format, args);
+    va_end(args);
+    if (len < 0) return 0;
+    if ((size_t)len < sizeof(stackBuf)) return write((const uint8_t*)stackBuf, len);
+
+    std::string big(len + 1, '\0');
+    va_start(args, format);
+    vsnprintf(&big[0], big.size(), format, args);
+    va_end(args);
+    return write((const uint8_t*)big.data(), len);
+  }
+};
+
+class Stream : public Print {
+public:
+  virtual int available() = 0;
+  virtual int read() = 0;
+  virtual int peek() = 0;
+  void setTimeout(unsigned long) {}
+
+  String readStringUntil(char terminator) {
+    String out;
+    int c;
+    while ((c = read()) >= 0 && c != terminator) out += (char)c;
+    return out;
+  }
+  String readString() { return readStringUntil('\0'); }
+  size_t readBytesUntil(char terminator, char* buf, size_t n) {
+    size_t i = 0;
+    int c;
+    while (i < n && (c = read()) >= 0 && c != terminator) buf[i++] = (char)c;
+    return i;
+  }
+  size_t readBytes(char* buf, size_t n) {
+    size_t i = 0;
+    int c;
+    while (i < n && (c = read()) >= 0) buf[i++] = (char)c;
+    return i;
+  }
+};
+
+class HardwareSerial : public Stream {
+public:
+  void begin(unsigned long) {}
+  void end() {}
+  size_t setRxBufferSize(size_t n) { return n; }
+  void flush() { fflush(stdout); }
+  operator bool() const { return true; }
+
+  int available() override;
+  int read() override;
+  int peek() override;
+  size_t write(uint8_t c) override;
+  size_t write(const uint8_t* buf, size_t n) override;
+  using Print::write;
+};
+
+extern HardwareSerial Serial;
+
+// Queue bytes as if they arrived on UART0 (runner scripts, replay tools)
+void hostSerialInject(const char* bytes);
+// Same, binary-safe (pager frames carry 0x00)
+void hostSerialInject(const uint8_t* bytes, size_t n);
+// Mute Serial output (benchmark loops)
+void hostSerialMute(bool muted);
+// Also hand every byte written to Serial to `sink` (nullptr = off)
+typedef void (*HostSerialSink)(const uint8_t* buf, size_t n);
+void hostSerialSink(HostSerialSink sink);
+
+// ─────────────────────────────────────────────────────────────────────
+// ESP
+// ─────────────────────────────────────────────────────────────────────
+
+#define HOST_HEAP_SIZE  (320 * 1024)
+
+class EspClass {
+public:
+  uint32_t getHeapSize() { return HOST_HEAP_SIZE; }
+  uint32_t getFreeHeap();
+  uint32_t getMinFreeHeap();
+  uint32_t getMaxAllocHeap();
+  uint32_t getPsramSize() { return 0; }
+  uint32_t getFreePsram() { return 0; }
+  uint32_t getCpuFreqMHz() { return getCpuFrequencyMhz(); }
+  uint32_t getCycleCount() { return (uint32_t)(hostClockUs * 240); }
+  uint32_t getSketchSize() { return 0; }
+  uint32_t getFreeSketchSpace() { return 0; }
+  const char* getSdkVersion() { return "host"; }
+  const char* getChipModel() { return "host"; }
+  void restart();
+};
+
+extern EspClass ESP;
+
+inline bool psramFound() { return false; }
+inline void* ps_malloc(size_t size) { return malloc(size); }
+
+#endif // HOST_ARDUINO_H
@@ -0,0 +1,43 @@
+#ifndef HOST_FS_H
+#define HOST_FS_H
+
+/*
+ * BlackRoad host shim - filesystem handles that never open.
+ */
+
+#include <Arduino.h>
+
+#define FILE_READ   "r"
+#define FILE_WRITE  "w"
+#define FILE_APPEND "a"
+
+class File : public Stream {
+public:
+  operator bool() const { return false; }
+  bool isDirectory() { return false; }
+  File openNextFile() { return File(); }
+  const char* name() { return ""; }
+  size_t size() { return 0; }
+  void close() {}
+  int available() override { return 0; }
+  int read() override { return -1; }
+  int peek() override { return -1; }
+  size_t write(uint8_t) override { return 0; }
+  using Print::write;
+};
+
+namespace fs {
+class FS {
+public:
+  File open(const char*, const char* = FILE_READ, bool = false) { return File(); }
+  File open(const String& p, const char* m = FILE_READ, bool c = false) { return open(p.c_str(), m, c); }
+  bool exists(const char*) { return false; }
+  bool exists(const String&) { return false; }
+  bool remove(const char*) { return false; }
+  bool remove(const String&) { return false; }
+  bool mkdir(const char*) { return false; }
+  bool mkdir(const String&) { return false; }
+};
+}
+
+#endif // HOST_FS_H
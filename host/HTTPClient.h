@@ -0,0 +1,31 @@
+#ifndef HOST_HTTPCLIENT_H
+#define HOST_HTTPCLIENT_H
+
+/*
+ * BlackRoad host shim - every request fails fast with a connection
+ * error, exercising the firmware's offline paths.
+ */
+
+#include <Arduino.h>
+#include <WiFiClient.h>
+
+#define HTTP_CODE_OK 200
+#define HTTPC_ERROR_CONNECTION_REFUSED (-1)
+
+class HTTPClient {
+public:
+  bool begin(const String&) { return true; }
+  bool begin(WiFiClient&, const String&) { return true; }
+  void end() {}
+  void setTimeout(uint16_t) {}
+  void setConnectTimeout(int32_t) {}
+  void addHeader(const String&, const String&) {}
+  int GET() { return HTTPC_ERROR_CONNECTION_REFUSED; }
+  int POST(const String&) { return HTTPC_ERROR_CONNECTION_REFUSED; }
+  int POST(const uint8_t*, size_t) { return HTTPC_ERROR_CONNECTION_REFUSED; }
+  String getString() { return String(); }
+  int getSize() { return 0; }
+  static String errorToString(int) { return String("connection refused (host build)"); }
+};
+
+#endif // HOST_HTTPCLIENT_H
@@ -0,0 +1,19 @@
+#ifndef HOST_SD_H
+#define HOST_SD_H
+
+#include <FS.h>
+#include <SPI.h>
+
+typedef enum { CARD_NONE, CARD_MMC, CARD_SD, CARD_SDHC, CARD_UNKNOWN } sdcard_type_t;
+
+class SDFS : public fs::FS {
+public:
+  bool begin(uint8_t = 5) { return false; }
+  bool begin(uint8_t, SPIClass&) { return false; }
+  sdcard_type_t cardType() { return CARD_NONE; }
+  uint64_t cardSize() { return 0; }
+};
+
+extern SDFS SD;
+
+#endif // HOST_SD_H
@@ -0,0 +1,62 @@
+#ifndef HOST_SPI_H
+#define HOST_SPI_H
+
+/*
+ * BlackRoad host shim - SPI bus with an emulated XPT2046 touch
+ * controller on it (the CYD board's touch chip sits alone on VSPI).
+ *
+ * The runner presses the panel in screen coordinates; reads return the
+ * raw 12-bit values the firmware's map() calls turn back into the same
+ * coordinates, plus optional deterministic noise.
+ */
+
+#include <Arduino.h>
+
+#define VSPI 3
+#define HSPI 2
+#define MSBFIRST 1
+#define SPI_MODE0 0
+
+// XPT2046 wiring on the ESP32-2432S028R (mirrors main.cpp)
+#define HOST_TOUCH_IRQ_PIN 36
+
+class SPISettings {
+public:
+  SPISettings() {}
+  SPISettings(uint32_t, uint8_t, uint8_t) {}
+};
+
+class SPIClass {
+public:
+  explicit SPIClass(uint8_t bus = HSPI) : lastCommand(0) { (void)bus; }
+  void begin(int8_t = -1, int8_t = -1, int8_t = -1, int8_t = -1) {}
+  void end() {}
+  void beginTransaction(SPISettings) {}
+  void endTransaction() {}
+  uint8_t transfer(uint8_t data);
+  uint16_t transfer16(uint16_t data);
+
+private:
+  uint8_t lastCommand;
+};
+
+extern SPIClass SPI;
+
+// ─────────────────────────────────────────────────────────────────────
+// EMULATED TOUCH PANEL
+// ─────────────────────────────────────────────────────────────────────
+
+struct HostTouchPanel {
+  bool down;
+  int x, y;           // screen coordinates (landscape, rotation 1)
+  int noise;          // ± raw counts added to each sample
+  uint32_t samples;   // ADC conversions served
+};
+
+extern HostTouchPanel hostTouch;
+
+void hostTouchPress(int x, int y);
+void hostTouchMove(int x, int y);
+void hostTouchRelease();
+
+#endif // HOST_SPI_H
@@ -0,0 +1,762 @@
+/*
+ * BlackRoad host shim - TFT_eSPI framebuffer backend
+ *
+ * Composite primitives follow the TFT_eSPI 2.5 algorithms and go through
+ * the same virtual leaves, so overrides (ProfiledTFT) see the same call
+ * pattern as on the panel.
+ */
+
+#include "TFT_eSPI.h"
+
+HostTftStats hostTftStats = { 0, 0, 0 };
+
+// Modeled bus cost, mirrors render_profiler.h
+#define HOST_SPI_WINDOW_BYTES 11
+
+// ─────────────────────────────────────────────────────────────────────
+// FONTS - 5x7 column glyphs (bit 0 = top row), 0x20..0x7E
+// ─────────────────────────────────────────────────────────────────────
+
+static const uint8_t hostGlyphs[95][5] = {
+  {0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x5F,0x00,0x00}, {0x00,0x07,0x00,0x07,0x00}, {0x14,0x7F,0x14,0x7F,0x14},
+  {0x24,0x2A,0x7F,0x2A,0x12}, {0x23,0x13,0x08,0x64,0x62}, {0x36,0x49,0x56,0x20,0x50}, {0x00,0x08,0x07,0x03,0x00},
+  {0x00,0x1C,0x22,0x41,0x00}, {0x00,0x41,0x22,0x1C,0x00}, {0x2A,0x1C,0x7F,0x1C,0x2A}, {0x08,0x08,0x3E,0x08,0x08},
+  {0x00,0x80,0x70,0x30,0x00}, {0x08,0x08,0x08,0x08,0x08}, {0x00,0x00,0x60,0x60,0x00}, {0x20,0x10,0x08,0x04,0x02},
+  {0x3E,0x51,0x49,0x45,0x3E}, {0x00,0x42,0x7F,0x40,0x00}, {0x72,0x49,0x49,0x49,0x46}, {0x21,0x41,0x49,0x4D,0x33},
+  {0x18,0x14,0x12,0x7F,0x10}, {0x27,0x45,0x45,0x45,0x39}, {0x3C,0x4A,0x49,0x49,0x31}, {0x41,0x21,0x11,0x09,0x07},
+  {0x36,0x49,0x49,0x49,0x36}, {0x46,0x49,0x49,0x29,0x1E}, {0x00,0x00,0x14,0x00,0x00}, {0x00,0x40,0x34,0x00,0x00},
+  {0x00,0x08,0x14,0x22,0x41}, {0x14,0x14,0x14,0x14,0x14}, {0x00,0x41,0x22,0x14,0x08}, {0x02,0x01,0x59,0x09,0x06},
+  {0x3E,0x41,0x5D,0x59,0x4E}, {0x7C,0x12,0x11,0x12,0x7C}, {0x7F,0x49,0x49,0x49,0x36}, {0x3E,0x41,0x41,0x41,0x22},
+  {0x7F,0x41,0x41,0x41,0x3E}, {0x7F,0x49,0x49,0x49,0x41}, {0x7F,0x09,0x09,0x09,0x01}, {0x3E,0x41,0x41,0x51,0x73},
+  {0x7F,0x08,0x08,0x08,0x7F}, {0x00,0x41,0x7F,0x41,0x00}, {0x20,0x40,0x41,0x3F,0x01}, {0x7F,0x08,0x14,0x22,0x41},
+  {0x7F,0x40,0x40,0x40,0x40}, {0x7F,0x02,0x1C,0x02,0x7F}, {0x7F,0x04,0x08,0x10,0x7F}, {0x3E,0x41,0x41,0x41,0x3E},
+  {0x7F,0x09,0x09,0x09,0x06}, {0x3E,0x41,0x51,0x21,0x5E}, {0x7F,0x09,0x19,0x29,0x46}, {0x26,0x49,0x49,0x49,0x32},
+  {0x03,0x01,0x7F,0x01,0x03}, {0x3F,0x40,0x40,0x40,0x3F}, {0x1F,0x20,0x40,0x20,0x1F}, {0x3F,0x40,0x38,0x40,0x3F},
+  {0x63,0x14,0x08,0x14,0x63}, {0x03,0x04,0x78,0x04,0x03}, {0x61,0x59,0x49,0x4D,0x43}, {0x00,0x7F,0x41,0x41,0x41},
+  {0x02,0x04,0x08,0x10,0x20}, {0x00,0x41,0x41,0x41,0x7F}, {0x04,0x02,0x01,0x02,0x04}, {0x40,0x40,0x40,0x40,0x40},
+  {0x00,0x03,0x07,0x08,0x00}, {0x20,0x54,0x54,0x78,0x40}, {0x7F,0x28,0x44,0x44,0x38}, {0x38,0x44,0x44,0x44,0x28},
+  {0x38,0x44,0x44,0x28,0x7F}, {0x38,0x54,0x54,0x54,0x18}, {0x00,0x08,0x7E,0x09,0x02}, {0x18,0xA4,0xA4,0x9C,0x78},
+  {0x7F,0x08,0x04,0x04,0x78}, {0x00,0x44,0x7D,0x40,0x00}, {0x20,0x40,0x40,0x3D,0x00}, {0x7F,0x10,0x28,0x44,0x00},
+  {0x00,0x41,0x7F,0x40,0x00}, {0x7C,0x04,0x78,0x04,0x78}, {0x7C,0x08,0x04,0x04,0x78}, {0x38,0x44,0x44,0x44,0x38},
+  {0xFC,0x18,0x24,0x24,0x18}, {0x18,0x24,0x24,0x18,0xFC}, {0x7C,0x08,0x04,0x04,0x08}, {0x48,0x54,0x54,0x54,0x24},
+  {0x04,0x04,0x3F,0x44,0x24}, {0x3C,0x40,0x40,0x20,0x7C}, {0x1C,0x20,0x40,0x20,0x1C}, {0x3C,0x40,0x30,0x40,0x3C},
+  {0x44,0x28,0x10,0x28,0x44}, {0x4C,0x90,0x90,0x90,0x7C}, {0x44,0x64,0x54,0x4C,0x44}, {0x00,0x08,0x36,0x41,0x00},
+  {0x00,0x00,0x77,0x00,0x00}, {0x00,0x41,0x36,0x08,0x00}, {0x02,0x01,0x02,0x04,0x02},
+};
+
+// Glyph scale and cell metrics standing in for the built-in fonts
+struct HostFontMetrics {
+  uint8_t sx, sy;       // glyph pixel scale
+  uint8_t advance;      // cell width
+  uint8_t height;       // cell height (fontHeight)
+  uint8_t baseline;     // rows above the baseline
+};
+
+static const HostFontMetrics& hostFont(uint8_t font) {
+  static const HostFontMetrics glcd  = { 1, 1,  6,  8,  7 };
+  static const HostFontMetrics font2 = { 1, 2,  8, 16, 13 };
+  static const HostFontMetrics font4 = { 2, 3, 14, 26, 20 };
+  static const HostFontMetrics font6 = { 3, 5, 20, 48, 40 };
+  static const HostFontMetrics font7 = { 4, 6, 32, 48, 48 };
+  static const HostFontMetrics font8 = { 8, 10, 55, 75, 75 };
+  switch (font) {
+    case 1: return glcd;
+    case 4: return font4;
+    case 6: return font6;
+    case 7: return font7;
+    case 8: return font8;
+    default: return font2;
+  }
+}
+
+static const uint8_t* hostGlyph(uint16_t c) {
+  return (c >= 0x20 && c <= 0x7E) ? hostGlyphs[c - 0x20] : nullptr;
+}
+
+// One code point from a UTF-8 string (built-in fonts only render ASCII)
+static uint16_t decodeUTF8(const char*& s) {
+  uint8_t c = (uint8_t)*s++;
+  if (c < 0x80) return c;
+  int extra = (c & 0xE0) == 0xC0 ? 1 : (c & 0xF0) == 0xE0 ? 2 : (c & 0xF8) == 0xF0 ? 3 : 0;
+  uint16_t cp = c & (0x3F >> extra);
+  while (extra-- && (*s & 0xC0) == 0x80) cp = (cp << 6) | (*s++ & 0x3F);
+  return cp;
+}
+
+// ─────────────────────────────────────────────────────────────────────
+// SETUP
+// ─────────────────────────────────────────────────────────────────────
+
+TFT_eSPI::TFT_eSPI(int16_t w, int16_t h)
+  : textcolor(TFT_WHITE), textbgcolor(TFT_BLACK), textfont(1), textsize(1), textdatum(TL_DATUM), rotation(0),
+    _init_width(w), _init_height(h), _width(w), _height(h), cursor_x(0), cursor_y(0),
+    _fb(nullptr), _isPanel(true), _swapBytes(false),
+    _winX(0), _winY(0), _winW(0), _winH(0), _winPos(0) {
+  allocFrame(w, h);
+  resetViewport();
+}
+
+TFT_eSPI::~TFT_eSPI() {
+  free(_fb);
+}
+
+void TFT_eSPI::allocFrame(int32_t w, int32_t h) {
+  free(_fb);
+  _fb = (w > 0 && h > 0) ? (uint16_t*)calloc((size_t)w * h, sizeof(uint16_t)) : nullptr;
+}
+
+void TFT_eSPI::init(uint8_t) {
+  if (!_fb) allocFrame(_init_width, _init_height);
+  setRotation(rotation);
+}
+
+void TFT_eSPI::setRotation(uint8_t r) {
+  rotation = r & 3;
+  bool landscape = rotation & 1;
+  _width = landscape ? _init_height : _init_width;
+  _height = landscape ? _init_width : _init_height;
+  resetViewport();
+}
+
+int16_t TFT_eSPI::width()  { return _vpDatum ? _vpW : _width; }
+int16_t TFT_eSPI::height() { return _vpDatum ? _vpH : _height; }
+
+// ─────────────────────────────────────────────────────────────────────
+// VIEWPORT
+// ─────────────────────────────────────────────────────────────────────
+
+void TFT_eSPI::setViewport(int32_t x, int32_t y, int32_t w, int32_t h, bool vpDatum) {
+  int32_t x1 = x + w, y1 = y + h;
+  if (x < 0) x = 0;
+  if (y < 0) y = 0;
+  if (x1 > _width) x1 = _width;
+  if (y1 > _height) y1 = _height;
+  _vpX = x;
+  _vpY = y;
+  _vpW = x1 > x ? x1 - x : 0;
+  _vpH = y1 > y ? y1 - y : 0;
+  _vpDatum = vpDatum;
+  _xDatum = vpDatum ? x : 0;
+  _yDatum = vpDatum ? y : 0;
+}
+
+void TFT_eSPI::resetViewport() {
+  _vpX = _vpY = 0;
+  _vpW = _width;
+  _vpH = _height;
+  _xDatum = _yDatum = 0;
+  _vpDatum = false;
+}
+
+bool TFT_eSPI::checkViewport(int32_t x, int32_t y, int32_t w, int32_t h) {
+  x += _xDatum;
+  y += _yDatum;
+  return x < _vpX + _vpW && y < _vpY + _vpH && x + w > _vpX && y + h > _vpY;
+}
+
+// ─────────────────────────────────────────────────────────────────────
+// RASTER HELPERS
+// ─────────────────────────────────────────────────────────────────────
+
+// Bus time for every panel transfer; sprites are plain memory
+void TFT_eSPI::chargeWindow(uint32_t pixels, uint32_t windows) {
+  if (!_isPanel || (!pixels && !windows)) return;
+  static uint64_t bitMicroRemainder = 0;   // sub-microsecond carry
+  uint64_t bytes = (uint64_t)windows * HOST_SPI_WINDOW_BYTES + (uint64_t)pixels * 2;
+  hostTftStats.windows += windows;
+  hostTftStats.pixels += pixels;
+  hostTftStats.spiBytes += bytes;
+  bitMicroRemainder += bytes * 8 * 1000000ULL;
+  hostAdvanceUs(bitMicroRemainder / SPI_FREQUENCY);
+  bitMicroRemainder %= SPI_FREQUENCY;
+}
+
+// Clip a datum-relative rectangle to the viewport; false if empty
+static bool clipTo(int32_t& x, int32_t& y, int32_t& w, int32_t& h,
+                   int32_t vx, int32_t vy, int32_t vw, int32_t vh) {
+  int32_t x1 = x + w, y1 = y + h;
+  if (x < vx) x = vx;
+  if (y < vy) y = vy;
+  if (x1 > vx + vw) x1 = vx + vw;
+  if (y1 > vy + vh) y1 = vy + vh;
+  w = x1 - x;
+  h = y1 - y;
+  return w > 0 && h > 0;
+}
+
+void TFT_eSPI::writeSpan(int32_t x, int32_t y, int32_t w, uint16_t color) {
+  int32_t h = 1;
+  x += _xDatum;
+  y += _yDatum;
+  if (!_fb || !clipTo(x, y, w, h, _vpX, _vpY, _vpW, _vpH)) return;
+  uint16_t* p = _fb + (size_t)y * _width + x;
+  while (w--) *p++ = color;
+}
+
+void TFT_eSPI::writePixel(int32_t x, int32_t y, uint16_t color) {
+  writeSpan(x, y, 1, color);
+}
+
+// ─────────────────────────────────────────────────────────────────────
+// LEAF PRIMITIVES
+// ─────────────────────────────────────────────────────────────────────
+
+void TFT_eSPI::fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) {
+  int32_t ax = x + _xDatum, ay = y + _yDatum;
+  if (!_fb || !clipTo(ax, ay, w, h, _vpX, _vpY, _vpW, _vpH)) return;
+  for (int32_t row = 0; row < h; row++) {
+    uint16_t* p = _fb + (size_t)(ay + row) * _width + ax;
+    for (int32_t i = 0; i < w; i++) p[i] = (uint16_t)color;
+  }
+  chargeWindow((uint32_t)w * h);
+}
+
+void TFT_eSPI::drawPixel(int32_t x, int32_t y, uint32_t color) {
+  int32_t ax = x + _xDatum, ay = y + _yDatum, w = 1, h = 1;
+  if (!_fb || !clipTo(ax, ay, w, h, _vpX, _vpY, _vpW, _vpH)) return;
+  _fb[(size_t)ay * _width + ax] = (uint16_t)color;
+  chargeWindow(1);
+}
+
+void TFT_eSPI::drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color) {
+  TFT_eSPI::fillRect(x, y, w, 1, color);
+}
+
+void TFT_eSPI::drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color) {
+  TFT_eSPI::fillRect(x, y, 1, h, color);
+}
+
+// Bresenham in runs, each run one pixel or fast line (as TFT_eSPI does)
+void TFT_eSPI::drawLine(int32_t xs, int32_t ys, int32_t xe, int32_t ye, uint32_t color) {
+  bool steep = abs(ye - ys) > abs(xe - xs);
+  if (steep) {
+    std::swap(xs, ys);
+    std::swap(xe, ye);
+  }
+  if (xs > xe) {
+    std::swap(xs, xe);
+    std::swap(ys, ye);
+  }
+
+  int32_t dx = xe - xs, dy = abs(ye - ys);
+  int32_t err = dx >> 1, ystep = ys < ye ? 1 : -1;
+  int32_t runStart = xs, dlen = 0;
+
+  for (; xs <= xe; xs++) {
+    dlen++;
+    err -= dy;
+    if (err < 0) {
+      if (steep) {
+        if (dlen == 1) drawPixel(ys, runStart, color);
+        else drawFastVLine(ys, runStart, dlen, color);
+      } else {
+        if (dlen == 1) drawPixel(runStart, ys, color);
+        else drawFastHLine(runStart, ys, dlen, color);
+      }
+      dlen = 0;
+      ys += ystep;
+      runStart = xs + 1;
+      err += dx;
+    }
+  }
+  if (dlen) {
+    if (steep) drawFastVLine(ys, runStart, dlen, color);
+    else drawFastHLine(runStart, ys, dlen, color);
+  }
+}
+
+// GLCD glyph: opaque size-1 cells stream in one window, everything
+// else is built from pixels/rects like the library
+void TFT_eSPI::drawChar(int32_t x, int32_t y, uint16_t c, uint32_t color, uint32_t bg, uint8_t size) {
+  const uint8_t* g = hostGlyph(c);
+  if (!g) return;
+  bool fillbg = color != bg;
+  if (!size) size = 1;
+
+  if (fillbg && size == 1) {
+    for (int row = 0; row < 8; row++) {
+      for (int col = 0; col < 6; col++) {
+        bool on = col < 5 && (g[col] >> row) & 1;
+        writePixel(x + col, y + row, on ? color : bg);
+      }
+    }
+    int32_t ax = x + _xDatum, ay = y + _yDatum, w = 6, h = 8;
+    if (clipTo(ax, ay, w, h, _vpX, _vpY, _vpW, _vpH)) chargeWindow((uint32_t)w * h);
+    return;
+  }
+
+  for (int col = 0; col < 6; col++) {
+    uint8_t line = col < 5 ? g[col] : 0;
+    for (int row = 0; row < 8; row++, line >>= 1) {
+      if (line & 1) {
+        if (size == 1) drawPixel(x + col, y + row, color);
+        else fillRect(x + col * size, y + row * size, size, size, color);
+      } else if (fillbg) {
+        fillRect(x + col * size, y + row * size, size, size, bg);
+      }
+    }
+  }
+}
+
+int16_t TFT_eSPI::drawChar(uint16_t uniCode, int32_t x, int32_t y) {
+  return drawChar(uniCode, x, y, textfont);
+}
+
+// Scaled glyph in a font cell: opaque cells are streamed, transparent
+// ones drawn as vertical runs
+int16_t TFT_eSPI::drawChar(uint16_t uniCode, int32_t x, int32_t y, uint8_t font) {
+  if (font == 1) {
+    if (!hostGlyph(uniCode)) return 0;
+    drawChar(x, y, uniCode, textcolor, textbgcolor, textsize);
+    return 6 * textsize;
+  }
+
+  const uint8_t* g = hostGlyph(uniCode);
+  if (!g) return 0;
+  const HostFontMetrics& m = hostFont(font);
+  int32_t ts = textsize;
+  int32_t sx = m.sx * ts, sy = m.sy * ts;
+  int32_t cw = m.advance * ts, ch = m.height * ts;
+  int32_t ox = x + (cw - 5 * sx) / 2;
+  int32_t oy = y + (ch - 8 * sy) / 2;
+
+  if (textcolor != textbgcolor) {
+    for (int32_t row = 0; row < ch; row++) writeSpan(x, y + row, cw, (uint16_t)textbgcolor);
+    for (int col = 0; col < 5; col++) {
+      for (int r = 0; r < 8; r++) {
+        if (!((g[col] >> r) & 1)) continue;
+        for (int32_t py = 0; py < sy; py++) writeSpan(ox + col * sx, oy + r * sy + py, sx, (uint16_t)textcolor);
+      }
+    }
+    int32_t ax = x + _xDatum, ay = y + _yDatum, w = cw, h = ch;
+    if (clipTo(ax, ay, w, h, _vpX, _vpY, _vpW, _vpH)) chargeWindow((uint32_t)w * h);
+    return cw;
+  }
+
+  for (int col = 0; col < 5; col++) {
+    int r = 0;
+    while (r < 8) {
+      if (!((g[col] >> r) & 1)) { r++; continue; }
+      int start = r;
+      while (r < 8 && (g[col] >> r) & 1) r++;
+      fillRect(ox + col * sx, oy + start * sy, sx, (r - start) * sy, textcolor);
+    }
+  }
+  return cw;
+}
+
+// ─────────────────────────────────────────────────────────────────────
+// COMPOSITE SHAPES
+// ─────────────────────────────────────────────────────────────────────
+
+void TFT_eSPI::fillScreen(uint32_t color) {
+  fillRect(0, 0, _width, _height, color);
+}
+
+void TFT_eSPI::drawRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) {
+  drawFastHLine(x, y, w, color);
+  drawFastHLine(x, y + h - 1, w, color);
+  drawFastVLine(x, y + 1, h - 2, color);
+  drawFastVLine(x + w - 1, y + 1, h - 2, color);
+}
+
+void TFT_eSPI::drawCircleHelper(int32_t x0, int32_t y0, int32_t r, uint8_t corners, uint32_t color) {
+  if (r <= 0) return;
+  int32_t f = 1 - r, ddF_x = 1, ddF_y = -2 * r, x = 0, y = r;
+  while (x < y) {
+    if (f >= 0) {
+      y--;
+      ddF_y += 2;
+      f += ddF_y;
+    }
+    x++;
+    ddF_x += 2;
+    f += ddF_x;
+    if (corners & 0x4) { drawPixel(x0 + x, y0 + y, color); drawPixel(x0 + y, y0 + x, color); }
+    if (corners & 0x2) { drawPixel(x0 + x, y0 - y, color); drawPixel(x0 + y, y0 - x, color); }
+    if (corners & 0x8) { drawPixel(x0 - y, y0 + x, color); drawPixel(x0 - x, y0 + y, color); }
+    if (corners & 0x1) { drawPixel(x0 - y, y0 - x, color); drawPixel(x0 - x, y0 - y, color); }
+  }
+}
+
+void TFT_eSPI::fillCircleHelper(int32_t x0, int32_t y0, int32_t r, uint8_t corners, int32_t delta, uint32_t color) {
+  int32_t f = 1 - r, ddF_x = 1, ddF_y = -r - r, y = 0;
+  delta++;
+  while (y < r) {
+    if (f >= 0) {
+      if (corners & 0x1) drawFastHLine(x0 - y, y0 + r, y + y + delta, color);
+      if (corners & 0x2) drawFastHLine(x0 - y, y0 - r, y + y + delta, color);
+      r--;
+      ddF_y += 2;
+      f += ddF_y;
+    }
+    y++;
+    ddF_x += 2;
+    f += ddF_x;
+    if (corners & 0x1) drawFastHLine(x0 - r, y0 + y, r + r + delta, color);
+    if (corners & 0x2) drawFastHLine(x0 - r, y0 - y, r + r + delta, color);
+  }
+}
+
+void TFT_eSPI::drawRoundRect(int32_t x, int32_t y, int32_t w, int32_t h, int32_t r, uint32_t color) {
+  int32_t maxR = (w < h ? w : h) / 2;
+  if (r > maxR) r = maxR;
+  drawFastHLine(x + r, y, w - r - r, color);
+  drawFastHLine(x + r, y + h - 1, w - r - r, color);
+  drawFastVLine(x, y + r, h - r - r, color);
+  drawFastVLine(x + w - 1, y + r, h - r - r, color);
+  drawCircleHelper(x + r, y + r, r, 1, color);
+  drawCircleHelper(x + w - r - 1, y + r, r, 2, color);
+  drawCircleHelper(x + w - r - 1, y + h - r - 1, r, 4, color);
+  drawCircleHelper(x + r, y + h - r - 1, r, 8, color);
+}
+
+void TFT_eSPI::fillRoundRect(int32_t x, int32_t y, int32_t w, int32_t h, int32_t r, uint32_t color) {
+  int32_t maxR = (w < h ? w : h) / 2;
+  if (r > maxR) r = maxR;
+  fillRect(x, y + r, w, h - r - r, color);
+  fillCircleHelper(x + r, y + h - r - 1, r, 1, w - r - r - 1, color);
+  fillCircleHelper(x + r, y + r, r, 2, w - r - r - 1, color);
+}
+
+void TFT_eSPI::drawCircle(int32_t x0, int32_t y0, int32_t r, uint32_t color) {
+  if (r <= 0) {
+    drawPixel(x0, y0, color);
+    return;
+  }
+  drawPixel(x0, y0 + r, color);
+  drawPixel(x0, y0 - r, color);
+  drawPixel(x0 + r, y0, color);
+  drawPixel(x0 - r, y0, color);
+  drawCircleHelper(x0, y0, r, 0xF, color);
+}
+
+void TFT_eSPI::fillCircle(int32_t x0, int32_t y0, int32_t r, uint32_t color) {
+  int32_t x = 0, dx = 1, dy = r + r, p = -(r >> 1);
+  drawFastHLine(x0 - r, y0, dy + 1, color);
+  while (x < r) {
+    if (p >= 0) {
+      drawFastHLine(x0 - x, y0 + r, 2 * x + 1, color);
+      drawFastHLine(x0 - x, y0 - r, 2 * x + 1, color);
+      dy -= 2;
+      p -= dy;
+      r--;
+    }
+    dx += 2;
+    p += dx;
+    x++;
+    drawFastHLine(x0 - r, y0 + x, 2 * r + 1, color);
+    drawFastHLine(x0 - r, y0 - x, 2 * r + 1, color);
+  }
+}
+
+void TFT_eSPI::drawTriangle(int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t x2, int32_t y2, uint32_t color) {
+  drawLine(x0, y0, x1, y1, color);
+  drawLine(x1, y1, x2, y2, color);
+  drawLine(x2, y2, x0, y0, color);
+}
+
+void TFT_eSPI::fillTriangle(int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t x2, int32_t y2, uint32_t color) {
+  // Sort by y (y0 <= y1 <= y2)
+  if (y0 > y1) { std::swap(y0, y1); std::swap(x0, x1); }
+  if (y1 > y2) { std::swap(y2, y1); std::swap(x2, x1); }
+  if (y0 > y1) { std::swap(y0, y1); std::swap(x0, x1); }
+
+  if (y0 == y2) {
+    int32_t a = x0, b = x0;
+    if (x1 < a) a = x1; else if (x1 > b) b = x1;
+    if (x2 < a) a = x2; else if (x2 > b) b = x2;
+    drawFastHLine(a, y0, b - a + 1, color);
+    return;
+  }
+
+  int32_t dx01 = x1 - x0, dy01 = y1 - y0, dx02 = x2 - x0, dy02 = y2 - y0;
+  int32_t dx12 = x2 - x1, dy12 = y2 - y1, sa = 0, sb = 0;
+  int32_t last = (y1 == y2) ? y1 : y1 - 1;
+  int32_t y = y0;
+
+  for (; y <= last; y++) {
+    int32_t a = x0 + sa / dy01, b = x0 + sb / dy02;
+    sa += dx01;
+    sb += dx02;
+    if (a > b) std::swap(a, b);
+    drawFastHLine(a, y, b - a + 1, color);
+  }
+
+  sa = dx12 * (y - y1);
+  sb = dx02 * (y - y0);
+  for (; y <= y2; y++) {
+    int32_t a = x1 + sa / dy12, b = x0 + sb / dy02;
+    sa += dx12;
+    sb += dx02;
+    if (a > b) std::swap(a, b);
+    drawFastHLine(a, y, b - a + 1, color);
+  }
+}
+
+// ─────────────────────────────────────────────────────────────────────
+// TEXT
+// ─────────────────────────────────────────────────────────────────────
+
+int16_t TFT_eSPI::fontHeight(int16_t font) {
+  return hostFont(font).height * textsize;
+}
+
+int16_t TFT_eSPI::textWidth(const char* str, uint8_t font) {
+  if (!str) return 0;
+  int16_t w = 0;
+  int16_t adv = hostFont(font).advance * textsize;
+  while (*str) {
+    if (hostGlyph(decodeUTF8(str))) w += adv;
+  }
+  return w;
+}
+
+int16_t TFT_eSPI::drawString(const char* str, int32_t x, int32_t y, uint8_t font) {
+  if (!str) return 0;
+  int32_t w = textWidth(str, font);
+  int32_t h = fontHeight(font);
+  int32_t base = hostFont(font).baseline * textsize;
+
+  switch (textdatum) {
+    case TC_DATUM: x -= w / 2; break;
+    case TR_DATUM: x -= w; break;
+    case ML_DATUM: y -= h / 2; break;
+    case MC_DATUM: x -= w / 2; y -= h / 2; break;
+    case MR_DATUM: x -= w; y -= h / 2; break;
+    case BL_DATUM: y -= h; break;
+    case BC_DATUM: x -= w / 2; y -= h; break;
+    case BR_DATUM: x -= w; y -= h; break;
+    case L_BASELINE: y -= base; break;
+    case C_BASELINE: x -= w / 2; y -= base; break;
+    case R_BASELINE: x -= w; y -= base; break;
+    default: break;
+  }
+
+  int32_t cx = x;
+  while (*str) {
+    uint16_t cp = decodeUTF8(str);
+    cx += drawChar(cp, cx, y, font);
+  }
+  return (int16_t)(cx - x);
+}
+
+int16_t TFT_eSPI::drawCentreString(const char* str, int32_t x, int32_t y, uint8_t font) {
+  uint8_t saved = textdatum;
+  textdatum = TC_DATUM;
+  int16_t w = drawString(str, x, y, font);
+  textdatum = saved;
+  return w;
+}
+
+int16_t TFT_eSPI::drawRightString(const char* str, int32_t x, int32_t y, uint8_t font) {
+  uint8_t saved = textdatum;
+  textdatum = TR_DATUM;
+  int16_t w = drawString(str, x, y, font);
+  textdatum = saved;
+  return w;
+}
+
+int16_t TFT_eSPI::drawNumber(long n, int32_t x, int32_t y, uint8_t font) {
+  char buf[16];
+  snprintf(buf, sizeof(buf), "%ld", n);
+  return drawString(buf, x, y, font);
+}
+
+int16_t TFT_eSPI::drawFloat(float f, uint8_t dp, int32_t x, int32_t y, uint8_t font) {
+  char buf[24];
+  if (dp > 7) dp = 7;
+  snprintf(buf, sizeof(buf), "%.*f", dp, (double)f);
+  return drawString(buf, x, y, font);
+}
+
+size_t TFT_eSPI::write(uint8_t c) {
+  if (c == '\r') return 1;
+  if (c == '\n') {
+    cursor_x = 0;
+    cursor_y += fontHeight(textfont);
+    return 1;
+  }
+  cursor_x += drawChar(c, cursor_x, cursor_y, textfont);
+  return 1;
+}
+
+// ─────────────────────────────────────────────────────────────────────
+// RAW PIXEL STREAMING
+// ─────────────────────────────────────────────────────────────────────
+
+void TFT_eSPI::setAddrWindow(int32_t x, int32_t y, int32_t w, int32_t h) {
+  _winX = x;
+  _winY = y;
+  _winW = w > 0 ? w : 0;
+  _winH = h > 0 ? h : 0;
+  _winPos = 0;
+  chargeWindow(0, 1);
+}
+
+static inline uint16_t swap16(uint16_t v) { return (uint16_t)((v << 8) | (v >> 8)); }
+
+// Write the next pixel of the address window (window coords are absolute)
+#define HOST_WINDOW_PUT(color)                                                   \
+  do {                                                                           \
+    if (_winW && _winPos < _winW * _winH) {                                      \
+      int32_t px = _winX + _winPos % _winW, py = _winY + _winPos / _winW;        \
+      if (_fb && px >= 0 && py >= 0 && px < _width && py < _height)              \
+        _fb[(size_t)py * _width + px] = (color);                                 \
+      _winPos++;                                                                 \
+    }                                                                            \
+  } while (0)
+
+void TFT_eSPI::pushColor(uint16_t color) {
+  HOST_WINDOW_PUT(color);
+  chargeWindow(1, 0);
+}
+
+void TFT_eSPI::pushColor(uint16_t color, uint32_t len) {
+  for (uint32_t i = 0; i < len; i++) HOST_WINDOW_PUT(color);
+  chargeWindow(len, 0);
+}
+
+// swap = true: data is native RGB565 and byte-swapped onto the bus
+void TFT_eSPI::pushColors(uint16_t* data, uint32_t len, bool swap) {
+  for (uint32_t i = 0; i < len; i++) HOST_WINDOW_PUT(swap ? data[i] : swap16(data[i]));
+  chargeWindow(len, 0);
+}
+
+void TFT_eSPI::pushPixels(const void* data, uint32_t len) {
+  const uint16_t* d = (const uint16_t*)data;
+  for (uint32_t i = 0; i < len; i++) HOST_WINDOW_PUT(_swapBytes ? d[i] : swap16(d[i]));
+  chargeWindow(len, 0);
+}
+
+// Clipped to the viewport, only the visible part goes on the bus
+void TFT_eSPI::pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t* data) {
+  int32_t ax = x + _xDatum, ay = y + _yDatum, cw = w, ch = h;
+  if (!_fb || !data || !clipTo(ax, ay, cw, ch, _vpX, _vpY, _vpW, _vpH)) return;
+  int32_t dx = ax - (x + _xDatum), dy = ay - (y + _yDatum);
+  for (int32_t row = 0; row < ch; row++) {
+    const uint16_t* src = data + (size_t)(dy + row) * w + dx;
+    uint16_t* dst = _fb + (size_t)(ay + row) * _width + ax;
+    for (int32_t i = 0; i < cw; i++) dst[i] = _swapBytes ? src[i] : swap16(src[i]);
+  }
+  chargeWindow((uint32_t)cw * ch);
+}
+
+void TFT_eSPI::pushImage(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t* data) {
+  pushImage(x, y, w, h, (const uint16_t*)data);
+}
+
+uint16_t TFT_eSPI::readPixel(int32_t x, int32_t y) {
+  x += _xDatum;
+  y += _yDatum;
+  if (!_fb || x < 0 || y < 0 || x >= _width || y >= _height) return 0;
+  return _fb[(size_t)y * _width + x];
+}
+
+// ─────────────────────────────────────────────────────────────────────
+// FRAME FILES (binary PPM, 8 bits per channel)
+// ─────────────────────────────────────────────────────────────────────
+
+static void rgb565To888(uint16_t c, uint8_t* out) {
+  uint8_t r = (c >> 11) & 0x1F, g = (c >> 5) & 0x3F, b = c & 0x1F;
+  out[0] = (r << 3) | (r >> 2);
+  out[1] = (g << 2) | (g >> 4);
+  out[2] = (b << 3) | (b >> 2);
+}
+
+bool TFT_eSPI::saveFrame(const char* path) {
+  if (!_fb) return false;
+  FILE* f = fopen(path, "wb");
+  if (!f) return false;
+  fprintf(f, "P6\n%d %d\n255\n", (int)_width, (int)_height);
+  uint8_t px[3];
+  for (int32_t i = 0; i < _width * _height; i++) {
+    rgb565To888(_fb[i], px);
+    fwrite(px, 1, 3, f);
+  }
+  fclose(f);
+  return true;
+}
+
+long TFT_eSPI::diffFrame(const char* path) {
+  if (!_fb) return -1;
+  FILE* f = fopen(path, "rb");
+  if (!f) return -1;
+  int w = 0, h = 0, maxval = 0;
+  if (fscanf(f, "P6 %d %d %d", &w, &h, &maxval) != 3 || w != _width || h != _height || maxval != 255) {
+    fclose(f);
+    return -1;
+  }
+  fgetc(f);   // single whitespace after the header
+
+  long diff = 0;
+  uint8_t want[3], have[3];
+  for (int32_t i = 0; i < _width * _height; i++) {
+    if (fread(want, 1, 3, f) != 3) {
+      fclose(f);
+      return -1;
+    }
+    rgb565To888(_fb[i], have);
+    if (memcmp(want, have, 3) != 0) diff++;
+  }
+  fclose(f);
+  return diff;
+}
+
+// ─────────────────────────────────────────────────────────────────────
+// SPRITES
+// ─────────────────────────────────────────────────────────────────────
+
+TFT_eSprite::TFT_eSprite(TFT_eSPI* parent)
+  : TFT_eSPI(0, 0), _parent(parent), _created(false), _depth(16) {
+  _isPanel = false;
+}
+
+TFT_eSprite::~TFT_eSprite() {
+  deleteSprite();
+}
+
+void* TFT_eSprite::createSprite(int16_t w, int16_t h, uint8_t) {
+  if (_created) return _fb;
+  allocFrame(w, h);
+  if (!_fb) return nullptr;
+  _init_width = _width = w;
+  _init_height = _height = h;
+  resetViewport();
+  _created = true;
+  return _fb;
+}
+
+void TFT_eSprite::deleteSprite() {
+  allocFrame(0, 0);
+  _width = _height = 0;
+  resetViewport();
+  _created = false;
+}
+
+// Sprite buffers hold native RGB565
+void TFT_eSprite::pushSprite(int32_t x, int32_t y) {
+  if (!_created) return;
+  bool swap = _parent->getSwapBytes();
+  _parent->setSwapBytes(true);
+  _parent->pushImage(x, y, _width, _height, (const uint16_t*)_fb);
+  _parent->setSwapBytes(swap);
+}
+
+// Transparent pixels are skipped: one image push per opaque run
+void TFT_eSprite::pushSprite(int32_t x, int32_t y, uint16_t transparent) {
+  if (!_created) return;
+  bool swap = _parent->getSwapBytes();
+  _parent->setSwapBytes(true);
+  for (int32_t row = 0; row < _height; row++) {
+    const uint16_t* line = _fb + (size_t)row * _width;
+    int32_t col = 0;
+    while (col < _width) {
+      if (line[col] == transparent) { col++; continue; }
+      int32_t start = col;
+      while (col < _width && line[col] != transparent) col++;
+      _parent->pushImage(x + start, y + row, col - start, 1, line + start);
+    }
+  }
+  _parent->setSwapBytes(swap);
+}
@@ -0,0 +1,235 @@
+#ifndef HOST_TFT_ESPI_H
+#define HOST_TFT_ESPI_H
+
+/*
+ * ═══════════════════════════════════════════════════════════════════════
+ * BLACKROAD HOST SHIM - TFT_eSPI framebuffer backend
+ * ═══════════════════════════════════════════════════════════════════════
+ *
+ * API-compatible subset of TFT_eSPI 2.5.x that rasterises into an RGB565
+ * framebuffer instead of an ILI9341:
+ *
+ * - Same virtual leaf primitives as the real library, and the composite
+ *   calls (round rects, circles, strings) are built from them the same
+ *   way, so ProfiledTFT counts identically on host and device
+ * - Every panel write is charged to the virtual clock at the modeled SPI
+ *   cost (11 window bytes + 2 bytes/pixel at SPI_FREQUENCY)
+ * - Text uses a 5x7 glyph set scaled to the metrics of built-in fonts
+ *   1/2/4/6/7/8 - close enough for layout and golden-image diffs, not a
+ *   pixel-exact copy of the GLCD/RLE fonts
+ * - saveFrame()/diffFrame() write and compare binary PPM images
+ */
+
+#include <Arduino.h>
+#include <SPI.h>
+
+#ifndef TFT_WIDTH
+#define TFT_WIDTH  240
+#endif
+#ifndef TFT_HEIGHT
+#define TFT_HEIGHT 320
+#endif
+#ifndef SPI_FREQUENCY
+#define SPI_FREQUENCY 40000000
+#endif
+
+#define TL_DATUM 0
+#define TC_DATUM 1
+#define TR_DATUM 2
+#define ML_DATUM 3
+#define CL_DATUM 3
+#define MC_DATUM 4
+#define CC_DATUM 4
+#define MR_DATUM 5
+#define CR_DATUM 5
+#define BL_DATUM 6
+#define BC_DATUM 7
+#define BR_DATUM 8
+#define L_BASELINE  9
+#define C_BASELINE 10
+#define R_BASELINE 11
+
+#define TFT_BLACK       0x0000
+#define TFT_NAVY        0x000F
+#define TFT_DARKGREEN   0x03E0
+#define TFT_MAROON      0x7800
+#define TFT_PURPLE      0x780F
+#define TFT_OLIVE       0x7BE0
+#define TFT_LIGHTGREY   0xD69A
+#define TFT_DARKGREY    0x7BEF
+#define TFT_BLUE        0x001F
+#define TFT_GREEN       0x07E0
+#define TFT_CYAN        0x07FF
+#define TFT_RED         0xF800
+#define TFT_MAGENTA     0xF81F
+#define TFT_YELLOW      0xFFE0
+#define TFT_WHITE       0xFFFF
+#define TFT_ORANGE      0xFDA0
+#define TFT_PINK        0xFE19
+#define TFT_TRANSPARENT 0x0120
+
+// Panel write accounting (independent of the render profiler)
+struct HostTftStats {
+  uint32_t windows;     // address windows opened
+  uint32_t pixels;      // pixels written to the panel
+  uint64_t spiBytes;    // modeled bytes on the bus
+};
+
+extern HostTftStats hostTftStats;
+
+class TFT_eSPI : public Print {
+public:
+  TFT_eSPI(int16_t w = TFT_WIDTH, int16_t h = TFT_HEIGHT);
+  virtual ~TFT_eSPI();
+
+  void init(uint8_t tc = 0);
+  void begin(uint8_t tc = 0) { init(tc); }
+  void setRotation(uint8_t r);
+  uint8_t getRotation() { return rotation; }
+  void invertDisplay(bool) {}
+
+  // ── Virtual leaf primitives (same set as the real library) ──
+  virtual void drawPixel(int32_t x, int32_t y, uint32_t color);
+  virtual void drawChar(int32_t x, int32_t y, uint16_t c, uint32_t color, uint32_t bg, uint8_t size);
+  virtual void drawLine(int32_t xs, int32_t ys, int32_t xe, int32_t ye, uint32_t color);
+  virtual void drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color);
+  virtual void drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color);
+  virtual void fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color);
+  virtual int16_t drawChar(uint16_t uniCode, int32_t x, int32_t y, uint8_t font);
+  virtual int16_t drawChar(uint16_t uniCode, int32_t x, int32_t y);
+  virtual int16_t width();
+  virtual int16_t height();
+
+  // ── Composite shapes ──
+  void fillScreen(uint32_t color);
+  void drawRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color);
+  void drawRoundRect(int32_t x, int32_t y, int32_t w, int32_t h, int32_t r, uint32_t color);
+  void fillRoundRect(int32_t x, int32_t y, int32_t w, int32_t h, int32_t r, uint32_t color);
+  void drawCircle(int32_t x0, int32_t y0, int32_t r, uint32_t color);
+  void fillCircle(int32_t x0, int32_t y0, int32_t r, uint32_t color);
+  void drawTriangle(int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t x2, int32_t y2, uint32_t color);
+  void fillTriangle(int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t x2, int32_t y2, uint32_t color);
+
+  // ── Text ──
+  void setTextColor(uint16_t color) { textcolor = textbgcolor = color; }
+  void setTextColor(uint16_t fg, uint16_t bg, bool bgfill = false) { textcolor = fg; textbgcolor = bg; (void)bgfill; }
+  void setTextDatum(uint8_t d) { textdatum = d; }
+  uint8_t getTextDatum() { return textdatum; }
+  void setTextSize(uint8_t s) { textsize = s ? s : 1; }
+  void setTextFont(uint8_t f) { textfont = f; }
+  void setTextWrap(bool, bool = false) {}
+  void setTextPadding(uint16_t) {}
+  void setCursor(int16_t x, int16_t y) { cursor_x = x; cursor_y = y; }
+  void setCursor(int16_t x, int16_t y, uint8_t font) { cursor_x = x; cursor_y = y; textfont = font; }
+  int16_t getCursorX() { return cursor_x; }
+  int16_t getCursorY() { return cursor_y; }
+  void setFreeFont(const void*) {}
+
+  int16_t textWidth(const char* str, uint8_t font);
+  int16_t textWidth(const char* str) { return textWidth(str, textfont); }
+  int16_t textWidth(const String& str, uint8_t font) { return textWidth(str.c_str(), font); }
+  int16_t textWidth(const String& str) { return textWidth(str.c_str(), textfont); }
+  int16_t fontHeight(int16_t font);
+  int16_t fontHeight() { return fontHeight(textfont); }
+
+  int16_t drawString(const char* str, int32_t x, int32_t y, uint8_t font);
+  int16_t drawString(const char* str, int32_t x, int32_t y) { return drawString(str, x, y, textfont); }
+  int16_t drawString(const String& str, int32_t x, int32_t y, uint8_t font) { return drawString(str.c_str(), x, y, font); }
+  int16_t drawString(const String& str, int32_t x, int32_t y) { return drawString(str.c_str(), x, y, textfont); }
+  int16_t drawCentreString(const char* str, int32_t x, int32_t y, uint8_t font);
+  int16_t drawCentreString(const String& str, int32_t x, int32_t y, uint8_t font) { return drawCentreString(str.c_str(), x, y, font); }
+  int16_t drawRightString(const char* str, int32_t x, int32_t y, uint8_t font);
+  int16_t drawRightString(const String& str, int32_t x, int32_t y, uint8_t font) { return drawRightString(str.c_str(), x, y, font); }
+  int16_t drawNumber(long n, int32_t x, int32_t y, uint8_t font);
+  int16_t drawNumber(long n, int32_t x, int32_t y) { return drawNumber(n, x, y, textfont); }
+  int16_t drawFloat(float f, uint8_t dp, int32_t x, int32_t y, uint8_t font);
+  int16_t drawFloat(float f, uint8_t dp, int32_t x, int32_t y) { return drawFloat(f, dp, x, y, textfont); }
+
+  size_t write(uint8_t c) override;   // print() at the cursor
+  using Print::write;
+
+  // ── Viewport / clipping ──
+  void setViewport(int32_t x, int32_t y, int32_t w, int32_t h, bool vpDatum = true);
+  void resetViewport();
+  bool checkViewport(int32_t x, int32_t y, int32_t w, int32_t h);
+
+  // ── Raw pixel streaming ──
+  void startWrite() {}
+  void endWrite() {}
+  void setAddrWindow(int32_t x, int32_t y, int32_t w, int32_t h);
+  void setWindow(int32_t x0, int32_t y0, int32_t x1, int32_t y1) { setAddrWindow(x0, y0, x1 - x0 + 1, y1 - y0 + 1); }
+  void pushColor(uint16_t color);
+  void pushColor(uint16_t color, uint32_t len);
+  void pushColors(uint16_t* data, uint32_t len, bool swap = true);
+  void pushBlock(uint16_t color, uint32_t len) { pushColor(color, len); }
+  void pushPixels(const void* data, uint32_t len);
+  void pushImage(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t* data);
+  void pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t* data);
+  void setSwapBytes(bool swap) { _swapBytes = swap; }
+  bool getSwapBytes() { return _swapBytes; }
+  uint16_t readPixel(int32_t x, int32_t y);
+
+  uint16_t color565(uint8_t r, uint8_t g, uint8_t b) {
+    return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3);
+  }
+
+  // ── Host only ──
+  const uint16_t* frameBuffer() const { return _fb; }
+  bool saveFrame(const char* path);       // binary PPM (P6)
+  long diffFrame(const char* path);       // differing pixels, -1 = no/invalid golden
+
+  // Public like the real library (ProfiledTFT reads these)
+  uint32_t textcolor, textbgcolor;
+  uint8_t textfont, textsize, textdatum, rotation;
+
+protected:
+  int32_t _init_width, _init_height;
+  int32_t _width, _height;
+  int32_t cursor_x, cursor_y;
+
+  uint16_t* _fb;
+  bool _isPanel;         // false for sprites: no SPI cost
+  bool _swapBytes;
+
+  int32_t _vpX, _vpY, _vpW, _vpH;   // clip window (absolute)
+  int32_t _xDatum, _yDatum;         // coordinate offset when vpDatum
+  bool _vpDatum;
+
+  int32_t _winX, _winY, _winW, _winH, _winPos;
+
+  void allocFrame(int32_t w, int32_t h);
+  void chargeWindow(uint32_t pixels, uint32_t windows = 1);
+  void writeSpan(int32_t x, int32_t y, int32_t w, uint16_t color);   // clipped, no accounting
+  void writePixel(int32_t x, int32_t y, uint16_t color);
+  void fillCircleHelper(int32_t x0, int32_t y0, int32_t r, uint8_t corners, int32_t delta, uint32_t color);
+  void drawCircleHelper(int32_t x0, int32_t y0, int32_t r, uint8_t corners, uint32_t color);
+};
+
+// ─────────────────────────────────────────────────────────────────────
+// SPRITES - offscreen RGB565 buffers pushed to a parent display
+// ─────────────────────────────────────────────────────────────────────
+
+class TFT_eSprite : public TFT_eSPI {
+public:
+  explicit TFT_eSprite(TFT_eSPI* parent);
+  ~TFT_eSprite();
+
+  void* createSprite(int16_t w, int16_t h, uint8_t frames = 1);
+  void deleteSprite();
+  bool created() const { return _created; }
+  void* getPointer() { return _fb; }
+  void setColorDepth(int8_t depth) { _depth = depth; }
+  int8_t getColorDepth() { return _depth; }
+  void setAttribute(uint8_t, uint8_t) {}
+  void setPsram(bool) {}
+  void fillSprite(uint32_t color) { fillRect(0, 0, _width, _height, color); }
+  void pushSprite(int32_t x, int32_t y);
+  void pushSprite(int32_t x, int32_t y, uint16_t transparent);
+
+private:
+  TFT_eSPI* _parent;
+  bool _created;
+  int8_t _depth;
+};
+
+#endif // HOST_TFT_ESPI_H
@@ -0,0 +1,38 @@
+#ifndef HOST_WIFI_H
+#define HOST_WIFI_H
+
+/*
+ * BlackRoad host shim - WiFi is always offline so screens render the
+ * same static data on every run.
+ */
+
+#include <Arduino.h>
+
+typedef enum {
+  WL_IDLE_STATUS = 0,
+  WL_NO_SSID_AVAIL = 1,
+  WL_CONNECTED = 3,
+  WL_CONNECT_FAILED = 4,
+  WL_CONNECTION_LOST = 5,
+  WL_DISCONNECTED = 6
+} wl_status_t;
+
+typedef enum { WIFI_OFF = 0, WIFI_STA = 1, WIFI_AP = 2, WIFI_AP_STA = 3 } wifi_mode_t;
+
+class WiFiClass {
+public:
+  wl_status_t begin(const char*, const char* = nullptr) { return WL_DISCONNECTED; }
+  bool disconnect(bool = false) { return true; }
+  bool mode(wifi_mode_t) { return true; }
+  bool setHostname(const char*) { return true; }
+  bool setSleep(bool) { return true; }
+  wl_status_t status() { return WL_DISCONNECTED; }
+  IPAddress localIP() { return IPAddress(); }
+  String SSID() { return String(); }
+  String macAddress() { return String("00:00:00:00:00:00"); }
+  int8_t RSSI() { return 0; }
+};
+
+extern WiFiClass WiFi;
+
+#endif // HOST_WIFI_H
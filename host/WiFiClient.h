@@ -0,0 +1,13 @@
+#ifndef HOST_WIFICLIENT_H
+#define HOST_WIFICLIENT_H
+
+#include <Arduino.h>
+
+class WiFiClient {
+public:
+  int connect(const char*, uint16_t) { return 0; }
+  bool connected() { return false; }
+  void stop() {}
+};
+
+#endif // HOST_WIFICLIENT_H
@@ -0,0 +1,161 @@
+/*
+ * BlackRoad host shim - Arduino core state (clock, GPIO, Serial, ESP)
+ */
+
+#include "Arduino.h"
+#include <deque>
+#include <new>
+
+uint64_t hostClockUs = 0;
+
+HardwareSerial Serial;
+EspClass ESP;
+
+// ─────────────────────────────────────────────────────────────────────
+// GPIO
+// ─────────────────────────────────────────────────────────────────────
+
+static int hostPinLevel[HOST_PIN_COUNT];
+static void (*hostPinIsr[HOST_PIN_COUNT])();
+static int hostPinIsrMode[HOST_PIN_COUNT];
+
+void pinMode(uint8_t pin, uint8_t mode) {
+  if (pin < HOST_PIN_COUNT && (mode == INPUT_PULLUP)) hostPinLevel[pin] = HIGH;
+}
+
+void digitalWrite(uint8_t pin, uint8_t val) {
+  if (pin < HOST_PIN_COUNT) hostPinLevel[pin] = val ? HIGH : LOW;
+}
+
+int digitalRead(uint8_t pin) {
+  return pin < HOST_PIN_COUNT ? hostPinLevel[pin] : LOW;
+}
+
+void attachInterrupt(uint8_t pin, void (*isr)(), int mode) {
+  if (pin >= HOST_PIN_COUNT) return;
+  hostPinIsr[pin] = isr;
+  hostPinIsrMode[pin] = mode;
+}
+
+void detachInterrupt(uint8_t pin) {
+  if (pin < HOST_PIN_COUNT) hostPinIsr[pin] = nullptr;
+}
+
+void hostSetPin(uint8_t pin, int level) {
+  if (pin >= HOST_PIN_COUNT) return;
+  int prev = hostPinLevel[pin];
+  hostPinLevel[pin] = level ? HIGH : LOW;
+  if (!hostPinIsr[pin] || prev == hostPinLevel[pin]) return;
+
+  int mode = hostPinIsrMode[pin];
+  bool rising = hostPinLevel[pin] == HIGH;
+  if (mode == CHANGE || (mode == RISING && rising) || (mode == FALLING && !rising)) {
+    hostPinIsr[pin]();
+  }
+}
+
+// ─────────────────────────────────────────────────────────────────────
+// RANDOM (fixed seed - runs are reproducible)
+// ─────────────────────────────────────────────────────────────────────
+
+static uint32_t hostRandState = 0x2545F491;
+
+void randomSeed(unsigned long seed) {
+  if (seed) hostRandState = (uint32_t)seed;
+}
+
+long random(long howbig) {
+  if (howbig <= 0) return 0;
+  hostRandState = hostRandState * 1664525u + 1013904223u;
+  return (long)((hostRandState >> 8) % (uint32_t)howbig);
+}
+
+long random(long howsmall, long howbig) {
+  if (howsmall >= howbig) return howsmall;
+  return howsmall + random(howbig - howsmall);
+}
+
+// ─────────────────────────────────────────────────────────────────────
+// SERIAL
+// ─────────────────────────────────────────────────────────────────────
+
+static std::deque<uint8_t> hostSerialRx;
+static bool hostSerialMuted = false;
+static HostSerialSink hostSerialSinkFn = nullptr;
+
+void hostSerialInject(const char* bytes) {
+  while (*bytes) hostSerialRx.push_back((uint8_t)*bytes++);
+}
+
+void hostSerialInject(const uint8_t* bytes, size_t n) {
+  hostSerialRx.insert(hostSerialRx.end(), bytes, bytes + n);
+}
+
+void hostSerialMute(bool muted) {
+  hostSerialMuted = muted;
+}
+
+void hostSerialSink(HostSerialSink sink) {
+  hostSerialSinkFn = sink;
+}
+
+int HardwareSerial::available() {
+  return (int)hostSerialRx.size();
+}
+
+int HardwareSerial::read() {
+  if (hostSerialRx.empty()) return -1;
+  uint8_t c = hostSerialRx.front();
+  hostSerialRx.pop_front();
+  return c;
+}
+
+int HardwareSerial::peek() {
+  return hostSerialRx.empty() ? -1 : hostSerialRx.front();
+}
+
+size_t HardwareSerial::write(uint8_t c) {
+  if (hostSerialSinkFn) hostSerialSinkFn(&c, 1);
+  if (!hostSerialMuted) fputc(c, stdout);
+  return 1;
+}
+
+size_t HardwareSerial::write(const uint8_t* buf, size_t n) {
+  if (hostSerialSinkFn) hostSerialSinkFn(buf, n);
+  if (!hostSerialMuted) fwrite(buf, 1, n, stdout);
+  return n;
+}
+
+// ─────────────────────────────────────────────────────────────────────
+// HEAP (every C++ allocation is counted; --alloc-check reads the totals)
+// ─────────────────────────────────────────────────────────────────────
+
+uint64_t hostAllocCount = 0;
+uint64_t hostAllocBytes = 0;
+
+static void* hostAlloc(size_t n) {
+  hostAllocCount++;
+  hostAllocBytes += n;
+  void* p = malloc(n ? n : 1);
+  if (!p) throw std::bad_alloc();
+  return p;
+}
+
+void* operator new(size_t n) { return hostAlloc(n); }
+void* operator new[](size_t n) { return hostAlloc(n); }
+void operator delete(void* p) noexcept { free(p); }
+void operator delete[](void* p) noexcept { free(p); }
+
+// ─────────────────────────────────────────────────────────────────────
+// ESP
+// ─────────────────────────────────────────────────────────────────────
+
+// Fixed figures so heap-driven UI (perf screens) renders identically
+uint32_t EspClass::getFreeHeap()    { return 180 * 1024; }
+uint32_t EspClass::getMinFreeHeap() { return 160 * 1024; }
+uint32_t EspClass::getMaxAllocHeap() { return 110 * 1024; }
+
+void EspClass::restart() {
+  fflush(stdout);
+  exit(0);
+}
@@ -0,0 +1,1267 @@
+#ifndef HOST_RUNNER_H
+#define HOST_RUNNER_H
+
+/*
+ * ═══════════════════════════════════════════════════════════════════════
+ * BLACKROAD HOST RUNNER - headless screens, frames and timing
+ * ═══════════════════════════════════════════════════════════════════════
+ *
+ * Included at the end of main.cpp in the native build (HOST_BUILD), so
+ * it drives the firmware's own setup()/loop()/drawCurrentScreen().
+ *
+ *   program                       draw every screen, write out/NN_name.ppm,
+ *                                 diff against host/golden/, print timings
+ *   program --script FILE         run a touch/serial script (see below)
+ *   program --update-golden       rewrite the golden images
+ *   program --tap-trace FILE      tap a grid on every screen and compare
+ *                                 what fired with FILE (--update-golden
+ *                                 records it instead)
+ *   program --gesture-trace FILE  replay recorded touch strokes through the
+ *                                 gesture recognizer, compare decisions and
+ *                                 print decision latency (--update-golden
+ *                                 re-records the strokes)
+ *   program --serial-port PTY     run loop() in real time with UART0 on
+ *                                 PTY until the other end closes; prints
+ *                                 loop() pass times (tools/serial_bench.py)
+ *   program --alloc-check         count heap allocations per loop() pass
+ *                                 on every screen idle, per serial command
+ *                                 and per nav refresh; nonzero exit if any
+ *                                 steady-state path allocates
+ *   program --idle-check          idle with nothing, then half a line, then
+ *                                 the rest buffered on UART0; nonzero exit
+ *                                 if a partial line reads as pending input
+ *   program --json-soak [HOURS]   replay HOURS (24) of fetch traffic on a
+ *                                 modeled heap, per-fetch documents vs.
+ *                                 the JSON arena: peak, fragmentation,
+ *                                 failed documents
+ *   program --alert-storm         synthetic alert storms through the dedupe
+ *                                 table vs. an exact model; nonzero exit
+ *                                 if it suppresses a new alert
+ *
+ * Options: --out DIR, --golden DIR, --verbose (show firmware Serial)
+ *
+ * Script commands (one per line, # comments):
+ *   screen NAME              jump to a screen and draw it
+ *   tap X Y                  press, hold 60 ms, release
+ *   swipe X0 Y0 X1 Y1 MS     drag from one point to the other
+ *   wait MS                  run loop() for MS of virtual time
+ *   noise N                  add ±N raw counts to every touch sample
+ *   serial LINE              type LINE + newline on UART0
+ *   snap NAME                write out/NAME.ppm, diff host/golden/NAME.ppm
+ *
+ * Time is virtual: loop() delays and modeled SPI transfers advance it,
+ * so "modeled" columns are what the ILI9341 at SPI_FREQUENCY would take.
+ * Exit code is nonzero if any frame differs from its golden image or has
+ * none (record new screens and snaps with --update-golden).
+ */
+
+#include <chrono>
+#include <string>
+#include <vector>
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <termios.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#define HOST_LOOP_SLICE_MS 10   // loop() already ends with delay(10)
+#define HOST_TAP_HOLD_MS   60
+#define HOST_TRACE_STEP    10   // tap-trace grid pitch (px), first tap at STEP/2
+#define HOST_TRACE_LOG_MAX 80   // firmware output kept per tap
+#define HOST_GESTURE_TICK_MS 10 // gestureTick() pitch in replays (one loop() slice)
+#define HOST_GESTURE_TAIL_MS 800 // ticks after the last event (long press, double tap)
+#define HOST_STROKE_GAP_MS  120 // between repeated presses of one stroke
+#define HOST_ALLOC_WARMUP_MS 2000 // settle after a screen draw (animations, first timers)
+#define HOST_ALLOC_WINDOW_MS 5000 // idle window counted per screen
+
+struct HostRunConfig {
+  std::string outDir;
+  std::string goldenDir;
+  bool updateGolden;
+  bool verbose;
+};
+
+HostRunConfig hostConfig = { "out", "host/golden", false, false };
+int hostGoldenFailures = 0;
+int hostGoldenMissing = 0;
+
+// Per-screen timing (default run)
+struct HostScreenTiming {
+  uint64_t modeledUs;
+  uint64_t spiBytes;
+  uint32_t windows;
+  uint64_t hostNs;
+  long diff;            // golden pixels differing, -1 = no golden
+};
+
+uint64_t hostNowNs() {
+  return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+    std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// ─────────────────────────────────────────────────────────────────────
+// FRAMES
+// ─────────────────────────────────────────────────────────────────────
+
+// Save a frame and compare it with its golden image
+long hostSnap(const std::string& name) {
+  mkdir(hostConfig.outDir.c_str(), 0755);
+  std::string out = hostConfig.outDir + "/" + name + ".ppm";
+  std::string golden = hostConfig.goldenDir + "/" + name + ".ppm";
+  tft.saveFrame(out.c_str());
+
+  if (hostConfig.updateGolden) {
+    mkdir(hostConfig.goldenDir.c_str(), 0755);
+    tft.saveFrame(golden.c_str());
+    return 0;
+  }
+
+  long diff = tft.diffFrame(golden.c_str());
+  if (diff < 0) hostGoldenMissing++;
+  else if (diff > 0) hostGoldenFailures++;
+  return diff;
+}
+
+// Screen name -> file-safe slug ("Emergency Pager" -> "emergency_pager")
+std::string hostSlug(const char* name) {
+  std::string s;
+  for (; *name; name++) s += isalnum((unsigned char)*name) ? (char)tolower((unsigned char)*name) : '_';
+  return s;
+}
+
+int hostFindScreen(const std::string& name) {
+  for (int i = 0; i < SCREEN_COUNT; i++) {
+    if (hostSlug(SCREEN_NAMES[i]) == hostSlug(name.c_str())) return i;
+  }
+  return -1;
+}
+
+// ─────────────────────────────────────────────────────────────────────
+// SIMULATION
+// ─────────────────────────────────────────────────────────────────────
+
+// Run loop() until `ms` of virtual time has passed (at least once)
+void hostRunFor(unsigned long ms) {
+  uint64_t until = hostClockUs + (uint64_t)ms * 1000;
+  do {
+    loop();
+  } while (hostClockUs < until);
+}
+
+void hostTap(int x, int y) {
+  hostTouchPress(x, y);
+  hostRunFor(HOST_TAP_HOLD_MS);
+  hostTouchRelease();
+  hostRunFor(HOST_LOOP_SLICE_MS);
+}
+
+// Linear drag sampled once per loop() slice
+void hostSwipe(int x0, int y0, int x1, int y1, unsigned long ms) {
+  uint64_t start = hostClockUs, span = (uint64_t)(ms ? ms : 1) * 1000;
+  hostTouchPress(x0, y0);
+  while (hostClockUs - start < span) {
+    long t = (long)((hostClockUs - start) * 1000 / span);
+    hostTouchMove(x0 + (x1 - x0) * t / 1000, y0 + (y1 - y0) * t / 1000);
+    loop();
+  }
+  hostTouchMove(x1, y1);
+  loop();
+  hostTouchRelease();
+  hostRunFor(HOST_LOOP_SLICE_MS);
+}
+
+void hostDrawScreen(int screen) {
+  currentScreen = (Screen)screen;
+  drawCurrentScreen();
+}
+
+// ─────────────────────────────────────────────────────────────────────
+// RUN MODES
+// ─────────────────────────────────────────────────────────────────────
+
+void hostPrintTimings(const HostScreenTiming* t) {
+  Serial.println("\n╔══════════════════════════════════════════════════════════════════════════╗");
+  Serial.println("║                   HOST RENDER TIMINGS (one cold draw)                    ║");
+  Serial.println("╠══════════════════════╤═══════════╤═══════════╤═════════╤════════╤════════╣");
+  Serial.println("║ Screen               │  Model us │ SPI bytes │ Windows │ CPU us │ Golden ║");
+  Serial.println("╟──────────────────────┼───────────┼───────────┼─────────┼────────┼────────╢");
+  for (int i = 0; i < SCREEN_COUNT; i++) {
+    char golden[16];
+    if (t[i].diff < 0) snprintf(golden, sizeof(golden), "-");
+    else if (t[i].diff == 0) snprintf(golden, sizeof(golden), "ok");
+    else snprintf(golden, sizeof(golden), "%ld", t[i].diff > 999999 ? 999999L : t[i].diff);
+    Serial.printf("║ %-20s │ %9llu │ %9llu │ %7u │ %6llu │ %6s ║\n",
+                  SCREEN_NAMES[i], (unsigned long long)t[i].modeledUs, (unsigned long long)t[i].spiBytes,
+                  t[i].windows, (unsigned long long)(t[i].hostNs / 1000), golden);
+  }
+  Serial.println("╚══════════════════════╧═══════════╧═══════════╧═════════╧════════╧════════╝");
+}
+
+void hostRunAllScreens() {
+  static HostScreenTiming timings[SCREEN_COUNT];
+
+  for (int i = 0; i < SCREEN_COUNT; i++) {
+    HostTftStats before = hostTftStats;
+    uint64_t clock0 = hostClockUs;
+    uint64_t ns0 = hostNowNs();
+
+    hostDrawScreen(i);
+
+    timings[i].hostNs = hostNowNs() - ns0;
+    timings[i].modeledUs = hostClockUs - clock0;
+    timings[i].spiBytes = hostTftStats.spiBytes - before.spiBytes;
+    timings[i].windows = hostTftStats.windows - before.windows;
+
+    char name[64];
+    snprintf(name, sizeof(name), "%02d_%s", i, hostSlug(SCREEN_NAMES[i]).c_str());
+    timings[i].diff = hostSnap(name);
+  }
+
+  hostSerialMute(false);
+  hostPrintTimings(timings);
+  printRenderReport(SCREEN_NAMES, SCREEN_COUNT);
+}
+
+// ─────────────────────────────────────────────────────────────────────
+// TAP TRACES
+// ─────────────────────────────────────────────────────────────────────
+
+std::string hostCapture;
+
+void hostCaptureSerial(const uint8_t* buf, size_t n) {
+  hostCapture.append((const char*)buf, n);
+}
+
+// What one tap did: the screen it left behind plus the firmware's log
+// lines (without the "Tap at" echo), e.g. "home | Back button tapped"
+std::string hostTapResult(int screen, int x, int y) {
+  currentPage = 0;
+  hostDrawScreen(screen);
+  hostRunFor(100);   // past the 80 ms tap debounce
+  gestureReset();    // grid neighbours must not pair into double taps
+
+  hostCapture.clear();
+  hostSerialSink(hostCaptureSerial);
+  hostTap(x, y);
+  hostSerialSink(nullptr);
+
+  std::string log;
+  size_t pos = 0;
+  while (pos < hostCapture.size()) {
+    size_t end = hostCapture.find('\n', pos);
+    if (end == std::string::npos) end = hostCapture.size();
+    std::string line = hostCapture.substr(pos, end - pos);
+    pos = end + 1;
+    size_t a = line.find_first_not_of(" \t\r"), b = line.find_last_not_of(" \t\r");
+    if (a == std::string::npos || line.compare(a, 6, "Tap at") == 0) continue;
+    if (!log.empty()) log += " / ";
+    log += line.substr(a, b - a + 1);
+  }
+  if (log.size() > HOST_TRACE_LOG_MAX) log.resize(HOST_TRACE_LOG_MAX);
+  return hostSlug(SCREEN_NAMES[currentScreen]) + " | " + (log.empty() ? "-" : log);
+}
+
+// One line per run of equal results along a grid row:
+//   <screen> <y> <x0> <x1> <result>
+std::vector<std::string> hostRecordTapTrace() {
+  std::vector<std::string> lines;
+  char head[64];
+  for (int s = 0; s < SCREEN_COUNT; s++) {
+    std::string name = hostSlug(SCREEN_NAMES[s]);
+    for (int y = HOST_TRACE_STEP / 2; y < 240; y += HOST_TRACE_STEP) {
+      int runStart = HOST_TRACE_STEP / 2;
+      std::string run = hostTapResult(s, runStart, y);
+      for (int x = runStart + HOST_TRACE_STEP; x <= 320; x += HOST_TRACE_STEP) {
+        std::string r = x < 320 ? hostTapResult(s, x, y) : std::string();
+        if (r == run) continue;
+        snprintf(head, sizeof(head), "%s %d %d %d ", name.c_str(), y, runStart, x - HOST_TRACE_STEP);
+        lines.push_back(head + run);
+        runStart = x;
+        run = r;
+      }
+    }
+  }
+  return lines;
+}
+
+bool hostRunTapTrace(const char* path) {
+  uint64_t ns0 = hostNowNs();
+  std::vector<std::string> got = hostRecordTapTrace();
+  hostSerialMute(false);
+
+  if (hostConfig.updateGolden) {
+    FILE* f = fopen(path, "w");
+    if (!f) { fprintf(stderr, "cannot write %s\n", path); return false; }
+    fprintf(f, "# BlackRoad tap trace - %d px grid on every screen (see host/README.md)\n", HOST_TRACE_STEP);
+    fprintf(f, "# screen y x0 x1 | screen after the tap | firmware output\n");
+    for (size_t i = 0; i < got.size(); i++) fprintf(f, "%s\n", got[i].c_str());
+    fclose(f);
+    Serial.printf("Tap trace recorded: %u runs -> %s\n", (unsigned)got.size(), path);
+    return true;
+  }
+
+  FILE* f = fopen(path, "r");
+  if (!f) { fprintf(stderr, "cannot open tap trace %s\n", path); return false; }
+  std::vector<std::string> want;
+  char line[512];
+  while (fgets(line, sizeof(line), f)) {
+    line[strcspn(line, "\r\n")] = '\0';
+    if (line[0] && line[0] != '#') want.push_back(line);
+  }
+  fclose(f);
+
+  int mismatches = 0;
+  size_t n = got.size() > want.size() ? got.size() : want.size();
+  for (size_t i = 0; i < n; i++) {
+    const std::string& w = i < want.size() ? want[i] : std::string("(missing)");
+    const std::string& g = i < got.size() ? got[i] : std::string("(missing)");
+    if (w == g) continue;
+    if (++mismatches <= 10) Serial.printf("  want: %s\n  got:  %s\n", w.c_str(), g.c_str());
+  }
+  Serial.printf("Tap trace: %u runs, %d mismatched (%llu ms)\n",
+                (unsigned)want.size(), mismatches, (unsigned long long)((hostNowNs() - ns0) / 1000000));
+  return mismatches == 0;
+}
+
+// ─────────────────────────────────────────────────────────────────────
+// GESTURE TRACES
+// ─────────────────────────────────────────────────────────────────────
+
+// Strokes recorded through the emulated panel and the real sampler
+struct HostStroke {
+  const char* name;
+  int x0, y0, x1, y1;
+  unsigned holdMs;    // resting before the move
+  unsigned moveMs;    // linear move to (x1, y1), 0 = none
+  int presses;        // repeated HOST_STROKE_GAP_MS apart (double tap)
+};
+
+const HostStroke HOST_STROKES[] = {
+  { "tap",             160, 120, 160, 120,  60,    0, 1 },
+  { "wobbly_tap",      160, 120, 180, 126,   0,  150, 1 },
+  { "double_tap",      160, 120, 163, 121,  50,    0, 2 },
+  { "long_press",      160, 120, 160, 120, 700,    0, 1 },
+  { "drag_slow",        60, 120, 260, 120,   0, 1000, 1 },
+  { "fling_left",      260, 120,  60, 120,   0,  120, 1 },
+  { "fling_up",        160, 200, 160,  40,   0,  150, 1 },
+  { "rest_then_drag",  160, 120, 260, 120, 200,  300, 1 },
+  { "edge_back",         4, 120, 200, 124,   0,  300, 1 },
+  { "edge_vertical",     4,  40,   8, 200,   0,  300, 1 },
+};
+
+struct HostStrokeTrace {
+  std::string name;
+  std::vector<TouchEvent> events;
+  std::vector<std::string> gestures;
+};
+
+// Run the sampler for `ms` as loop() would, keeping every event it queues
+void hostSampleFor(unsigned long ms, std::vector<TouchEvent>& out) {
+  uint64_t until = hostClockUs + (uint64_t)ms * 1000;
+  TouchEvent e;
+  do {
+    touchService();
+    while (touchNextEvent(e)) out.push_back(e);
+    delay(1);
+  } while (hostClockUs < until);
+}
+
+std::vector<TouchEvent> hostRecordStroke(const HostStroke& s) {
+  std::vector<TouchEvent> ev;
+  for (int p = 0; p < s.presses; p++) {
+    if (p) hostSampleFor(HOST_STROKE_GAP_MS, ev);
+    hostTouchPress(s.x0, s.y0);
+    hostSampleFor(s.holdMs ? s.holdMs : 1, ev);
+    for (unsigned t = 1; t <= s.moveMs; t++) {
+      hostTouchMove(s.x0 + (s.x1 - s.x0) * (int)t / (int)s.moveMs,
+                    s.y0 + (s.y1 - s.y0) * (int)t / (int)s.moveMs);
+      hostSampleFor(1, ev);
+    }
+    hostTouchRelease();
+    hostSampleFor(20, ev);
+  }
+
+  uint32_t t0 = ev.empty() ? 0 : ev[0].us;   // store times from the first sample
+  for (size_t i = 0; i < ev.size(); i++) ev[i].us -= t0;
+  return ev;
+}
+
+// Feed recorded events to the recognizer with loop()-like ticks between
+// them; DRAG updates are left out (one per MOVE), the rest is the trace
+std::vector<std::string> hostReplayStroke(const std::vector<TouchEvent>& ev, int& drags) {
+  std::vector<std::string> out;
+  char line[96];
+  Gesture g;
+  uint32_t tick = 0;
+  uint32_t end = (ev.empty() ? 0 : ev.back().us) + HOST_GESTURE_TAIL_MS * 1000UL;
+
+  gestureReset();
+  drags = 0;
+  for (size_t i = 0; i <= ev.size(); i++) {
+    uint32_t next = i < ev.size() ? ev[i].us : end;
+    for (; tick < next; tick += HOST_GESTURE_TICK_MS * 1000UL) gestureTick(tick);
+    if (i < ev.size()) gestureFeed(ev[i]);
+    while (gestureNext(g)) {
+      if (g.type == GESTURE_DRAG) { drags++; continue; }
+      snprintf(line, sizeof(line), "g %s %u %d %d %d %d", GESTURE_NAMES[g.type],
+               (unsigned)(g.us - g.startUs), g.dx, g.dy, g.vx, g.vy);
+      out.push_back(line);
+    }
+  }
+  return out;
+}
+
+bool hostLoadGestureTrace(const char* path, std::vector<HostStrokeTrace>& strokes) {
+  FILE* f = fopen(path, "r");
+  if (!f) { fprintf(stderr, "cannot open gesture trace %s\n", path); return false; }
+  char line[256], type;
+  int x, y;
+  unsigned us;
+  while (fgets(line, sizeof(line), f)) {
+    line[strcspn(line, "\r\n")] = '\0';
+    if (!strncmp(line, "stroke ", 7)) {
+      strokes.push_back(HostStrokeTrace());
+      strokes.back().name = line + 7;
+    } else if (strokes.empty() || !line[0] || line[0] == '#') {
+      continue;
+    } else if (sscanf(line, "e %c %d %d %u", &type, &x, &y, &us) == 4) {
+      TouchEvent e;
+      e.type = type == 'D' ? TOUCH_DOWN : type == 'U' ? TOUCH_UP : TOUCH_MOVE;
+      e.x = x;
+      e.y = y;
+      e.z = type == 'U' ? 0 : 1000;
+      e.us = us;
+      e.irqUs = 0;
+      strokes.back().events.push_back(e);
+    } else if (line[0] == 'g') {
+      strokes.back().gestures.push_back(line);
+    }
+  }
+  fclose(f);
+  return true;
+}
+
+bool hostRunGestureTrace(const char* path) {
+  std::vector<HostStrokeTrace> strokes;
+
+  if (hostConfig.updateGolden) {
+    for (size_t i = 0; i < sizeof(HOST_STROKES) / sizeof(HOST_STROKES[0]); i++) {
+      HostStrokeTrace t;
+      t.name = HOST_STROKES[i].name;
+      t.events = hostRecordStroke(HOST_STROKES[i]);
+      strokes.push_back(t);
+    }
+  } else if (!hostLoadGestureTrace(path, strokes)) {
+    return false;
+  }
+
+  hostSerialMute(false);
+  Serial.println("\n  Stroke           Events  Drags  Gestures (first sample -> decided)");
+  Serial.println("  ───────────────────────────────────────────────────────────────────────");
+  int mismatches = 0;
+  for (size_t i = 0; i < strokes.size(); i++) {
+    HostStrokeTrace& t = strokes[i];
+    int drags;
+    std::vector<std::string> got = hostReplayStroke(t.events, drags);
+
+    std::string summary;
+    for (size_t k = 0; k < got.size(); k++) {
+      char name[24];
+      unsigned lat;
+      sscanf(got[k].c_str(), "g %23s %u", name, &lat);
+      char item[48];
+      snprintf(item, sizeof(item), "%s%s %u.%u ms", k ? ", " : "", name, lat / 1000, lat % 1000 / 100);
+      summary += item;
+    }
+    bool same = hostConfig.updateGolden || got == t.gestures;
+    Serial.printf("  %-16s %6u %6d  %s%s\n", t.name.c_str(), (unsigned)t.events.size(), drags,
+                  summary.empty() ? "-" : summary.c_str(), same ? "" : "  << DIFFERS");
+    if (!same) {
+      mismatches++;
+      for (size_t k = 0; k < t.gestures.size(); k++) Serial.printf("      want: %s\n", t.gestures[k].c_str());
+    }
+    t.gestures = got;
+  }
+
+  if (hostConfig.updateGolden) {
+    FILE* f = fopen(path, "w");
+    if (!f) { fprintf(stderr, "cannot write %s\n", path); return false; }
+    fprintf(f, "# BlackRoad gesture trace - strokes from the emulated panel (see host/README.md)\n");
+    fprintf(f, "# e D|M|U x y us-from-first-sample / g GESTURE latency-us dx dy vx vy\n");
+    for (size_t i = 0; i < strokes.size(); i++) {
+      fprintf(f, "stroke %s\n", strokes[i].name.c_str());
+      for (size_t k = 0; k < strokes[i].events.size(); k++) {
+        const TouchEvent& e = strokes[i].events[k];
+        fprintf(f, "e %c %d %d %u\n", e.type == TOUCH_DOWN ? 'D' : e.type == TOUCH_UP ? 'U' : 'M',
+                e.x, e.y, (unsigned)e.us);
+      }
+      for (size_t k = 0; k < strokes[i].gestures.size(); k++) fprintf(f, "%s\n", strokes[i].gestures[k].c_str());
+    }
+    fclose(f);
+    Serial.printf("Gesture trace recorded: %u strokes -> %s\n", (unsigned)strokes.size(), path);
+    return true;
+  }
+
+  Serial.printf("Gesture trace: %u strokes, %d mismatched\n", (unsigned)strokes.size(), mismatches);
+  return mismatches == 0;
+}
+
+// ─────────────────────────────────────────────────────────────────────
+// ALLOCATION CHECK
+// ─────────────────────────────────────────────────────────────────────
+
+// Serial commands the steady-state paths must handle without the heap
+const char* const HOST_ALLOC_COMMANDS[] = {
+  "PING",
+  "ALERT LINEAR P1",
+  "ALERT LINEAR P1",              // same minute - dedupe path
+  "ACK",
+  "ALERT GRAFANA CRITICAL",
+  "STANDBY",
+  "STATUS",
+  "UPTIME",
+  "PERF",
+};
+
+struct HostAllocCount {
+  uint64_t allocs;
+  uint64_t bytes;
+};
+
+HostAllocCount hostAllocSince(uint64_t count0, uint64_t bytes0) {
+  HostAllocCount c = { hostAllocCount - count0, hostAllocBytes - bytes0 };
+  return c;
+}
+
+bool hostRunAllocCheck() {
+  int failures = 0;
+
+  hostSerialMute(false);
+  Serial.println("\n  Idle loop()            Passes   Allocs   Bytes");
+  Serial.println("  ───────────────────────────────────────────────");
+  for (int i = 0; i < SCREEN_COUNT; i++) {
+    hostSerialMute(!hostConfig.verbose);
+    hostDrawScreen(i);
+    hostRunFor(HOST_ALLOC_WARMUP_MS);
+
+    uint64_t count0 = hostAllocCount, bytes0 = hostAllocBytes;
+    uint64_t until = hostClockUs + (uint64_t)HOST_ALLOC_WINDOW_MS * 1000;
+    unsigned passes = 0;
+    do {
+      loop();
+      passes++;
+    } while (hostClockUs < until);
+    HostAllocCount c = hostAllocSince(count0, bytes0);
+
+    hostSerialMute(false);
+    if (c.allocs) failures++;
+    Serial.printf("  %-20s %8u %8llu %7llu%s\n", SCREEN_NAMES[i], passes,
+                  (unsigned long long)c.allocs, (unsigned long long)c.bytes, c.allocs ? "  << ALLOCATES" : "");
+  }
+
+  Serial.println("\n  Serial command                    Allocs   Bytes");
+  Serial.println("  ───────────────────────────────────────────────");
+  hostSerialMute(!hostConfig.verbose);
+  hostDrawScreen(SCREEN_HOME);
+  hostRunFor(HOST_ALLOC_WARMUP_MS);
+  for (size_t i = 0; i < sizeof(HOST_ALLOC_COMMANDS) / sizeof(HOST_ALLOC_COMMANDS[0]); i++) {
+    hostSerialMute(!hostConfig.verbose);
+    hostSerialInject(HOST_ALLOC_COMMANDS[i]);
+    hostSerialInject("\n");
+    uint64_t count0 = hostAllocCount, bytes0 = hostAllocBytes;
+    handleSerialCommand();
+    HostAllocCount c = hostAllocSince(count0, bytes0);
+    hostRunFor(HOST_LOOP_SLICE_MS);   // bus events, pager draw (a redraw, not counted)
+
+    hostSerialMute(false);
+    if (c.allocs) failures++;
+    Serial.printf("  %-32s %7llu %7llu%s\n", HOST_ALLOC_COMMANDS[i],
+                  (unsigned long long)c.allocs, (unsigned long long)c.bytes, c.allocs ? "  << ALLOCATES" : "");
+  }
+
+  // Nav refresh: fetch copy -> publish -> UI sync, with unchanged data
+  hostSerialMute(!hostConfig.verbose);
+  hostDrawScreen(SCREEN_HOME);
+  netPublish();
+  netSync();
+  uint64_t count0 = hostAllocCount, bytes0 = hostAllocBytes;
+  netPublish();
+  netSync();
+  HostAllocCount c = hostAllocSince(count0, bytes0);
+  hostSerialMute(false);
+  if (c.allocs) failures++;
+  Serial.printf("\n  %-32s %7llu %7llu%s\n", "Nav publish + sync (unchanged)",
+                (unsigned long long)c.allocs, (unsigned long long)c.bytes, c.allocs ? "  << ALLOCATES" : "");
+
+  // Alert checkers with every condition met (the offline host never gets
+  // past checkAllAlerts()' WiFi guard), then state and cooldowns restored
+  hostSerialMute(!hostConfig.verbose);
+  NavigationState savedNav = navState;
+  CRMMetrics savedCrm = crmMetrics;
+  uint32_t savedSovereign = stackState.sovereignMask;
+  stackState.sovereignMask = 0;
+  navState.meshHealthy = navState.crmHealthy = true;
+  navState.activeNodes = ALERT_MESH_NODES_THRESHOLD - 1;
+  crmMetrics.hotLeads = ALERT_HOT_LEADS_THRESHOLD + 1;
+  crmMetrics.pipelineValue = 1200000;
+
+  count0 = hostAllocCount;
+  bytes0 = hostAllocBytes;
+  checkHotLeadsAlert();
+  checkSovereigntyAlert();
+  checkMeshAlert();
+  checkPipelineMilestoneAlert();
+  navState.meshHealthy = navState.crmHealthy = navState.aiHealthy = false;
+  checkSystemHealthAlert();
+  c = hostAllocSince(count0, bytes0);
+
+  int fired = getInfraAlertCount();
+  clearInfraAlertHistory();
+  navState = savedNav;
+  crmMetrics = savedCrm;
+  stackState.sovereignMask = savedSovereign;
+  hostSerialMute(false);
+  if (c.allocs) failures++;
+  char label[40];
+  snprintf(label, sizeof(label), "Alert checks (%d fired)", fired);
+  Serial.printf("  %-32s %7llu %7llu%s\n", label,
+                (unsigned long long)c.allocs, (unsigned long long)c.bytes, c.allocs ? "  << ALLOCATES" : "");
+
+  Serial.printf("\nAllocation check: %d steady-state path(s) allocating\n", failures);
+  return failures == 0;
+}
+
+// ─────────────────────────────────────────────────────────────────────
+// IDLE CHECK - what loopIdle() and animations take for input
+// ─────────────────────────────────────────────────────────────────────
+
+struct HostIdleCase {
+  const char* name;
+  const char* bytes;     // typed on UART0 before the window
+  uint32_t lines;        // command lines it completes
+};
+
+// One stream: a line that stops mid-way must not count as input until
+// its newline arrives
+const HostIdleCase HOST_IDLE_CASES[] = {
+  { "nothing buffered",        "",        0 },
+  { "half a line (\"PIN\")",    "PIN",     0 },
+  { "rest of it (\"G\\n\")",     "G\n",     1 },
+};
+
+bool hostRunIdleCheck() {
+  int failures = 0;
+
+  hostSerialMute(false);
+  Serial.println("\n  Idle with               Wakes   Passes  Pending  Lines");
+  Serial.println("  ───────────────────────────────────────────────────────");
+  hostSerialMute(!hostConfig.verbose);
+  hostDrawScreen(SCREEN_HOME);
+  hostRunFor(HOST_ALLOC_WARMUP_MS);
+  for (size_t i = 0; i < sizeof(HOST_IDLE_CASES) / sizeof(HOST_IDLE_CASES[0]); i++) {
+    const HostIdleCase& ic = HOST_IDLE_CASES[i];
+    hostSerialMute(!hostConfig.verbose);
+    hostSerialInject(ic.bytes);
+    bool wakes = animInputPending();   // unread bytes wake the loop once
+    uint32_t lines0 = serialStats.lines;
+    uint64_t until = hostClockUs + (uint64_t)HOST_ALLOC_WINDOW_MS * 1000;
+    unsigned passes = 0, pending = 0;
+    do {
+      loop();
+      passes++;
+      if (animInputPending()) pending++;
+    } while (hostClockUs < until);
+    uint32_t lines = serialStats.lines - lines0;
+
+    hostSerialMute(false);
+    bool bad = wakes != (ic.bytes[0] != '\0') || pending || lines != ic.lines;
+    if (bad) failures++;
+    Serial.printf("  %-22s %6s %8u %8u %6u%s\n", ic.name, wakes ? "yes" : "no", passes, pending, lines,
+                  bad ? "  << WRONG" : "");
+  }
+
+  Serial.printf("\nIdle check: %d case(s) wrong\n", failures);
+  return failures == 0;
+}
+
+// ─────────────────────────────────────────────────────────────────────
+// JSON SOAK - per-fetch documents vs. the arena on a modeled heap
+// ─────────────────────────────────────────────────────────────────────
+
+#define HOST_SOAK_HEAP      (160 * 1024) // free internal heap after boot + WiFi
+#define HOST_SOAK_HEADER    8            // per-block overhead, 4-byte rounding
+#define HOST_SOAK_BOOT      24           // long-lived blocks taken at boot
+#define HOST_SOAK_API_MS    (15UL * 60 * 1000)
+#define HOST_SOAK_FILE_MS   (60UL * 60 * 1000)
+
+// Response bytes held in a String while the document parses (0 = streamed
+// from a File)
+const uint16_t HOST_SOAK_PAYLOAD[JSON_CALLER_COUNT] = {
+  1400, 500, 1800, 300, 9000, 2600, 400, 1600, 5200, 6000, 0, 0,
+};
+
+struct HostHeapBlock {
+  uint32_t off, size;
+  bool used;
+};
+
+// First fit with splitting and neighbour coalescing - the shape of
+// multi_heap, not its exact layout
+struct HostHeapModel {
+  std::vector<HostHeapBlock> blocks;
+  uint32_t used, peakUsed, minFree, minLargest, failed;
+  float worstFrag;
+};
+
+struct HostSoakBlock {
+  int32_t off;
+  uint32_t until;   // seconds
+};
+
+uint32_t hostSoakSeed;
+
+uint32_t hostSoakRand(uint32_t lo, uint32_t hi) {
+  hostSoakSeed = hostSoakSeed * 1103515245u + 12345u;
+  return lo + (hostSoakSeed >> 8) % (hi - lo + 1);
+}
+
+void hostHeapInit(HostHeapModel& h) {
+  h.blocks.assign(1, HostHeapBlock{ 0, HOST_SOAK_HEAP, false });
+  h.used = h.peakUsed = h.failed = 0;
+  h.minFree = h.minLargest = HOST_SOAK_HEAP;
+  h.worstFrag = 0;
+}
+
+int32_t hostHeapAlloc(HostHeapModel& h, uint32_t n) {
+  n = ((n + 3) & ~3u) + HOST_SOAK_HEADER;
+  for (size_t i = 0; i < h.blocks.size(); i++) {
+    HostHeapBlock& b = h.blocks[i];
+    if (b.used || b.size < n) continue;
+    if (b.size - n >= 16) {
+      HostHeapBlock rest = { b.off + n, b.size - n, false };
+      b.size = n;
+      h.blocks.insert(h.blocks.begin() + i + 1, rest);
+    }
+    h.blocks[i].used = true;
+    h.used += h.blocks[i].size;
+    if (h.used > h.peakUsed) h.peakUsed = h.used;
+    return (int32_t)h.blocks[i].off;
+  }
+  h.failed++;
+  return -1;
+}
+
+void hostHeapFree(HostHeapModel& h, int32_t off) {
+  if (off < 0) return;
+  for (size_t i = 0; i < h.blocks.size(); i++) {
+    if (h.blocks[i].off != (uint32_t)off) continue;
+    h.blocks[i].used = false;
+    h.used -= h.blocks[i].size;
+    if (i + 1 < h.blocks.size() && !h.blocks[i + 1].used) {
+      h.blocks[i].size += h.blocks[i + 1].size;
+      h.blocks.erase(h.blocks.begin() + i + 1);
+    }
+    if (i > 0 && !h.blocks[i - 1].used) {
+      h.blocks[i - 1].size += h.blocks[i].size;
+      h.blocks.erase(h.blocks.begin() + i);
+    }
+    return;
+  }
+}
+
+void hostHeapSample(HostHeapModel& h) {
+  uint32_t largest = 0;
+  for (size_t i = 0; i < h.blocks.size(); i++) {
+    if (!h.blocks[i].used && h.blocks[i].size > largest) largest = h.blocks[i].size;
+  }
+  uint32_t freeBytes = HOST_SOAK_HEAP - h.used;
+  if (freeBytes < h.minFree) h.minFree = freeBytes;
+  if (largest < h.minLargest) h.minLargest = largest;
+  float frag = freeBytes ? 1.0f - (float)largest / freeBytes : 0;
+  if (frag > h.worstFrag) h.worstFrag = frag;
+}
+
+// One fetch: payload String, document (heap or arena slot), a few small
+// survivors (headers, copied fields) that outlive it, then doc + payload
+// freed. Returns false if the document could not be allocated.
+bool hostSoakFetch(HostHeapModel& h, JsonCaller c, bool arena, int32_t* large,
+                   std::vector<HostSoakBlock>& live, uint32_t now) {
+  int32_t payload = -1;
+  if (HOST_SOAK_PAYLOAD[c]) {
+    uint32_t n = HOST_SOAK_PAYLOAD[c];
+    payload = hostHeapAlloc(h, hostSoakRand(n * 3 / 4, n * 5 / 4));
+    if (payload < 0) return false;
+  }
+
+  uint32_t cap = JSON_CALLERS[c].capacity;
+  int32_t doc = -1;
+  bool inSlot = arena && cap <= JSON_ARENA_LARGE_INTERNAL;
+  if (inSlot && cap > JSON_ARENA_SMALL && *large < 0) {
+    *large = hostHeapAlloc(h, JSON_ARENA_LARGE_INTERNAL);   // first use, kept
+    inSlot = *large >= 0;
+  }
+  if (!inSlot) doc = hostHeapAlloc(h, cap);
+  bool ok = inSlot || doc >= 0;
+
+  for (uint32_t k = hostSoakRand(0, 2); ok && k > 0; k--) {
+    HostSoakBlock b = { hostHeapAlloc(h, hostSoakRand(32, 160)), now + hostSoakRand(60, 1800) };
+    if (b.off >= 0) live.push_back(b);
+  }
+  hostHeapFree(h, doc);
+  hostHeapFree(h, payload);
+  return ok;
+}
+
+struct HostSoakResult {
+  HostHeapModel heap;
+  uint32_t fetches, failedFetches;
+};
+
+// Same seed for every run, so both modes see identical traffic
+void hostSoakRun(HostSoakResult& r, unsigned hours, bool withApi, bool arena) {
+  HostHeapModel& h = r.heap;
+  hostHeapInit(h);
+  hostSoakSeed = 42;
+  r.fetches = r.failedFetches = 0;
+
+  for (int i = 0; i < HOST_SOAK_BOOT; i++) hostHeapAlloc(h, hostSoakRand(64, 3072));
+  if (arena) hostHeapAlloc(h, JSON_ARENA_SMALL);
+  int32_t large = -1;
+
+  std::vector<HostSoakBlock> live;
+  const JsonCaller nav[] = { JSON_MESH, JSON_CRM_STATS, JSON_HOT_LEADS, JSON_AI_HEALTH };
+  const JsonCaller api[] = { JSON_GITHUB, JSON_GITHUB_COMMIT, JSON_CRYPTO, JSON_WEATHER, JSON_STRIPE, JSON_LINEAR };
+  const JsonCaller files[] = { JSON_CRM_FILE, JSON_STATS_FILE };
+
+  uint32_t end = hours * 3600;
+  for (uint32_t now = 0; now < end; now++) {
+    for (size_t i = 0; i < live.size();) {
+      if (live[i].until <= now) {
+        hostHeapFree(h, live[i].off);
+        live[i] = live.back();
+        live.pop_back();
+      } else {
+        i++;
+      }
+    }
+
+    // Network buffers, short-lived
+    for (uint32_t k = hostSoakRand(0, 3); k > 0; k--) {
+      HostSoakBlock b = { hostHeapAlloc(h, hostSoakRand(64, 1600)), now + hostSoakRand(1, 20) };
+      if (b.off >= 0) live.push_back(b);
+    }
+
+    uint64_t ms = (uint64_t)now * 1000;
+    if (ms % NAV_REFRESH_INTERVAL == 0) {
+      for (size_t i = 0; i < sizeof(nav) / sizeof(nav[0]); i++) {
+        r.fetches++;
+        if (!hostSoakFetch(h, nav[i], arena, &large, live, now)) r.failedFetches++;
+      }
+    }
+    if (withApi && ms % HOST_SOAK_API_MS == 0) {
+      for (size_t i = 0; i < sizeof(api) / sizeof(api[0]); i++) {
+        r.fetches++;
+        if (!hostSoakFetch(h, api[i], arena, &large, live, now)) r.failedFetches++;
+      }
+    }
+    if (withApi && ms % HOST_SOAK_FILE_MS == 0) {
+      for (size_t i = 0; i < sizeof(files) / sizeof(files[0]); i++) {
+        r.fetches++;
+        if (!hostSoakFetch(h, files[i], arena, &large, live, now)) r.failedFetches++;
+      }
+    }
+    hostHeapSample(h);
+  }
+}
+
+bool hostRunJsonSoak(unsigned hours) {
+  hostSerialMute(false);
+  Serial.printf("\n  JSON soak: %u h modeled, %u KB heap, first fit\n", hours, HOST_SOAK_HEAP / 1024);
+  Serial.println("  Workload      Documents    Peak used  Min free  Min largest  Worst frag  Failed");
+  Serial.println("  ───────────────────────────────────────────────────────────────────────────────");
+  bool ok = true;
+  for (int w = 0; w < 2; w++) {
+    for (int a = 0; a < 2; a++) {
+      HostSoakResult r;
+      hostSoakRun(r, hours, w == 1, a == 1);
+      const HostHeapModel& h = r.heap;
+      Serial.printf("  %-13s %-12s %6u KB  %5u KB  %8u KB  %9.1f%%  %u/%u\n",
+                    w ? "nav + api" : "nav", a ? "arena" : "per fetch",
+                    h.peakUsed / 1024, h.minFree / 1024, h.minLargest / 1024,
+                    h.worstFrag * 100, r.failedFetches, r.fetches);
+      if (a && r.failedFetches) ok = false;
+    }
+  }
+  return ok;
+}
+
+// ─────────────────────────────────────────────────────────────────────
+// ALERT STORM - alert_dedupe.h against a reference model
+// ─────────────────────────────────────────────────────────────────────
+
+#define HOST_STORM_WRAP_MS  300000UL   // millis() wraps this far into each storm
+
+struct HostStorm {
+  const char* name;
+  uint32_t alerts;
+  uint32_t ids;          // source x priority pairs
+  uint32_t ttlS;
+  bool extend;
+  uint32_t minutes;      // storm length
+  uint8_t hotPct;        // share of alerts from the hottest 5% of IDs
+  bool minuteEdge;       // each ID twice, 2 ms .. 2 s apart across a minute boundary
+};
+
+const HostStorm HOST_STORMS[] = {
+  { "minute edge",   4000,  2000, 60, false, 40,  0, true  },
+  { "steady",      200000,  1500, 60, false, 30, 80, false },
+  { "steady",      200000,  1500, 60, true,  30, 80, false },
+  { "short ttl",   100000,   500,  5, false, 10, 50, false },
+  { "overflow",     50000, 50000, 60, false,  1,  0, false },
+};
+
+const char* const HOST_STORM_PRIORITIES[4] = { "P1", "P2", "CRITICAL", "URGENT" };
+
+struct HostStormEvent {
+  uint32_t ms;           // since the storm started
+  uint32_t id;
+  bool operator<(const HostStormEvent& o) const { return ms < o.ms; }
+};
+
+struct HostStormResult {
+  uint32_t paged, suppressed, evicted;
+  uint32_t missed;       // duplicate by the model, paged by the table
+  uint32_t wrong;        // new by the model, suppressed by the table
+  int32_t oldWrong;      // the 20-slot minute cache vs the model, -1 = not comparable
+  double nsPerAlert;
+  float avgProbes;
+};
+
+void hostStormEvents(const HostStorm& st, std::vector<HostStormEvent>& ev) {
+  ev.clear();
+  uint32_t span = st.minutes * 60000;
+  uint32_t hot = st.ids / 20 ? st.ids / 20 : 1;
+  for (uint32_t i = 0; i < st.alerts; i++) {
+    if (st.minuteEdge) {
+      uint32_t id = i / 2;
+      uint32_t edge = (id % st.minutes + 1) * 60000;
+      uint32_t d = hostSoakRand(1, 1000);
+      ev.push_back(HostStormEvent{ i % 2 ? edge + d : edge - d, id });
+    } else {
+      uint32_t id = hostSoakRand(1, 100) <= st.hotPct ? hostSoakRand(0, hot - 1) : hostSoakRand(0, st.ids - 1);
+      ev.push_back(HostStormEvent{ hostSoakRand(0, span - 1), id });
+    }
+  }
+  std::stable_sort(ev.begin(), ev.end());
+}
+
+void hostStormRun(const HostStorm& st, HostStormResult& r) {
+  std::vector<HostStormEvent> ev;
+  hostStormEvents(st, ev);
+  std::vector<std::string> sources(st.ids / 4 + 1);
+  for (size_t i = 0; i < sources.size(); i++) sources[i] = "SRC" + std::to_string(i);
+
+  uint32_t ttl = st.ttlS * 1000;
+  uint32_t base = 0u - (uint32_t)HOST_STORM_WRAP_MS;
+  alertDedupeClear();
+  resetAlertDedupeStats();
+  alertDedupeSetTtl(ttl, st.extend);
+
+  // Table alone, timed: hash + lookup per alert
+  std::vector<uint8_t> dup(ev.size());
+  typedef std::chrono::steady_clock Clock;
+  Clock::time_point t0 = Clock::now();
+  for (size_t i = 0; i < ev.size(); i++) {
+    const std::string& src = sources[ev[i].id / 4];
+    StrView prio = HOST_STORM_PRIORITIES[ev[i].id % 4];
+    dup[i] = isDuplicateAlertAt(StrView(src.data(), src.size()), prio, base + ev[i].ms);
+  }
+  r.nsPerAlert = std::chrono::duration<double, std::nano>(Clock::now() - t0).count() / ev.size();
+  r.paged = dedupeStats.raised;
+  r.suppressed = dedupeStats.suppressed;
+  r.evicted = dedupeStats.evicted;
+  r.avgProbes = (float)dedupeStats.probes / dedupeStats.lookups;
+
+  // Model: unbounded, one window per ID. `follow` tracks what the table
+  // did, so one eviction counts once; `ideal` is the exact answer the old
+  // cache is held to
+  std::vector<uint32_t> follow(st.ids), ideal(st.ids);
+  std::vector<bool> followSeen(st.ids), idealSeen(st.ids);
+  std::vector<std::string> oldCache(20);
+  int oldIndex = 0;
+  r.missed = r.wrong = 0;
+  r.oldWrong = st.ttlS == 60 && !st.extend ? 0 : -1;
+  for (size_t i = 0; i < ev.size(); i++) {
+    uint32_t id = ev[i].id, now = base + ev[i].ms;
+    bool want = followSeen[id] && now - follow[id] < ttl;
+    if (dup[i] && !want) r.wrong++;
+    if (!dup[i] && want) r.missed++;
+    if (!dup[i] || st.extend) {
+      follow[id] = now;
+      followSeen[id] = true;
+    }
+
+    bool exact = idealSeen[id] && now - ideal[id] < ttl;
+    if (!exact || st.extend) {
+      ideal[id] = now;
+      idealSeen[id] = true;
+    }
+    if (r.oldWrong >= 0) {
+      std::string key = sources[id / 4] + "-" + HOST_STORM_PRIORITIES[id % 4] + "-" + std::to_string(now / 60000);
+      bool old = false;
+      for (int k = 0; k < 20; k++) old = old || oldCache[k] == key;
+      if (!old) {
+        oldCache[oldIndex] = key;
+        oldIndex = (oldIndex + 1) % 20;
+      }
+      if (old != exact) r.oldWrong++;
+    }
+  }
+}
+
+bool hostRunAlertStorm() {
+  hostSerialMute(false);
+  if (!dedupeTable) {
+    Serial.println("\n  Alert storm: no dedupe table");
+    return false;
+  }
+  // Both table sizes initAlertDedupe() can pick, PSRAM first
+  const uint32_t sizes[2] = { DEDUPE_SLOTS_PSRAM, DEDUPE_SLOTS_INTERNAL };
+  uint32_t boardSlots = dedupeSlots;
+  Serial.printf("\n  Alert storm: %u B slots, probe limit %u, millis() wraps %lu s in\n",
+                (unsigned)sizeof(DedupeSlot), DEDUPE_PROBE, HOST_STORM_WRAP_MS / 1000);
+  Serial.println("  Storm        Slots  Mode    TTL   Alerts    IDs   Paged  Suppr.  Evicted  Missed  Wrong  Old wrong  Probes  ns/alert");
+  Serial.println("  ────────────────────────────────────────────────────────────────────────────────────────────────────────────────────");
+  bool ok = true;
+  for (int n = 0; n < 2; n++) {
+    if (!alertDedupeAlloc(sizes[n])) {
+      Serial.printf("  no room for %u slots\n", sizes[n]);
+      ok = false;
+      break;
+    }
+    hostSoakSeed = 1;
+    for (size_t i = 0; i < sizeof(HOST_STORMS) / sizeof(HOST_STORMS[0]); i++) {
+      const HostStorm& st = HOST_STORMS[i];
+      HostStormResult r;
+      hostStormRun(st, r);
+      char oldWrong[12] = "-";
+      if (r.oldWrong >= 0) snprintf(oldWrong, sizeof(oldWrong), "%d", r.oldWrong);
+      bool bad = r.wrong || (r.missed && !r.evicted);
+      Serial.printf("  %-12s %5u  %-6s %4us %8u %6u %7u %7u %8u %7u %6u %10s %7.2f %9.1f%s\n",
+                    st.name, dedupeSlots, st.extend ? "EXTEND" : "FIXED", st.ttlS, st.alerts, st.ids,
+                    r.paged, r.suppressed, r.evicted, r.missed, r.wrong, oldWrong,
+                    r.avgProbes, r.nsPerAlert, bad ? "  << WRONG" : "");
+      if (bad) ok = false;
+    }
+  }
+  alertDedupeAlloc(boardSlots);
+  resetAlertDedupeStats();
+  alertDedupeSetTtl(DEDUPE_TTL_DEFAULT_MS, false);
+  Serial.printf("\nAlert storm: %s\n", ok ? "table matches the model" : "table disagrees with the model");
+  return ok;
+}
+
+// ─────────────────────────────────────────────────────────────────────
+// SERIAL PORT - the firmware on a pty in real time (tools/serial_bench.py)
+// ─────────────────────────────────────────────────────────────────────
+
+static int hostSerialFd = -1;
+
+// Serial output goes to the port; waits rather than drop if it is full
+void hostSerialPortWrite(const uint8_t* buf, size_t n) {
+  while (n) {
+    ssize_t w = write(hostSerialFd, buf, n);
+    if (w > 0) {
+      buf += w;
+      n -= w;
+      continue;
+    }
+    if (w < 0 && errno != EAGAIN && errno != EINTR) return;   // other end gone
+    pollfd p = { hostSerialFd, POLLOUT, 0 };
+    poll(&p, 1, 100);
+  }
+}
+
+// Bytes from the port become UART0 input; loop() runs until the other end
+// closes. The virtual clock follows the wall clock - never ahead of it
+// (waits out loop()'s delays), never behind (jumps over slow passes) -
+// so timers, animations and the pager fire at their real rate. A hangup
+// ends the wait early.
+bool hostRunSerialPort(const char* path) {
+  hostSerialFd = open(path, O_RDWR | O_NOCTTY | O_NONBLOCK);
+  if (hostSerialFd < 0) {
+    fprintf(stderr, "%s: %s\n", path, strerror(errno));
+    return false;
+  }
+  termios tio;
+  if (tcgetattr(hostSerialFd, &tio) == 0) {
+    cfmakeraw(&tio);
+    tcsetattr(hostSerialFd, TCSANOW, &tio);
+  }
+  hostSerialSink(hostSerialPortWrite);
+
+  typedef std::chrono::steady_clock Clock;
+  Clock::time_point start = Clock::now();
+  uint64_t clockBase = hostClockUs;
+  uint64_t passes = 0, busyUs = 0, worstUs = 0, overBudget = 0;
+  uint8_t buf[512];
+  for (;;) {
+    ssize_t n;
+    while ((n = read(hostSerialFd, buf, sizeof(buf))) > 0) hostSerialInject(buf, n);
+    if (n == 0 || (errno != EAGAIN && errno != EINTR)) break;   // EOF / EIO: closed
+
+    Clock::time_point t0 = Clock::now();
+    loop();
+    uint64_t us = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - t0).count();
+    passes++;
+    busyUs += us;
+    if (us > worstUs) worstUs = us;
+    if (us > STALL_BUDGET_MS * 1000UL) overBudget++;
+
+    uint64_t real = clockBase + std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - start).count();
+    if (hostClockUs > real) {
+      pollfd p = { hostSerialFd, 0, 0 };    // only a hangup ends the wait early
+      poll(&p, 1, (int)((hostClockUs - real + 999) / 1000));
+    } else {
+      hostClockUs = real;
+    }
+  }
+
+  hostSerialSink(nullptr);
+  close(hostSerialFd);
+  double secs = std::chrono::duration<double>(Clock::now() - start).count();
+  fprintf(stderr, "Serial port: %llu loop() passes in %.1f s, busy %.1f%%, worst pass %llu us, %llu over %d ms\n",
+          (unsigned long long)passes, secs, secs > 0 ? busyUs / (secs * 1e4) : 0.0,
+          (unsigned long long)worstUs, (unsigned long long)overBudget, STALL_BUDGET_MS);
+  return true;
+}
+
+bool hostRunScript(const char* path) {
+  FILE* f = fopen(path, "r");
+  if (!f) {
+    fprintf(stderr, "cannot open script %s\n", path);
+    return false;
+  }
+
+  char line[256];
+  int lineNo = 0;
+  bool ok = true;
+  while (fgets(line, sizeof(line), f)) {
+    lineNo++;
+    line[strcspn(line, "\r\n")] = '\0';
+    char cmd[16] = "", arg[200] = "";
+    if (sscanf(line, " %15s %199[^\n]", cmd, arg) < 1 || cmd[0] == '#') continue;
+
+    int a, b, c, d;
+    unsigned long ms;
+    if (!strcmp(cmd, "screen")) {
+      int s = hostFindScreen(arg);
+      if (s < 0) { fprintf(stderr, "%s:%d: unknown screen '%s'\n", path, lineNo, arg); ok = false; break; }
+      hostDrawScreen(s);
+    } else if (!strcmp(cmd, "tap") && sscanf(arg, "%d %d", &a, &b) == 2) {
+      hostTap(a, b);
+    } else if (!strcmp(cmd, "swipe") && sscanf(arg, "%d %d %d %d %lu", &a, &b, &c, &d, &ms) == 5) {
+      hostSwipe(a, b, c, d, ms);
+    } else if (!strcmp(cmd, "wait") && sscanf(arg, "%lu", &ms) == 1) {
+      hostRunFor(ms);
+    } else if (!strcmp(cmd, "noise") && sscanf(arg, "%d", &a) == 1) {
+      hostTouch.noise = a;
+    } else if (!strcmp(cmd, "serial")) {
+      hostSerialInject(arg);
+      hostSerialInject("\n");
+      hostRunFor(HOST_LOOP_SLICE_MS);
+    } else if (!strcmp(cmd, "snap") && arg[0]) {
+      long diff = hostSnap(arg);
+      fprintf(stderr, "snap %-24s %s\n", arg,
+              hostConfig.updateGolden ? "golden updated" : diff < 0 ? "no golden" : diff == 0 ? "ok" : "DIFFERS");
+    } else {
+      fprintf(stderr, "%s:%d: bad command '%s'\n", path, lineNo, line);
+      ok = false;
+      break;
+    }
+  }
+  fclose(f);
+
+  hostSerialMute(false);
+  Serial.printf("\nScript finished at %llu ms virtual time, %llu modeled SPI bytes\n",
+                (unsigned long long)(hostClockUs / 1000), (unsigned long long)hostTftStats.spiBytes);
+  printRenderReport(SCREEN_NAMES, SCREEN_COUNT);
+  return ok;
+}
+
+int main(int argc, char** argv) {
+  const char* script = nullptr;
+  const char* tapTrace = nullptr;
+  const char* gestureTrace = nullptr;
+  const char* serialPort = nullptr;
+  bool allocCheck = false;
+  bool idleCheck = false;
+  bool alertStorm = false;
+  unsigned soakHours = 0;
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "--script") && i + 1 < argc) script = argv[++i];
+    else if (!strcmp(argv[i], "--tap-trace") && i + 1 < argc) tapTrace = argv[++i];
+    else if (!strcmp(argv[i], "--gesture-trace") && i + 1 < argc) gestureTrace = argv[++i];
+    else if (!strcmp(argv[i], "--serial-port") && i + 1 < argc) serialPort = argv[++i];
+    else if (!strcmp(argv[i], "--alloc-check")) allocCheck = true;
+    else if (!strcmp(argv[i], "--idle-check")) idleCheck = true;
+    else if (!strcmp(argv[i], "--alert-storm")) alertStorm = true;
+    else if (!strcmp(argv[i], "--json-soak")) soakHours = i + 1 < argc && isdigit((unsigned char)argv[i + 1][0]) ? atoi(argv[++i]) : 24;
+    else if (!strcmp(argv[i], "--out") && i + 1 < argc) hostConfig.outDir = argv[++i];
+    else if (!strcmp(argv[i], "--golden") && i + 1 < argc) hostConfig.goldenDir = argv[++i];
+    else if (!strcmp(argv[i], "--update-golden")) hostConfig.updateGolden = true;
+    else if (!strcmp(argv[i], "--verbose")) hostConfig.verbose = true;
+    else {
+      fprintf(stderr, "usage: %s [--script FILE] [--tap-trace FILE] [--gesture-trace FILE] [--serial-port PTY] [--alloc-check] [--idle-check] [--alert-storm] [--json-soak [HOURS]] [--out DIR] [--golden DIR] [--update-golden] [--verbose]\n", argv[0]);
+      return 2;
+    }
+  }
+
+  hostSerialMute(!hostConfig.verbose);
+  setup();
+
+  // Offline boot skips these; the screens need deterministic data
+  initPerformanceMonitor();
+  initGenesisVerification();
+  initSovereignStack();
+  initStaticMeshData();
+  initStaticCRMData();
+  initStaticAIData();
+  netPublish();   // fetchers fill navWork; screens draw the UI copy
+  netSync();
+  resetRenderProfiler();
+
+  bool ok;
+  if (script) {
+    ok = hostRunScript(script);
+  } else if (tapTrace) {
+    ok = hostRunTapTrace(tapTrace);
+  } else if (gestureTrace) {
+    ok = hostRunGestureTrace(gestureTrace);
+  } else if (serialPort) {
+    ok = hostRunSerialPort(serialPort);
+  } else if (allocCheck) {
+    ok = hostRunAllocCheck();
+  } else if (idleCheck) {
+    ok = hostRunIdleCheck();
+  } else if (soakHours) {
+    ok = hostRunJsonSoak(soakHours);
+  } else if (alertStorm) {
+    ok = hostRunAlertStorm();
+  } else {
+    ok = true;
+    hostRunAllScreens();
+  }
+
+  hostSerialMute(false);
+  if (!hostConfig.updateGolden && (hostGoldenFailures || hostGoldenMissing)) {
+    Serial.printf("\nGolden images: %d differ, %d missing (%s)\n",
+                  hostGoldenFailures, hostGoldenMissing, hostConfig.goldenDir.c_str());
+  }
+  Serial.flush();
+  bool goldenOk = hostConfig.updateGolden || (hostGoldenFailures == 0 && hostGoldenMissing == 0);
+  return (ok && goldenOk) ? 0 : 1;
+}
+
+#endif // HOST_RUNNER_H
@@ -0,0 +1,98 @@
+/*
+ * BlackRoad host shim - SPI bus, emulated XPT2046, radio and storage
+ */
+
+#include "Arduino.h"
+#include "SPI.h"
+#include "WiFi.h"
+#include "SD.h"
+#include "SPIFFS.h"
+
+SPIClass SPI(VSPI);
+WiFiClass WiFi;
+SDFS SD;
+SPIFFSFS SPIFFS;
+
+HostTouchPanel hostTouch = { false, 0, 0, 0, 0 };
+
+// PENIRQ idles high (external pull-up on the board)
+static struct TouchIrqIdle {
+  TouchIrqIdle() { hostSetPin(HOST_TOUCH_IRQ_PIN, HIGH); }
+} touchIrqIdle;
+
+// ─────────────────────────────────────────────────────────────────────
+// XPT2046 EMULATION
+// ─────────────────────────────────────────────────────────────────────
+
+#define XPT_CMD_X  0x90
+#define XPT_CMD_Y  0xD0
+#define XPT_CMD_Z1 0xB0
+#define XPT_CMD_Z2 0xC0
+
+// Firmware calibration (getTouchCoordinates): screen X comes from the
+// Y channel, screen Y from the inverted X channel.
+#define XPT_RAW_LO 200
+#define XPT_RAW_HI 3700
+
+static uint32_t touchNoiseState = 0x1234567;
+
+static int touchNoise() {
+  if (hostTouch.noise <= 0) return 0;
+  touchNoiseState = touchNoiseState * 1103515245u + 12345u;
+  return (int)((touchNoiseState >> 16) % (uint32_t)(2 * hostTouch.noise + 1)) - hostTouch.noise;
+}
+
+// Smallest raw value that the firmware's map() turns back into `target`
+static int rawFor(int target, long outMax, bool inverted) {
+  for (int raw = 0; raw < 4096; raw++) {
+    long v = inverted ? map(raw, XPT_RAW_HI, XPT_RAW_LO, 0, outMax)
+                      : map(raw, XPT_RAW_LO, XPT_RAW_HI, 0, outMax);
+    if (inverted ? v <= target : v >= target) return raw;
+  }
+  return inverted ? 0 : 4095;
+}
+
+static uint16_t touchSample(uint8_t cmd) {
+  hostTouch.samples++;
+  if (!hostTouch.down) return cmd == XPT_CMD_Z2 ? (uint16_t)(4095 << 3) : 0;   // no pressure
+
+  int raw = 0;
+  switch (cmd) {
+    case XPT_CMD_X:  raw = rawFor(hostTouch.y, 240, true); break;
+    case XPT_CMD_Y:  raw = rawFor(hostTouch.x, 320, false); break;
+    case XPT_CMD_Z1: raw = 1200; break;
+    case XPT_CMD_Z2: raw = 2400; break;
+    default: return 0;
+  }
+  raw = constrain(raw + touchNoise(), 0, 4095);
+  return (uint16_t)(raw << 3);   // 12-bit result is clocked out MSB-aligned
+}
+
+uint8_t SPIClass::transfer(uint8_t data) {
+  if (data & 0x80) lastCommand = data;   // start bit: new conversion
+  return 0;
+}
+
+uint16_t SPIClass::transfer16(uint16_t data) {
+  (void)data;
+  uint16_t v = touchSample(lastCommand);
+  lastCommand = 0;
+  return v;
+}
+
+void hostTouchPress(int x, int y) {
+  hostTouch.x = constrain(x, 0, 319);
+  hostTouch.y = constrain(y, 0, 239);
+  hostTouch.down = true;
+  hostSetPin(HOST_TOUCH_IRQ_PIN, LOW);   // PENIRQ is active low
+}
+
+void hostTouchMove(int x, int y) {
+  hostTouch.x = constrain(x, 0, 319);
+  hostTouch.y = constrain(y, 0, 239);
+}
+
+void hostTouchRelease() {
+  hostTouch.down = false;
+  hostSetPin(HOST_TOUCH_IRQ_PIN, HIGH);
+}
@@ -0,0 +1,11 @@
+#ifndef SECRETS_H
+#define SECRETS_H
+
+/*
+ * Host build placeholders - the native runner never talks to the
+ * network, so none of these are used for real.
+ */
+
+#define CRM_SECRET "host-build"
+
+#endif // SECRETS_H
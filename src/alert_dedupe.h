@@ -0,0 +1,258 @@
+#ifndef ALERT_DEDUPE_H
+#define ALERT_DEDUPE_H
+
+/*
+ * ═══════════════════════════════════════════════════════════════════════
+ * BLACKROAD ALERT DEDUPE - hashed, time-windowed duplicate suppression
+ * ═══════════════════════════════════════════════════════════════════════
+ *
+ * The pager used to keep the last 20 "SOURCE-PRIORITY-minute" IDs and
+ * compare each new one against all of them. Two copies of an alert on
+ * either side of a minute boundary both paged, and the 21st distinct
+ * alert pushed the oldest out of the history however recent it was.
+ *
+ * Each source + priority is now a 64-bit FNV-1a fingerprint in an
+ * open-addressed table (linear probing, at most DEDUPE_PROBE slots from
+ * its home slot). A slot holds the fingerprint and the time its window
+ * started. An alert is a duplicate when its fingerprint is in the table
+ * and the window is younger than the TTL:
+ *
+ *   FIXED   the window starts at the alert that paged; a storm that
+ *           keeps going pages again once per TTL (the old behaviour,
+ *           without the minute boundary)
+ *   EXTEND  every suppressed repeat restarts the window; the pager stays
+ *           quiet until the source has been silent for a whole TTL
+ *
+ * Slots are never emptied, so a lookup can stop at the first empty slot.
+ * An expired slot is reused in place. If every slot within reach holds
+ * a live ID, the oldest one is evicted. The table can only forget too
+ * early: a repeat of an evicted ID pages again, but a new alert is never
+ * suppressed.
+ *
+ * With PSRAM the table is DEDUPE_SLOTS_PSRAM x 16 B (32 KB). A board
+ * without it (esp32dev) gets DEDUPE_SLOTS_INTERNAL slots (8 KB) of
+ * internal RAM instead. Past 512 live IDs it evicts, and a repeat of an
+ * evicted ID pages again early.
+ * The table is used once per alert, not per frame. Without it every
+ * alert pages. Timestamps are millis(); once an hour a sweep pins
+ * long-expired slots so their age never wraps back into a window.
+ *
+ * DEDUPE shows the table and counters. The host runner's --alert-storm
+ * replays synthetic storms against a reference model.
+ */
+
+#include "fixed_string.h"
+#include "mem_placement.h"
+#include "timer_wheel.h"
+
+// ─────────────────────────────────────────────────────────────────────
+// CONFIGURATION
+// ─────────────────────────────────────────────────────────────────────
+
+#define DEDUPE_SLOTS_PSRAM    2048       // power of two
+#define DEDUPE_SLOTS_INTERNAL 512        // power of two, no PSRAM
+#define DEDUPE_PROBE          16         // slots searched from the home slot
+#define DEDUPE_TTL_DEFAULT_MS 60000UL
+#define DEDUPE_TTL_MAX_MS     86400000UL // DEDUPE TTL takes 1 s .. 1 day
+#define DEDUPE_SWEEP_MS       3600000UL
+
+static_assert((DEDUPE_SLOTS_PSRAM & (DEDUPE_SLOTS_PSRAM - 1)) == 0 &&
+              (DEDUPE_SLOTS_INTERNAL & (DEDUPE_SLOTS_INTERNAL - 1)) == 0, "dedupe slots must be a power of two");
+static_assert(DEDUPE_PROBE <= DEDUPE_SLOTS_INTERNAL, "probe window larger than the table");
+
+struct DedupeSlot {
+  uint64_t fp;             // 0 = never used
+  uint32_t windowMs;       // millis() the window started
+  uint32_t suppressed;     // repeats suppressed in this window
+};
+
+struct AlertDedupeStats {
+  uint32_t lookups;
+  uint32_t raised;
+  uint32_t suppressed;
+  uint32_t expired;        // same ID again after its TTL - raised
+  uint32_t evicted;        // live IDs pushed out by a full probe window
+  uint32_t probes;         // slots looked at, all lookups
+  uint8_t maxProbe;
+  uint32_t cycles;
+  uint32_t maxCycles;
+  uint32_t loudest;        // most repeats suppressed in one window
+};
+
+DedupeSlot* dedupeTable = nullptr;   // MEM_COLD, alertDedupeAlloc()
+uint32_t dedupeSlots = 0;            // power of two while dedupeTable is set
+uint32_t dedupeTtlMs = DEDUPE_TTL_DEFAULT_MS;
+bool dedupeExtend = false;
+AlertDedupeStats dedupeStats;
+
+// ─────────────────────────────────────────────────────────────────────
+// TABLE
+// ─────────────────────────────────────────────────────────────────────
+
+// FNV-1a 64 over source, a separator, priority. Case-sensitive, as the
+// old string compare was. Never 0 - that marks an empty slot
+uint64_t alertFingerprint(StrView source, StrView priority) {
+  uint64_t h = 14695981039346656037ULL;
+  for (size_t i = 0; i < source.length(); i++) h = (h ^ (uint8_t)source[i]) * 1099511628211ULL;
+  h = (h ^ 0x1F) * 1099511628211ULL;
+  for (size_t i = 0; i < priority.length(); i++) h = (h ^ (uint8_t)priority[i]) * 1099511628211ULL;
+  return h ? h : 1;
+}
+
+inline uint32_t dedupeHome(uint64_t fp) {
+  return (uint32_t)(fp ^ (fp >> 29)) & (dedupeSlots - 1);
+}
+
+// true = duplicate, do not page. Otherwise the alert's window starts at nowMs
+bool alertDedupeCheck(uint64_t fp, uint32_t nowMs) {
+  dedupeStats.lookups++;
+  if (!dedupeTable) {
+    dedupeStats.raised++;
+    return false;
+  }
+  uint32_t c0 = ESP.getCycleCount();
+  int reuse = -1, oldest = -1;
+  uint32_t oldestAge = 0;
+  bool duplicate = false, found = false;
+  uint32_t i = dedupeHome(fp);
+  uint8_t probe = 0;
+  while (probe < DEDUPE_PROBE) {
+    DedupeSlot& s = dedupeTable[i];
+    probe++;
+    if (!s.fp) {
+      if (reuse < 0) reuse = i;
+      break;
+    }
+    uint32_t age = nowMs - s.windowMs;
+    if (s.fp == fp) {
+      found = true;
+      if (age < dedupeTtlMs) {
+        duplicate = true;
+        if (++s.suppressed > dedupeStats.loudest) dedupeStats.loudest = s.suppressed;
+        if (dedupeExtend) s.windowMs = nowMs;
+      } else {
+        dedupeStats.expired++;
+        s.windowMs = nowMs;
+        s.suppressed = 0;
+      }
+      break;
+    }
+    if (age >= dedupeTtlMs) {
+      if (reuse < 0) reuse = i;
+    } else if (age >= oldestAge) {
+      oldestAge = age;
+      oldest = i;
+    }
+    i = (i + 1) & (dedupeSlots - 1);
+  }
+
+  if (!found) {
+    if (reuse < 0) {
+      reuse = oldest;
+      dedupeStats.evicted++;
+    }
+    DedupeSlot& s = dedupeTable[reuse];
+    s.fp = fp;
+    s.windowMs = nowMs;
+    s.suppressed = 0;
+  }
+
+  uint32_t cycles = ESP.getCycleCount() - c0;
+  dedupeStats.cycles += cycles;
+  if (cycles > dedupeStats.maxCycles) dedupeStats.maxCycles = cycles;
+  dedupeStats.probes += probe;
+  if (probe > dedupeStats.maxProbe) dedupeStats.maxProbe = probe;
+  if (duplicate) dedupeStats.suppressed++;
+  else dedupeStats.raised++;
+  return duplicate;
+}
+
+bool isDuplicateAlertAt(StrView source, StrView priority, uint32_t nowMs) {
+  return alertDedupeCheck(alertFingerprint(source, priority), nowMs);
+}
+
+bool isDuplicateAlert(StrView source, StrView priority) {
+  return isDuplicateAlertAt(source, priority, millis());
+}
+
+// Every ID pages again on its next alert
+void alertDedupeClear() {
+  if (dedupeTable) memset(dedupeTable, 0, sizeof(DedupeSlot) * dedupeSlots);
+}
+
+void alertDedupeSetTtl(uint32_t ttlMs, bool extend) {
+  dedupeTtlMs = ttlMs;
+  dedupeExtend = extend;
+}
+
+// millis() wraps after 49.7 days; an ID silent that long must not look
+// fresh again. Pinned slots stay expired under any TTL up to the max
+void alertDedupeSweep(int) {
+  if (!dedupeTable) return;
+  uint32_t now = millis();
+  for (uint32_t i = 0; i < dedupeSlots; i++) {
+    DedupeSlot& s = dedupeTable[i];
+    if (s.fp && now - s.windowMs > DEDUPE_TTL_MAX_MS) s.windowMs = now - DEDUPE_TTL_MAX_MS;
+  }
+}
+
+// Replaces the table with an empty one of `slots` (power of two)
+bool alertDedupeAlloc(uint32_t slots) {
+  memFree(dedupeTable, sizeof(DedupeSlot) * dedupeSlots, MEM_ALERT_DEDUPE);
+  dedupeTable = (DedupeSlot*)memAlloc(sizeof(DedupeSlot) * slots, MEM_COLD, MEM_ALERT_DEDUPE);
+  dedupeSlots = dedupeTable ? slots : 0;
+  alertDedupeClear();
+  return dedupeTable != nullptr;
+}
+
+bool initAlertDedupe() {
+  // The full table only where it lands in PSRAM, not as an internal fallback
+  bool big = psramFound() && alertDedupeAlloc(DEDUPE_SLOTS_PSRAM) && memInPsram(dedupeTable);
+  if (!big && !alertDedupeAlloc(DEDUPE_SLOTS_INTERNAL)) return false;
+  timerEvery(DEDUPE_SWEEP_MS, alertDedupeSweep, "dedupe sweep");
+  return true;
+}
+
+// ─────────────────────────────────────────────────────────────────────
+// REPORT
+// ─────────────────────────────────────────────────────────────────────
+
+void resetAlertDedupeStats() {
+  memset(&dedupeStats, 0, sizeof(dedupeStats));
+}
+
+void printAlertDedupeReport() {
+  const AlertDedupeStats& s = dedupeStats;
+  uint32_t live = 0, stale = 0;
+  if (dedupeTable) {
+    uint32_t now = millis();
+    for (uint32_t i = 0; i < dedupeSlots; i++) {
+      if (!dedupeTable[i].fp) continue;
+      if (now - dedupeTable[i].windowMs < dedupeTtlMs) live++;
+      else stale++;
+    }
+  }
+  Serial.println("\n━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━");
+  Serial.println("   ALERT DEDUPE");
+  Serial.println("━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━");
+  if (dedupeTable) {
+    Serial.printf("   %-14s%u slots x %u B in %s, probe limit %u\n", "Table:", dedupeSlots,
+                  (unsigned)sizeof(DedupeSlot), memInPsram(dedupeTable) ? "PSRAM" : "internal", DEDUPE_PROBE);
+  } else {
+    Serial.printf("   %-14snot allocated - every alert pages\n", "Table:");
+  }
+  Serial.printf("   %-14s%lu s, %s\n", "Window:", (unsigned long)(dedupeTtlMs / 1000),
+                dedupeExtend ? "EXTEND (repeats restart it)" : "FIXED (from the alert that paged)");
+  Serial.printf("   %-14s%u live, %u expired, %u never used\n", "IDs:",
+                live, stale, dedupeSlots - live - stale);
+  Serial.printf("   %-14s%u: %u paged (%u after TTL), %u suppressed, most %u for one ID\n", "Alerts:",
+                s.lookups, s.raised, s.expired, s.suppressed, s.loudest);
+  Serial.printf("   %-14s%u live IDs pushed out (could page twice)\n", "Evicted:", s.evicted);
+  Serial.printf("   %-14savg %u.%u, max %u slots\n", "Probes:",
+                s.lookups ? s.probes / s.lookups : 0, s.lookups ? (unsigned)((uint64_t)s.probes * 10 / s.lookups % 10) : 0, s.maxProbe);
+  Serial.printf("   %-14savg %u, max %u cycles\n", "Lookup:",
+                s.lookups ? s.cycles / s.lookups : 0, s.maxCycles);
+  Serial.println("━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━\n");
+}
+
+#endif // ALERT_DEDUPE_H
@@ -4,6 +4,9 @@
 #include <HTTPClient.h>
 #include <WiFiClient.h>
 #include "secrets.h"
+#include "fixed_string.h"
+#include "heap_trace.h"
+#include "mem_placement.h"
 
 /*
  * ═══════════════════════════════════════════════════════════════════════
@@ -65,15 +68,29 @@ struct InfraAlert {
 // ALERT HISTORY
 // ─────────────────────────────────────────────────────────────────────
 
-InfraAlert infraAlertHistory[10];
+#define INFRA_ALERT_LOG_SIZE 10
+
+InfraAlert* infraAlertHistory = nullptr;   // MEM_COLD, initAlertLog()
+static_assert(sizeof(InfraAlert) <= 216, "InfraAlert grew - the alert log holds INFRA_ALERT_LOG_SIZE");
 int infraAlertHistoryCount = 0;
-unsigned long lastAlertTime[10] = {0};  // Cooldown tracker
+int8_t alertCooldown[10] = { -1, -1, -1, -1, -1, -1, -1, -1, -1, -1 };  // timer per type, -1 = may fire
+
+// Written once per alert, read by getInfraAlert() - no reason to hold
+// internal RAM. Without it alerts still fire, they just are not logged.
+bool initAlertLog() {
+  infraAlertHistory = (InfraAlert*)memAlloc(sizeof(InfraAlert) * INFRA_ALERT_LOG_SIZE, MEM_COLD, MEM_ALERT_LOG);
+  return infraAlertHistory != nullptr;
+}
+
+void alertCooldownDone(int type) {
+  alertCooldown[type] = -1;
+}
 
 // ─────────────────────────────────────────────────────────────────────
 // DISCORD WEBHOOK INTEGRATION
 // ─────────────────────────────────────────────────────────────────────
 
-bool sendDiscordAlert(String title, String message, AlertLevel level) {
+bool sendDiscordAlert(const char* title, const char* message, AlertLevel level) {
   #ifdef DISCORD_WEBHOOK_URL
   HTTPClient http;
   WiFiClient client;
@@ -87,16 +104,18 @@ bool sendDiscordAlert(String title, String message, AlertLevel level) {
   if (level == ALERT_WARNING) color = 0xFFA500;   // Amber
   if (level == ALERT_CRITICAL) color = 0xFF0000;  // Red
 
-  // Build Discord embed
-  String payload = "{\"embeds\":[{";
-  payload += "\"title\":\"" + title + "\",";
-  payload += "\"description\":\"" + message + "\",";
-  payload += "\"color\":" + String(color) + ",";
-  payload += "\"footer\":{\"text\":\"BlackRoad CEO Hub\"},";
-  payload += "\"timestamp\":\"" + String(millis()) + "\"";
-  payload += "}]}";
-
-  int httpCode = http.POST(payload);
+  // Build Discord embed (title 64 + message 128 + framing fits)
+  FixedString<384> payload;
+  payload.format("{\"embeds\":[{"
+                 "\"title\":\"%s\","
+                 "\"description\":\"%s\","
+                 "\"color\":%d,"
+                 "\"footer\":{\"text\":\"BlackRoad CEO Hub\"},"
+                 "\"timestamp\":\"%lu\""
+                 "}]}",
+                 title, message, color, (unsigned long)millis());
+
+  int httpCode = http.POST((uint8_t*)payload.c_str(), payload.length());
   bool success = (httpCode == 200 || httpCode == 204);
 
   http.end();
@@ -110,7 +129,7 @@ bool sendDiscordAlert(String title, String message, AlertLevel level) {
 // SLACK WEBHOOK INTEGRATION
 // ─────────────────────────────────────────────────────────────────────
 
-bool sendSlackAlert(String title, String message, AlertLevel level) {
+bool sendSlackAlert(const char* title, const char* message, AlertLevel level) {
   #ifdef SLACK_WEBHOOK_URL
   HTTPClient http;
   WiFiClient client;
@@ -120,19 +139,21 @@ bool sendSlackAlert(String title, String message, AlertLevel level) {
   http.setTimeout(5000);
 
   // Emoji based on level
-  String emoji = ":information_source:";
+  const char* emoji = ":information_source:";
   if (level == ALERT_WARNING) emoji = ":warning:";
   if (level == ALERT_CRITICAL) emoji = ":rotating_light:";
 
-  String payload = "{";
-  payload += "\"text\":\"" + emoji + " *" + title + "*\",";
-  payload += "\"blocks\":[{";
-  payload += "\"type\":\"section\",";
-  payload += "\"text\":{\"type\":\"mrkdwn\",\"text\":\"" + message + "\"}";
-  payload += "}]";
-  payload += "}";
-
-  int httpCode = http.POST(payload);
+  FixedString<384> payload;
+  payload.format("{"
+                 "\"text\":\"%s *%s*\","
+                 "\"blocks\":[{"
+                 "\"type\":\"section\","
+                 "\"text\":{\"type\":\"mrkdwn\",\"text\":\"%s\"}"
+                 "}]"
+                 "}",
+                 emoji, title, message);
+
+  int httpCode = http.POST((uint8_t*)payload.c_str(), payload.length());
   bool success = (httpCode == 200);
 
   http.end();
@@ -146,79 +167,57 @@ bool sendSlackAlert(String title, String message, AlertLevel level) {
 // LOCAL ALERT (BUZZER + LED)
 // ─────────────────────────────────────────────────────────────────────
 
+// Queued on the feedback sequencer (feedback.h) - returns at once
 void triggerLocalAlert(AlertLevel level) {
-  #ifdef BUZZER_PIN
-    if (level == ALERT_CRITICAL) {
-      // Critical: 3 long beeps
-      for (int i = 0; i < 3; i++) {
-        digitalWrite(BUZZER_PIN, HIGH);
-        delay(500);
-        digitalWrite(BUZZER_PIN, LOW);
-        delay(200);
-      }
-    } else if (level == ALERT_WARNING) {
-      // Warning: 2 short beeps
-      for (int i = 0; i < 2; i++) {
-        digitalWrite(BUZZER_PIN, HIGH);
-        delay(200);
-        digitalWrite(BUZZER_PIN, LOW);
-        delay(100);
-      }
-    }
-  #endif
-
-  #ifdef LED_PIN
-    // Flash LED
-    for (int i = 0; i < 5; i++) {
-      digitalWrite(LED_PIN, HIGH);
-      delay(100);
-      digitalWrite(LED_PIN, LOW);
-      delay(100);
-    }
-  #endif
+  if (level == ALERT_CRITICAL) {
+    feedbackPlay(FB_LOCAL_CRITICAL);   // 3 long beeps
+  } else if (level == ALERT_WARNING) {
+    feedbackPlay(FB_LOCAL_WARNING);    // 2 short beeps
+  }
+  feedbackPlay(FB_LOCAL_FLASH);        // 5 LED flashes
 }
 
 // ─────────────────────────────────────────────────────────────────────
 // ALERT DISPATCHER
 // ─────────────────────────────────────────────────────────────────────
 
-void sendAlert(AlertType type, AlertLevel level, String title, String message) {
+bool netPostAlert(const char* title, const char* message, AlertLevel level);  // app_tasks.h
+
+void sendAlert(AlertType type, AlertLevel level, const char* title, const char* message) {
   // Check cooldown
-  if (millis() - lastAlertTime[type] < ALERT_COOLDOWN_MS) {
+  if (alertCooldown[type] >= 0) {
     return;  // Too soon since last alert of this type
   }
+  HeapTag tag(HEAP_TAG_ALERTS);
 
-  Serial.println("\n🚨 ALERT: " + title);
-  Serial.println("   " + message);
+  Serial.printf("\n🚨 ALERT: %s\n", title);
+  Serial.printf("   %s\n", message);
 
   // Store in history
-  if (infraAlertHistoryCount < 10) {
+  if (infraAlertHistory && infraAlertHistoryCount < INFRA_ALERT_LOG_SIZE) {
     infraAlertHistory[infraAlertHistoryCount].type = type;
     infraAlertHistory[infraAlertHistoryCount].level = level;
-    strncpy(infraAlertHistory[infraAlertHistoryCount].title, title.c_str(), 63);
-    infraAlertHistory[infraAlertHistoryCount].title[63] = '\0';
-    strncpy(infraAlertHistory[infraAlertHistoryCount].message, message.c_str(), 127);
-    infraAlertHistory[infraAlertHistoryCount].message[127] = '\0';
+    strlcpy(infraAlertHistory[infraAlertHistoryCount].title, title, sizeof(infraAlertHistory[0].title));
+    strlcpy(infraAlertHistory[infraAlertHistoryCount].message, message, sizeof(infraAlertHistory[0].message));
     infraAlertHistory[infraAlertHistoryCount].timestamp = millis();
     infraAlertHistory[infraAlertHistoryCount].sent = false;
     infraAlertHistoryCount++;
   }
 
-  // Send to external services
-  bool discordSent = sendDiscordAlert(title, message, level);
-  bool slackSent = sendSlackAlert(title, message, level);
-
-  if (discordSent) Serial.println("   ✓ Discord notification sent");
-  if (slackSent) Serial.println("   ✓ Slack notification sent");
+  // Send to external services - the webhooks block on HTTP, so the
+  // network task posts them (app_tasks.h)
+  if (!netPostAlert(title, message, level)) {
+    Serial.println("   ⚠️  Network queue full, webhooks skipped");
+  }
 
   // Trigger local alert
   triggerLocalAlert(level);
 
-  // Update cooldown
-  lastAlertTime[type] = millis();
+  // Update cooldown (timer wheel clears it)
+  alertCooldown[type] = timerAfter(ALERT_COOLDOWN_MS, alertCooldownDone, "alert cooldown", type);
 
   // Mark as sent
-  if (infraAlertHistoryCount > 0) {
+  if (infraAlertHistory && infraAlertHistoryCount > 0) {
     infraAlertHistory[infraAlertHistoryCount - 1].sent = true;
   }
 }
@@ -229,15 +228,15 @@ void sendAlert(AlertType type, AlertLevel level, String title, String message) {
 
 void checkHotLeadsAlert() {
   if (navState.crmHealthy && crmMetrics.hotLeads > ALERT_HOT_LEADS_THRESHOLD) {
-    String message = String(crmMetrics.hotLeads) + " hot leads detected! ";
-    message += "Pipeline value: $" + String(crmMetrics.pipelineValue / 1000) + "K. ";
-    message += "Action required: Follow up on top leads.";
+    FixedString<128> message;
+    message.format("%d hot leads detected! Pipeline value: $%.2fK. Action required: Follow up on top leads.",
+                   crmMetrics.hotLeads, crmMetrics.pipelineValue / 1000);
 
     sendAlert(
       ALERT_HOT_LEADS,
       ALERT_WARNING,
       "🔥 Hot Leads Threshold Exceeded",
-      message
+      message.c_str()
     );
   }
 }
@@ -246,37 +245,38 @@ void checkSovereigntyAlert() {
   SovereigntyMetrics metrics = getSovereigntyMetrics();
 
   if (metrics.sovereigntyScore < ALERT_SOVEREIGNTY_THRESHOLD) {
-    String message = "Sovereignty score dropped to " + String((int)metrics.sovereigntyScore) + "%. ";
-    message += "Status: " + getSovereigntyStatus() + ". ";
-    message += String(metrics.totalComponents - metrics.sovereignComponents) + " external dependencies detected.";
+    FixedString<128> message;
+    message.format("Sovereignty score dropped to %d%%. Status: %s. %d external dependencies detected.",
+                   (int)metrics.sovereigntyScore, getSovereigntyStatus(),
+                   metrics.totalComponents - metrics.sovereignComponents);
 
     sendAlert(
       ALERT_SOVEREIGNTY,
       ALERT_CRITICAL,
       "⚠️ Sovereignty Score Critical",
-      message
+      message.c_str()
     );
   }
 }
 
 void checkMeshAlert() {
   if (navState.meshHealthy && navState.activeNodes < ALERT_MESH_NODES_THRESHOLD) {
-    String message = "Only " + String(navState.activeNodes) + " mesh nodes active. ";
-    message += "Expected: 4 nodes (lucidia, octavia, alice, shellfish). ";
-    message += "Network redundancy compromised.";
+    FixedString<128> message;
+    message.format("Only %d mesh nodes active. Expected: 4 nodes (lucidia, octavia, alice, shellfish). "
+                   "Network redundancy compromised.", navState.activeNodes);
 
     sendAlert(
       ALERT_MESH_DOWN,
       ALERT_CRITICAL,
       "🌐 Mesh Network Degraded",
-      message
+      message.c_str()
     );
   }
 }
 
 void checkSystemHealthAlert() {
   int downCount = 0;
-  String downSystems = "";
+  FixedString<64> downSystems;
 
   if (!navState.meshHealthy) {
     downCount++;
@@ -292,31 +292,30 @@ void checkSystemHealthAlert() {
   }
 
   if (downCount >= 2) {
-    downSystems = downSystems.substring(0, downSystems.length() - 2);  // Remove trailing comma
-    String message = String(downCount) + " critical systems offline: " + downSystems + ". ";
-    message += "Infrastructure health degraded. Check system logs.";
+    FixedString<128> message;
+    message.format("%d critical systems offline: %.*s. Infrastructure health degraded. Check system logs.",
+                   downCount, (int)downSystems.length() - 2, downSystems.c_str());  // drop trailing comma
 
     sendAlert(
       ALERT_AI_DOWN,  // Reuse alert type
       ALERT_CRITICAL,
       "🚨 Multiple Systems Offline",
-      message
+      message.c_str()
     );
   }
 }
 
 void checkPipelineMilestoneAlert() {
   if (navState.crmHealthy && crmMetrics.pipelineValue >= 1000000) {  // $1M
-    String message = "Pipeline value: $" + String(crmMetrics.pipelineValue / 1000) + "K! ";
-    message += String(crmMetrics.openDeals) + " open deals, ";
-    message += String(crmMetrics.hotLeads) + " hot leads. ";
-    message += "Milestone achievement unlocked! 🎉";
+    FixedString<128> message;
+    message.format("Pipeline value: $%.2fK! %d open deals, %d hot leads. Milestone achievement unlocked! 🎉",
+                   crmMetrics.pipelineValue / 1000, crmMetrics.openDeals, crmMetrics.hotLeads);
 
     sendAlert(
       ALERT_PIPELINE_MILESTONE,
       ALERT_INFO,
       "🎯 Pipeline Milestone Reached",
-      message
+      message.c_str()
     );
   }
 }
@@ -329,6 +328,7 @@ void checkAllAlerts() {
   if (WiFi.status() != WL_CONNECTED) {
     return;  // Don't alert if offline
   }
+  HeapTag tag(HEAP_TAG_ALERTS);
 
   Serial.println("\n🔍 Checking alert conditions...");
 
@@ -366,11 +366,12 @@ InfraAlert getInfraAlert(int index) {
 void clearInfraAlertHistory() {
   infraAlertHistoryCount = 0;
   for (int i = 0; i < 10; i++) {
-    lastAlertTime[i] = 0;
+    timerCancel(alertCooldown[i]);
+    alertCooldown[i] = -1;
   }
 }
 
-String getAlertLevelString(AlertLevel level) {
+const char* getAlertLevelString(AlertLevel level) {
   switch (level) {
     case ALERT_INFO: return "INFO";
     case ALERT_WARNING: return "WARNING";
@@ -0,0 +1,275 @@
+#ifndef ANIMATION_H
+#define ANIMATION_H
+
+/*
+ * ═══════════════════════════════════════════════════════════════════════
+ * BLACKROAD FRAME-PACED ANIMATION SCHEDULER
+ * ═══════════════════════════════════════════════════════════════════════
+ *
+ * Drives the premium_ui / BlackRoadUI effects (pulsing glow, touch ripple)
+ * on a fixed frame clock instead of loop() speed:
+ *
+ * - Target frame rate with a per-frame CPU budget
+ * - Late frames are dropped, never replayed in a burst
+ * - Touch or serial input pending → the frame yields to loop()
+ * - Each animation owns a damage rect that is restored before redraw
+ * - Animations belong to a screen and die when that screen is left
+ *
+ * animTick() is called once per loop() after touch/serial handling and
+ * costs a single compare when nothing is animating.
+ */
+
+// ─────────────────────────────────────────────────────────────────────
+// CONFIGURATION
+// ─────────────────────────────────────────────────────────────────────
+
+#define ANIM_TARGET_FPS       30
+#define ANIM_FRAME_US         (1000000UL / ANIM_TARGET_FPS)
+#define ANIM_FRAME_BUDGET_US  (ANIM_FRAME_US / 3)  // leave 2/3 of each frame to input + network
+#define ANIM_MAX_ACTIVE       6
+#define ANIM_RIPPLE_RADIUS    30
+
+// Provided by main.cpp - true while touch or serial input is waiting
+bool animInputPending();
+
+// ─────────────────────────────────────────────────────────────────────
+// ANIMATION SLOTS
+// ─────────────────────────────────────────────────────────────────────
+
+struct AnimRect {
+  int16_t x, y, w, h;
+};
+
+struct Animation;
+typedef void (*AnimRenderFn)(Animation& anim, float progress, unsigned long elapsedMs);
+typedef void (*AnimRestoreFn)(const AnimRect& rect);
+
+struct Animation {
+  bool active;
+  int screen;                // owning screen
+  unsigned long startMs;
+  unsigned long durationMs;  // 0 = loops until cancelled
+  AnimRect damage;           // everything render() may touch
+  AnimRenderFn render;
+  AnimRestoreFn restore;     // repaints what is under damage (nullptr = fill with bg)
+  uint16_t color;
+  uint16_t bg;
+  int16_t cx, cy, radius;
+};
+
+Animation animations[ANIM_MAX_ACTIVE];
+int animActiveCount = 0;
+int animRoundRobin = 0;
+unsigned long animNextFrameUs = 0;
+
+// ─────────────────────────────────────────────────────────────────────
+// INSTRUMENTATION
+// ─────────────────────────────────────────────────────────────────────
+
+struct AnimStats {
+  unsigned long windowStartUs;
+  unsigned long lastFrameUs;
+  uint32_t frames;          // frames rendered
+  uint32_t dropped;         // frame slots skipped because we were late
+  uint32_t yielded;         // frames postponed for pending input
+  uint32_t deferred;        // animations skipped when over budget
+  uint32_t busyUs;          // time spent rendering
+  uint32_t maxFrameUs;
+  uint32_t jitterSumUs;     // frame start lateness vs deadline
+  uint32_t maxJitterUs;
+  uint32_t damagePixels;
+};
+
+AnimStats animStats;
+
+void resetAnimStats() {
+  memset(&animStats, 0, sizeof(animStats));
+  animStats.windowStartUs = micros();
+}
+
+// ─────────────────────────────────────────────────────────────────────
+// SCHEDULER
+// ─────────────────────────────────────────────────────────────────────
+
+void animRestore(const Animation& a) {
+  if (a.restore) {
+    a.restore(a.damage);
+  } else {
+    tft.fillRect(a.damage.x, a.damage.y, a.damage.w, a.damage.h, a.bg);
+  }
+}
+
+void animStop(int slot) {
+  if (slot < 0 || slot >= ANIM_MAX_ACTIVE || !animations[slot].active) return;
+  animations[slot].active = false;
+  animActiveCount--;
+}
+
+void animStopAll() {
+  for (int i = 0; i < ANIM_MAX_ACTIVE; i++) animStop(i);
+}
+
+// Returns the slot index, or -1 when all slots are busy
+int animStart(const Animation& proto) {
+  for (int i = 0; i < ANIM_MAX_ACTIVE; i++) {
+    if (!animations[i].active) {
+      animations[i] = proto;
+      animations[i].active = true;
+      animations[i].startMs = millis();
+      if (animActiveCount++ == 0) {
+        animNextFrameUs = micros();  // first frame right away
+      }
+      return i;
+    }
+  }
+  return -1;
+}
+
+// Next frame slot while anything is animating
+bool animDeadline(uint32_t& dueUs) {
+  if (animActiveCount == 0) return false;
+  dueUs = animNextFrameUs;
+  return true;
+}
+
+void animTick(int screen) {
+  if (animActiveCount == 0) return;
+
+  unsigned long now = micros();
+  if ((long)(now - animNextFrameUs) < 0) return;
+
+  // Input always wins - try again on the next loop() pass
+  if (animInputPending()) {
+    animStats.yielded++;
+    return;
+  }
+
+  // Drop missed frame slots instead of catching up
+  unsigned long late = now - animNextFrameUs;
+  unsigned long missed = late / ANIM_FRAME_US;
+  animStats.dropped += missed;
+  animNextFrameUs += (missed + 1) * ANIM_FRAME_US;
+
+  uint32_t jitter = late % ANIM_FRAME_US;
+  animStats.jitterSumUs += jitter;
+  if (jitter > animStats.maxJitterUs) animStats.maxJitterUs = jitter;
+
+  unsigned long nowMs = millis();
+  for (int n = 0; n < ANIM_MAX_ACTIVE; n++) {
+    int i = (animRoundRobin + n) % ANIM_MAX_ACTIVE;
+    Animation& a = animations[i];
+    if (!a.active) continue;
+
+    // Screen changed underneath us - it has already been redrawn
+    if (a.screen != screen) {
+      animStop(i);
+      continue;
+    }
+
+    if (micros() - now > ANIM_FRAME_BUDGET_US) {
+      animStats.deferred++;
+      continue;
+    }
+
+    unsigned long elapsed = nowMs - a.startMs;
+    animRestore(a);
+    animStats.damagePixels += (uint32_t)a.damage.w * a.damage.h;
+
+    if (a.durationMs && elapsed >= a.durationMs) {
+      animStop(i);
+      continue;
+    }
+
+    float progress = a.durationMs ? (float)elapsed / a.durationMs : 0.0;
+    a.render(a, progress, elapsed);
+  }
+  animRoundRobin = (animRoundRobin + 1) % ANIM_MAX_ACTIVE;
+
+  uint32_t frameUs = micros() - now;
+  animStats.busyUs += frameUs;
+  if (frameUs > animStats.maxFrameUs) animStats.maxFrameUs = frameUs;
+  animStats.frames++;
+  animStats.lastFrameUs = now;
+}
+
+// ─────────────────────────────────────────────────────────────────────
+// BUILT-IN EFFECTS
+// ─────────────────────────────────────────────────────────────────────
+
+void renderPulseGlow(Animation& a, float, unsigned long elapsedMs) {
+  drawPulsingGlow(tft, a.cx, a.cy, a.radius, a.color, elapsedMs);
+}
+
+void renderRipple(Animation& a, float progress, unsigned long) {
+  int r = (int)(ui.easeOutCubic(progress) * a.radius);
+  if (r < 2) return;
+  tft.drawCircle(a.cx, a.cy, r, a.color);
+  tft.drawCircle(a.cx, a.cy, r - 1, a.color);
+}
+
+// Looping glow around (cx, cy) until the screen changes
+int animStartPulse(int screen, int cx, int cy, int radius, uint16_t color, uint16_t bg) {
+  // drawPulsingGlow reaches 1.1x radius plus three 3px rings
+  int extent = radius + radius / 10 + 10;
+  Animation a = {};
+  a.screen = screen;
+  a.durationMs = 0;
+  a.damage = {(int16_t)(cx - extent), (int16_t)(cy - extent),
+              (int16_t)(extent * 2 + 1), (int16_t)(extent * 2 + 1)};
+  a.render = renderPulseGlow;
+  a.color = color;
+  a.bg = bg;
+  a.cx = cx;
+  a.cy = cy;
+  a.radius = radius;
+  return animStart(a);
+}
+
+// One-shot touch ripple; restore repaints whatever the ripple covered
+int animStartRipple(int screen, int x, int y, uint16_t color, AnimRestoreFn restore) {
+  int extent = ANIM_RIPPLE_RADIUS + 1;
+  Animation a = {};
+  a.screen = screen;
+  a.durationMs = ANIM_MEDIUM;
+  a.damage = {(int16_t)(x - extent), (int16_t)(y - extent),
+              (int16_t)(extent * 2 + 1), (int16_t)(extent * 2 + 1)};
+  a.render = renderRipple;
+  a.restore = restore;
+  a.color = color;
+  a.cx = x;
+  a.cy = y;
+  a.radius = ANIM_RIPPLE_RADIUS;
+  return animStart(a);
+}
+
+// ─────────────────────────────────────────────────────────────────────
+// REPORT
+// ─────────────────────────────────────────────────────────────────────
+
+void printAnimationReport() {
+  unsigned long windowUs = micros() - animStats.windowStartUs;
+  float windowSec = windowUs / 1000000.0;
+  float fps = windowSec > 0 ? animStats.frames / windowSec : 0;
+  float cpuShare = windowUs > 0 ? animStats.busyUs * 100.0 / windowUs : 0;
+  uint32_t avgFrame = animStats.frames ? animStats.busyUs / animStats.frames : 0;
+  uint32_t avgJitter = animStats.frames ? animStats.jitterSumUs / animStats.frames : 0;
+
+  Serial.println("\n━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━");
+  Serial.println("   ANIMATION SCHEDULER");
+  Serial.println("━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━");
+  Serial.printf("   Active:       %d / %d\n", animActiveCount, ANIM_MAX_ACTIVE);
+  Serial.printf("   Window:       %.1f s\n", windowSec);
+  Serial.printf("   FPS:          %.1f (target %d)\n", fps, ANIM_TARGET_FPS);
+  Serial.printf("   Frames:       %u rendered, %u dropped\n", animStats.frames, animStats.dropped);
+  Serial.printf("   Yielded:      %u (input pending)\n", animStats.yielded);
+  Serial.printf("   Deferred:     %u (over %lu us budget)\n", animStats.deferred, ANIM_FRAME_BUDGET_US);
+  Serial.printf("   Frame time:   %u us avg, %u us max\n", avgFrame, animStats.maxFrameUs);
+  Serial.printf("   Jitter:       %u us avg, %u us max\n", avgJitter, animStats.maxJitterUs);
+  Serial.printf("   CPU share:    %.2f%%\n", cpuShare);
+  Serial.printf("   Damage:       %u px\n", animStats.damagePixels);
+  Serial.println("━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━\n");
+
+  resetAnimStats();
+}
+
+#endif // ANIMATION_H
@@ -62,7 +62,7 @@
 #define GITHUB_USER "BlackRoad-OS"
 
 // GitHub Organizations
-const char* GITHUB_ORGS[] = {
+const char* const GITHUB_ORGS[] = {
   "BlackRoad-AI",
   "BlackRoad-Archive",
   "BlackRoad-Cloud",
@@ -88,7 +88,7 @@ const char* GITHUB_ORGS[] = {
 #define RAILWAY_API "https://backboard.railway.app/graphql"
 
 // Railway project endpoints (update with real domains)
-const char* RAILWAY_PROJECTS[] = {
+const char* const RAILWAY_PROJECTS[] = {
   "project-1.railway.app",
   "project-2.railway.app",
   "project-3.railway.app"
@@ -161,7 +161,7 @@ struct APIEndpoint {
 };
 
 // Primary health check endpoints (UPDATED WITH REAL DISCOVERED SERVICES)
-const APIEndpoint HEALTH_CHECKS[] = {
+constexpr APIEndpoint HEALTH_CHECKS[] = {
   // Cloud APIs
   {"GitHub API", "https://api.github.com", "GET", false},
   {"Cloudflare API", "https://api.cloudflare.com/client/v4", "GET", true},
@@ -196,7 +196,7 @@ const APIEndpoint HEALTH_CHECKS[] = {
   // iPhone (not scanned)
   {"iPhone Koder", "http://192.168.4.68:8080", "GET", false}
 };
-#define HEALTH_CHECK_COUNT 16
+#define HEALTH_CHECK_COUNT ((int)(sizeof(HEALTH_CHECKS) / sizeof(HEALTH_CHECKS[0])))
 
 // ═══════════════════════════════════════════════════════════
 // REAL-TIME ENDPOINTS (WebSockets, SSE)
@@ -3,79 +3,70 @@
 
 #include <HTTPClient.h>
 #include "api_config.h"
+#include "json_arena.h"
 
 /*
  * API Health Check & Connection Functions
  * Real HTTP requests to production endpoints
  */
 
-struct APIStatus {
-  String name;
-  String url;
-  bool online;
-  int responseTime;  // milliseconds
-  int httpCode;
-  String lastError;
+enum APIState : uint8_t {
+  API_UNCHECKED,
+  API_ONLINE,
+  API_OFFLINE,          // httpCode < 0 is an HTTPClient error (errorToString)
+  API_AUTH_REQUIRED     // skipped until auth tokens are wired in
 };
 
-// Global API status array
-APIStatus apiStatuses[HEALTH_CHECK_COUNT];
+// Runtime state only - names, URLs and methods stay in HEALTH_CHECKS
+// (flash). One array per field, indexed like HEALTH_CHECKS.
+struct APIStatusTable {
+  APIState state[HEALTH_CHECK_COUNT];
+  int16_t httpCode[HEALTH_CHECK_COUNT];
+  uint16_t responseTime[HEALTH_CHECK_COUNT];  // milliseconds (5 s timeout)
+};
+
+// Global API status table
+APIStatusTable apiStatus;
 unsigned long lastHealthCheck = 0;
 #define HEALTH_CHECK_INTERVAL 60000  // Check every 60 seconds
 
 // Initialize API status tracking
 void initAPIStatus() {
-  for (int i = 0; i < HEALTH_CHECK_COUNT; i++) {
-    apiStatuses[i].name = String(HEALTH_CHECKS[i].name);
-    apiStatuses[i].url = String(HEALTH_CHECKS[i].url);
-    apiStatuses[i].online = false;
-    apiStatuses[i].responseTime = 0;
-    apiStatuses[i].httpCode = 0;
-    apiStatuses[i].lastError = "";
-  }
+  memset(&apiStatus, 0, sizeof(apiStatus));   // API_UNCHECKED
 }
 
-// Check single API endpoint
-APIStatus checkAPIEndpoint(const char* name, const char* url, const char* method) {
-  APIStatus status;
-  status.name = String(name);
-  status.url = String(url);
-  status.online = false;
-  status.responseTime = 0;
-  status.httpCode = 0;
-  status.lastError = "";
-
+// Check single API endpoint (HEALTH_CHECKS[i])
+void checkAPIEndpoint(int i) {
+  const APIEndpoint& api = HEALTH_CHECKS[i];
   HTTPClient http;
   unsigned long startTime = millis();
 
-  Serial.printf("🔍 Checking API: %s (%s)\n", name, url);
+  Serial.printf("🔍 Checking API: %s (%s)\n", api.name, api.url);
 
-  http.begin(url);
+  http.begin(api.url);
   http.setTimeout(5000);  // 5 second timeout
 
   int httpCode = -1;
-  if (strcmp(method, "GET") == 0) {
+  if (strcmp(api.method, "GET") == 0) {
     httpCode = http.GET();
-  } else if (strcmp(method, "POST") == 0) {
+  } else if (strcmp(api.method, "POST") == 0) {
     httpCode = http.POST("");
   }
 
   unsigned long responseTime = millis() - startTime;
 
-  status.responseTime = responseTime;
-  status.httpCode = httpCode;
+  apiStatus.responseTime[i] = responseTime > 0xFFFF ? 0xFFFF : responseTime;
+  apiStatus.httpCode[i] = httpCode;
 
   if (httpCode > 0) {
-    status.online = (httpCode >= 200 && httpCode < 400);
-    Serial.printf("   ✅ %s: %d (%dms)\n", name, httpCode, responseTime);
+    apiStatus.state[i] = (httpCode >= 200 && httpCode < 400) ? API_ONLINE : API_OFFLINE;
+    Serial.printf("   ✅ %s: %d (%lums)\n", api.name, httpCode, responseTime);
   } else {
-    status.online = false;
-    status.lastError = http.errorToString(httpCode);
-    Serial.printf("   ❌ %s: %s\n", name, status.lastError.c_str());
+    apiStatus.state[i] = API_OFFLINE;
+    Serial.printf("   ❌ %s: %s\n", api.name, http.errorToString(httpCode).c_str());
   }
 
   http.end();
-  return status;
 }
 
 // Check all API endpoints (health check)
@@ -87,20 +78,13 @@ void checkAllAPIs() {
     // Skip APIs that require auth for now (will add auth tokens later)
     if (HEALTH_CHECKS[i].requiresAuth) {
       Serial.printf("⏭  Skipping %s (requires auth)\n", HEALTH_CHECKS[i].name);
-      apiStatuses[i].name = String(HEALTH_CHECKS[i].name);
-      apiStatuses[i].url = String(HEALTH_CHECKS[i].url);
-      apiStatuses[i].online = false;
-      apiStatuses[i].responseTime = 0;
-      apiStatuses[i].httpCode = 0;
-      apiStatuses[i].lastError = "Auth required";
+      apiStatus.state[i] = API_AUTH_REQUIRED;
+      apiStatus.responseTime[i] = 0;
+      apiStatus.httpCode[i] = 0;
       continue;
     }
 
-    apiStatuses[i] = checkAPIEndpoint(
-      HEALTH_CHECKS[i].name,
-      HEALTH_CHECKS[i].url,
-      HEALTH_CHECKS[i].method
-    );
+    checkAPIEndpoint(i);
 
     delay(500);  // Rate limiting - don't hammer APIs
   }
@@ -108,7 +92,7 @@ void checkAllAPIs() {
   // Summary
   int onlineCount = 0;
   for (int i = 0; i < HEALTH_CHECK_COUNT; i++) {
-    if (apiStatuses[i].online) onlineCount++;
+    if (apiStatus.state[i] == API_ONLINE) onlineCount++;
   }
 
   Serial.println("━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━");
@@ -125,9 +109,9 @@ String getAPIStatusSummary() {
   int auth_required = 0;
 
   for (int i = 0; i < total; i++) {
-    if (apiStatuses[i].lastError == "Auth required") {
+    if (apiStatus.state[i] == API_AUTH_REQUIRED) {
       auth_required++;
-    } else if (apiStatuses[i].online) {
+    } else if (apiStatus.state[i] == API_ONLINE) {
       online++;
     } else {
       offline++;
@@ -308,7 +292,8 @@ bool fetchGitHubStats(const char* token, const char* username) {
   }
 
   // Parse JSON response
-  DynamicJsonDocument doc(16384);
+  JsonLease lease(JSON_GITHUB);
+  JsonDocument& doc = lease.doc;
   DeserializationError error = deserializeJson(doc, response.data);
 
   if (error) {
@@ -338,7 +323,8 @@ bool fetchGitHubStats(const char* token, const char* username) {
       APIResponse commitResponse = apiGet(commitUrl.c_str(), "Authorization", authValue.c_str());
 
       if (commitResponse.success) {
-        DynamicJsonDocument commitDoc(4096);
+        JsonLease commitLease(JSON_GITHUB_COMMIT);
+        JsonDocument& commitDoc = commitLease.doc;
         deserializeJson(commitDoc, commitResponse.data);
         JsonArray commits = commitDoc.as<JsonArray>();
 
@@ -407,7 +393,8 @@ bool fetchCryptoPrice() {
   APIResponse response = apiGet(url.c_str(), "", "");
 
   if (response.statusCode == 200) {
-    DynamicJsonDocument doc(2048);
+    JsonLease lease(JSON_CRYPTO);
+    JsonDocument& doc = lease.doc;
     DeserializationError error = deserializeJson(doc, response.data);
 
     if (error) {
@@ -480,7 +467,8 @@ bool fetchWeather(const char* apiKey, const char* city) {
     return false;
   }
 
-  DynamicJsonDocument doc(4096);
+  JsonLease lease(JSON_WEATHER);
+  JsonDocument& doc = lease.doc;
   DeserializationError error = deserializeJson(doc, response.data);
 
   if (error) {
@@ -544,7 +532,8 @@ bool fetchStripeMetrics(const char* apiKey) {
     return false;
   }
 
-  DynamicJsonDocument doc(8192);
+  JsonLease lease(JSON_STRIPE);
+  JsonDocument& doc = lease.doc;
   DeserializationError error = deserializeJson(doc, response.data);
 
   if (error) {
@@ -624,7 +613,8 @@ bool fetchLinearTasks(const char* apiKey, const char* userEmail) {
   String payload = http.getString();
   http.end();
 
-  DynamicJsonDocument doc(8192);
+  JsonLease lease(JSON_LINEAR);
+  JsonDocument& doc = lease.doc;
   DeserializationError error = deserializeJson(doc, payload);
 
   if (error) {
@@ -670,7 +660,11 @@ struct Customer {
   unsigned long lastContact;
 };
 
-Customer customers[50];  // Support up to 50 customers
+#define CRM_MAX_CUSTOMERS 50
+
+// ~18 KB, touched only by load/save/add - MEM_COLD (PSRAM when fitted)
+Customer* customers = nullptr;
+static_assert(sizeof(Customer) * CRM_MAX_CUSTOMERS <= 19 * 1024, "CRM customer table grew past 19 KB");
 int customerCount = 0;
 
 // Initialize SPIFFS
@@ -679,19 +673,29 @@ bool initCRMStorage() {
     Serial.println("❌ SPIFFS mount failed");
     return false;
   }
+  if (!customers) {
+    customers = (Customer*)memAlloc(sizeof(Customer) * CRM_MAX_CUSTOMERS, MEM_COLD, MEM_CRM);
+    if (!customers) {
+      Serial.println("❌ CRM: no memory for the customer table");
+      return false;
+    }
+    memset(customers, 0, sizeof(Customer) * CRM_MAX_CUSTOMERS);   // addCustomer() leaves phone empty
+  }
   Serial.println("✅ SPIFFS mounted successfully");
   return true;
 }
 
 // Save CRM data to SPIFFS
 bool saveCRMData() {
+  if (!customers) return false;
   File file = SPIFFS.open("/crm_data.json", "w");
   if (!file) {
     Serial.println("❌ Failed to open CRM file for writing");
     return false;
   }
 
-  DynamicJsonDocument doc(32768);
+  JsonLease lease(JSON_CRM_FILE);
+  JsonDocument& doc = lease.doc;
   JsonArray array = doc.to<JsonArray>();
 
   for (int i = 0; i < customerCount; i++) {
@@ -715,13 +719,15 @@ bool saveCRMData() {
 
 // Load CRM data from SPIFFS
 bool loadCRMData() {
+  if (!customers) return false;
   File file = SPIFFS.open("/crm_data.json", "r");
   if (!file) {
     Serial.println("⚠️  CRM file not found, starting fresh");
     return false;
   }
 
-  DynamicJsonDocument doc(32768);
+  JsonLease lease(JSON_CRM_FILE);
+  JsonDocument& doc = lease.doc;
   DeserializationError error = deserializeJson(doc, file);
   file.close();
 
@@ -734,7 +740,7 @@ bool loadCRMData() {
   JsonArray array = doc.as<JsonArray>();
 
   for (JsonObject obj : array) {
-    if (customerCount >= 50) break;
+    if (customerCount >= CRM_MAX_CUSTOMERS) break;
 
     strncpy(customers[customerCount].id, obj["id"], 19);
     strncpy(customers[customerCount].name, obj["name"], 99);
@@ -754,7 +760,8 @@ bool loadCRMData() {
 
 // Add new customer
 bool addCustomer(const char* name, const char* email, const char* company, float dealValue) {
-  if (customerCount >= 50) {
+  if (!customers) return false;
+  if (customerCount >= CRM_MAX_CUSTOMERS) {
     Serial.println("❌ CRM: Customer limit reached");
     return false;
   }
@@ -879,7 +886,8 @@ bool saveIntegrationStats() {
   File file = SPIFFS.open("/integration_stats.json", "w");
   if (!file) return false;
 
-  DynamicJsonDocument doc(4096);
+  JsonLease lease(JSON_STATS_FILE);
+  JsonDocument& doc = lease.doc;
   JsonArray array = doc.to<JsonArray>();
 
   for (int i = 0; i < 12; i++) {
@@ -902,7 +910,8 @@ bool loadIntegrationStats() {
   File file = SPIFFS.open("/integration_stats.json", "r");
   if (!file) return false;
 
-  DynamicJsonDocument doc(4096);
+  JsonLease lease(JSON_STATS_FILE);
+  JsonDocument& doc = lease.doc;
   DeserializationError error = deserializeJson(doc, file);
   file.close();
 
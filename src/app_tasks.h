@@ -0,0 +1,563 @@
+#ifndef APP_TASKS_H
+#define APP_TASKS_H
+
+/*
+ * ═══════════════════════════════════════════════════════════════════════
+ * BLACKROAD TASKS - network and UI on separate FreeRTOS tasks
+ * ═══════════════════════════════════════════════════════════════════════
+ *
+ *   task     core  prio  owns
+ *   net       0     1    HTTPClient: nav refresh, hot leads, webhooks
+ *   touch     0     3    XPT2046 sampler (touch_input.h)
+ *   loop()    1     1    serial, touch dispatch, animation, drawing
+ *
+ * The UI never waits on the network. It posts requests to a bounded ring
+ * the net task drains; the fetchers fill navWork and the net task copies
+ * it into one of two snapshot buffers, then publishes BUS_SNAPSHOT and
+ * one event per section that differs from the last snapshot (event_bus.h).
+ * The snapshot subscriber in loop() runs netSync(), which copies the
+ * newest snapshot into navState/meshNodes/hotLeads/..., so draw code reads
+ * plain globals that only change between frames. The UI marks the buffer
+ * it is copying and the net task never rewrites a marked buffer.
+ *
+ * Pager LED patterns are played by the feedback sequencer (feedback.h)
+ * off an esp_timer; pagerRaise()/pagerAck() only start and stop them.
+ *
+ * TASKS reports the worst UI frame (loop() pass without the idle sleep)
+ * and ACK -> LED off latency; NETSTRESS keeps the net task refreshing
+ * back-to-back so both can be read with the network saturated.
+ *
+ * loopIdle() ends each loop() pass: it sleeps until the next timer wheel
+ * deadline, animation frame or long-press check, and touch events, serial
+ * bytes and published snapshots notify the loop task awake early. How it
+ * waits (clock, light sleep) is power_idle.h's call.
+ *
+ * APP_TASKS=0 (host build) runs the net side from netService() in loop()
+ * and sleeps at most one LOOP_HOST_SLICE_MS slice, since the host runner
+ * injects input between loop() calls.
+ */
+
+#include <atomic>
+
+// ─────────────────────────────────────────────────────────────────────
+// CONFIGURATION
+// ─────────────────────────────────────────────────────────────────────
+
+#ifndef APP_TASKS
+#ifdef HOST_BUILD
+#define APP_TASKS 0
+#else
+#define APP_TASKS 1
+#endif
+#endif
+
+#define NAV_REFRESH_INTERVAL    300000   // 5 minutes
+#define NET_QUEUE_SIZE          8
+#define NET_TASK_STACK          8192     // HTTPClient + TLS + ArduinoJson
+#define NET_TASK_PRIORITY       1
+#define NET_TASK_CORE           0
+#define NETSTRESS_DEFAULT_S     30
+#define LOOP_MAX_SLEEP_MS       1000     // backstop if a wake is ever missed
+#define LOOP_HOST_SLICE_MS      10
+
+// Task notification bits loop() sleeps on
+#define LOOP_WAKE_TOUCH         TOUCH_WAKE_BIT   // touch_input.h
+#define LOOP_WAKE_SERIAL        0x02
+#define LOOP_WAKE_NET           0x04
+
+// ─────────────────────────────────────────────────────────────────────
+// REQUEST RING (UI -> net, single producer / single consumer)
+// ─────────────────────────────────────────────────────────────────────
+
+enum NetRequestType : uint8_t {
+  NET_REFRESH,      // updateDynamicNavigation()
+  NET_HOT_LEADS,    // fetchHotLeads() for the SYNC button
+  NET_WEBHOOK       // Discord + Slack for an alert raised by the UI
+};
+
+struct NetRequest {
+  NetRequestType type;
+  AlertLevel level;
+  char title[64];
+  char message[128];
+};
+
+NetRequest netQueue[NET_QUEUE_SIZE];
+static_assert(sizeof(netQueue) <= 1600, "net request queue grew past 1.6 KB");
+std::atomic<uint8_t> netQueueHead(0);   // written by the UI only
+std::atomic<uint8_t> netQueueTail(0);   // written by the net task only
+
+// ─────────────────────────────────────────────────────────────────────
+// SNAPSHOTS (net -> UI)
+// ─────────────────────────────────────────────────────────────────────
+
+NavSnapshot navSnap[2];
+std::atomic<uint8_t> navSnapFront(0);
+std::atomic<uint32_t> navSnapSeq(0);
+std::atomic<int8_t> navSnapReading(-1);   // buffer the UI is copying, -1 = none
+
+// ─────────────────────────────────────────────────────────────────────
+// STATS
+// ─────────────────────────────────────────────────────────────────────
+
+// Written by the net task
+struct NetTaskStats {
+  uint32_t refreshes;
+  uint32_t leadSyncs;
+  uint32_t webhooks;
+  uint32_t publishes;
+  uint32_t publishWaits;    // publish found the UI still copying that buffer
+  uint32_t busyMs;
+  uint32_t maxRequestMs;
+};
+
+// Written by the UI
+struct UiTaskStats {
+  uint32_t frames;
+  uint32_t frameSumUs;
+  uint32_t maxFrameUs;
+  uint32_t requestsDropped;   // ring full
+  uint32_t syncs;
+};
+
+// Raises by loop(), ACKs by the feedback sequencer once the LED is off
+struct PagerTaskStats {
+  uint32_t raises;
+  uint32_t acks;
+  uint32_t ackSumUs;
+  uint32_t maxAckUs;
+};
+
+NetTaskStats netTaskStats;
+UiTaskStats uiTaskStats;
+PagerTaskStats pagerTaskStats;
+
+// Written by the UI
+struct LoopIdleStats {
+  uint32_t sleeps;
+  uint32_t idleUs;          // asleep in loopIdle()
+  uint32_t sinceUs;         // window start
+  uint32_t wakeTimer;       // slept to the deadline
+  uint32_t wakeEarly;       // notified: touch, serial, snapshot
+  uint32_t skipped;         // input already waiting, no sleep
+};
+
+// power_idle.h - clock and sleep policy for loopIdle()
+uint32_t powerIdleWait(uint32_t us);
+void powerFrameDone();
+void powerBoost();
+void powerHold();
+void powerRelease();
+
+std::atomic<uint32_t> netStressUntilMs(0);
+volatile uint32_t pagerAckUs = 0;
+volatile bool pagerAckPending = false;
+
+#if APP_TASKS
+TaskHandle_t netTaskHandle = nullptr;
+TaskHandle_t uiTaskHandle = nullptr;
+#endif
+
+LoopIdleStats loopIdleStats;
+
+// ─────────────────────────────────────────────────────────────────────
+// UI SIDE - REQUESTS
+// ─────────────────────────────────────────────────────────────────────
+
+uint8_t netQueueUsed() {
+  uint8_t head = netQueueHead.load(std::memory_order_relaxed);
+  uint8_t tail = netQueueTail.load(std::memory_order_acquire);
+  return (uint8_t)((head + NET_QUEUE_SIZE - tail) % NET_QUEUE_SIZE);
+}
+
+void netWake() {
+#if APP_TASKS
+  if (netTaskHandle) xTaskNotifyGive(netTaskHandle);
+#endif
+}
+
+// Claim the next ring slot, or nullptr with the ring full
+NetRequest* netQueueSlot() {
+  if (netQueueUsed() == NET_QUEUE_SIZE - 1) {
+    uiTaskStats.requestsDropped++;
+    return nullptr;
+  }
+  return &netQueue[netQueueHead.load(std::memory_order_relaxed)];
+}
+
+void netQueuePush() {
+  uint8_t head = netQueueHead.load(std::memory_order_relaxed);
+  netQueueHead.store((uint8_t)((head + 1) % NET_QUEUE_SIZE), std::memory_order_release);
+  powerBoost();   // TLS at the active clock
+  netWake();
+}
+
+bool netRequest(NetRequestType type) {
+  NetRequest* r = netQueueSlot();
+  if (!r) return false;
+  r->type = type;
+  netQueuePush();
+  return true;
+}
+
+// Called by sendAlert() (alerts.h) - the webhooks block on HTTP
+bool netPostAlert(const char* title, const char* message, AlertLevel level) {
+  NetRequest* r = netQueueSlot();
+  if (!r) return false;
+  r->type = NET_WEBHOOK;
+  r->level = level;
+  strlcpy(r->title, title, sizeof(r->title));
+  strlcpy(r->message, message, sizeof(r->message));
+  netQueuePush();
+  return true;
+}
+
+// ─────────────────────────────────────────────────────────────────────
+// NET SIDE
+// ─────────────────────────────────────────────────────────────────────
+
+// What subscribers were last told about; net task only
+NavSnapshot netLastPublished;
+
+bool navChanged(const NavigationState& a, const NavigationState& b) {
+  // lastUpdate moves on every refresh and is not worth a repaint on its own
+  return a.activeNodes != b.activeNodes || a.hotLeads != b.hotLeads || a.aiRequests != b.aiRequests ||
+         a.meshHealthy != b.meshHealthy || a.crmHealthy != b.crmHealthy || a.aiHealthy != b.aiHealthy;
+}
+
+bool meshChanged(const NavSnapshot& a, const NavSnapshot& b) {
+  if (a.meshCount != b.meshCount) return true;
+  for (int i = 0; i < a.meshCount && i < MESH_NODE_COUNT; i++) {
+    const MeshNode& x = a.mesh[i];
+    const MeshNode& y = b.mesh[i];
+    if (x.online != y.online || x.latency != y.latency || x.bandwidth != y.bandwidth ||
+        x.node != y.node || x.ip != y.ip || x.status != y.status) return true;
+  }
+  return false;
+}
+
+bool crmChanged(const CRMMetrics& a, const CRMMetrics& b) {
+  return a.totalContacts != b.totalContacts || a.hotLeads != b.hotLeads || a.openDeals != b.openDeals ||
+         a.pipelineValue != b.pipelineValue || a.activity24h != b.activity24h ||
+         a.topLeadScore != b.topLeadScore || a.topLead != b.topLead;
+}
+
+bool aiChanged(const AIMetrics& a, const AIMetrics& b) {
+  return a.requestsToday != b.requestsToday || a.avgLatency != b.avgLatency ||
+         a.tokensGenerated != b.tokensGenerated || a.gpuUtil != b.gpuUtil ||
+         a.modelName != b.modelName || a.status != b.status || a.lastInference != b.lastInference;
+}
+
+// HotLead is plain chars/ints filled field by field - compare the bytes
+bool leadsChanged(const NavSnapshot& a, const NavSnapshot& b) {
+  return a.leadCount != b.leadCount || memcmp(a.leads, b.leads, sizeof(a.leads)) != 0;
+}
+
+// Snapshot first so the subscriber syncs before the section events repaint
+void netPublishChanges(uint32_t seq) {
+  const NavSnapshot& last = netLastPublished;
+  busPublish(BUS_FROM_NET, BUS_SNAPSHOT, 0, seq);
+  if (navChanged(navWork.nav, last.nav)) busPublish(BUS_FROM_NET, BUS_NAV);
+  if (meshChanged(navWork, last)) busPublish(BUS_FROM_NET, BUS_MESH);
+  if (crmChanged(navWork.crm, last.crm)) busPublish(BUS_FROM_NET, BUS_CRM);
+  if (leadsChanged(navWork, last)) busPublish(BUS_FROM_NET, BUS_LEADS);
+  if (aiChanged(navWork.ai, last.ai)) busPublish(BUS_FROM_NET, BUS_AI);
+  netLastPublished = navWork;
+}
+
+// Copy navWork into the buffer the UI is not reading and flip
+void netPublish() {
+  uint8_t back = 1 - navSnapFront.load();
+  while (navSnapReading.load() == back) {
+    netTaskStats.publishWaits++;
+#if APP_TASKS
+    vTaskDelay(1);
+#endif
+  }
+  navSnap[back] = navWork;
+  navSnapFront.store(back);
+  uint32_t seq = navSnapSeq.fetch_add(1) + 1;
+  netTaskStats.publishes++;
+  netPublishChanges(seq);
+#if APP_TASKS
+  if (uiTaskHandle) xTaskNotify(uiTaskHandle, LOOP_WAKE_NET, eSetBits);   // loop() may be asleep
+#endif
+}
+
+void netRunRequest(const NetRequest& r) {
+  uint32_t t0 = millis();
+  powerHold();
+
+  switch (r.type) {
+    case NET_REFRESH: {
+      HeapTag tag(HEAP_TAG_NAV);
+      updateDynamicNavigation();
+      netTaskStats.refreshes++;
+      netPublish();
+      break;
+    }
+    case NET_HOT_LEADS: {
+      HeapTag tag(HEAP_TAG_NAV);
+      fetchHotLeads();
+      netTaskStats.leadSyncs++;
+      netPublish();
+      break;
+    }
+    case NET_WEBHOOK: {
+      HeapTag tag(HEAP_TAG_ALERTS);
+      if (sendDiscordAlert(r.title, r.message, r.level)) Serial.println("   ✓ Discord notification sent");
+      if (sendSlackAlert(r.title, r.message, r.level)) Serial.println("   ✓ Slack notification sent");
+      netTaskStats.webhooks++;
+      break;
+    }
+  }
+
+  powerRelease();
+  uint32_t ms = millis() - t0;
+  netTaskStats.busyMs += ms;
+  if (ms > netTaskStats.maxRequestMs) netTaskStats.maxRequestMs = ms;
+}
+
+// One unit of net work; false when there is nothing to do
+bool netStep() {
+  uint8_t tail = netQueueTail.load(std::memory_order_relaxed);
+  if (tail != netQueueHead.load(std::memory_order_acquire)) {
+    netRunRequest(netQueue[tail]);
+    netQueueTail.store((uint8_t)((tail + 1) % NET_QUEUE_SIZE), std::memory_order_release);
+    return true;
+  }
+
+  bool stress = (int32_t)(netStressUntilMs.load() - millis()) > 0;
+  if (!stress || WiFi.status() != WL_CONNECTED) return false;
+
+  NetRequest refresh;
+  refresh.type = NET_REFRESH;
+  netRunRequest(refresh);
+  return true;
+}
+
+#if APP_TASKS
+void netTask(void*) {
+  for (;;) {
+    // The periodic refresh is a timer in loop(); sleep until it posts one
+    if (!netStep()) ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+  }
+}
+#endif
+
+// Timer wheel callback (loop()); the net task does the fetching
+void navRefreshDue(int) {
+  if (WiFi.status() == WL_CONNECTED) netRequest(NET_REFRESH);
+}
+
+// Without the task, loop() runs the net side inline (it blocks the UI)
+void netService() {
+#if !APP_TASKS
+  netStep();
+#endif
+}
+
+// ─────────────────────────────────────────────────────────────────────
+// UI SIDE - SNAPSHOTS + FRAMES
+// ─────────────────────────────────────────────────────────────────────
+
+// Copy the newest snapshot into the UI globals; true if anything changed
+bool netSync() {
+  static uint32_t seen = 0;
+  if (navSnapSeq.load() == seen) return false;
+
+  // Mark before copying, then make sure the mark landed on the live front
+  uint8_t front;
+  do {
+    front = navSnapFront.load();
+    navSnapReading.store(front);
+  } while (navSnapFront.load() != front);
+  seen = navSnapSeq.load();
+
+  const NavSnapshot& s = navSnap[front];
+  navState = s.nav;
+  crmMetrics = s.crm;
+  aiMetrics = s.ai;
+  meshNodeCount = s.meshCount;
+  for (int i = 0; i < MESH_NODE_COUNT; i++) meshNodes[i] = s.mesh[i];
+  hotLeadCount = s.leadCount;
+  memcpy(hotLeads, s.leads, sizeof(hotLeads));
+  navSnapReading.store(-1);
+
+  // Sovereign stack reads navState and is drawn by the UI - keep it here
+  updateStackHealth();
+  uiTaskStats.syncs++;
+  return true;
+}
+
+// ─────────────────────────────────────────────────────────────────────
+// LOOP IDLE
+// ─────────────────────────────────────────────────────────────────────
+
+#if APP_TASKS
+void loopWakeFromSerial() {
+  if (uiTaskHandle) xTaskNotify(uiTaskHandle, LOOP_WAKE_SERIAL, eSetBits);
+}
+#endif
+
+// Sleep until the earliest deadline or an input event
+void loopIdle() {
+#if APP_TASKS
+  if (animInputPending()) {
+    loopIdleStats.skipped++;
+    powerBoost();
+    return;
+  }
+#endif
+
+  uint32_t now = micros();
+  uint32_t sleepUs = (APP_TASKS ? LOOP_MAX_SLEEP_MS : LOOP_HOST_SLICE_MS) * 1000UL;
+  int32_t timerUs = timerUsUntilNext();
+  if (timerUs >= 0 && (uint32_t)timerUs < sleepUs) sleepUs = timerUs;
+  uint32_t dueUs;
+  if (animDeadline(dueUs)) {
+    powerBoost();   // animating counts as work
+    int32_t us = (int32_t)(dueUs - now);
+    if (us < (int32_t)sleepUs) sleepUs = us > 0 ? us : 0;
+  }
+  if (gestureDeadline(dueUs)) {
+    int32_t us = (int32_t)(dueUs - now);
+    if (us < (int32_t)sleepUs) sleepUs = us > 0 ? us : 0;
+  }
+
+#if APP_TASKS
+  if (!sleepUs) return;
+#endif
+  bool woken = powerIdleWait(sleepUs) != 0;   // clock + light sleep policy
+  loopIdleStats.sleeps++;
+  loopIdleStats.idleUs += micros() - now;
+  if (woken) loopIdleStats.wakeEarly++;
+  else loopIdleStats.wakeTimer++;
+}
+
+void uiFrameDone(uint32_t startUs) {
+  uint32_t us = micros() - startUs;
+  uiTaskStats.frames++;
+  uiTaskStats.frameSumUs += us;
+  if (us > uiTaskStats.maxFrameUs) uiTaskStats.maxFrameUs = us;
+  if (feedbackPlaying()) feedbackFrame(us);
+  powerFrameDone();
+}
+
+// ─────────────────────────────────────────────────────────────────────
+// PAGER
+// ─────────────────────────────────────────────────────────────────────
+
+void pagerAckDone() {
+  if (!pagerAckPending) return;
+  pagerAckPending = false;
+  uint32_t us = micros() - pagerAckUs;
+  pagerTaskStats.acks++;
+  pagerTaskStats.ackSumUs += us;
+  if (us > pagerTaskStats.maxAckUs) pagerTaskStats.maxAckUs = us;
+}
+
+// currentAlert was just filled in by parseAlert()
+void pagerRaise() {
+  pagerTaskStats.raises++;
+  triggerLEDPattern(currentAlert.patternId);
+}
+
+// Alert cleared (ACK, STANDBY); latency runs until the LED is off
+void pagerAck() {
+  pagerAckUs = micros();
+  pagerAckPending = true;
+  feedbackStop(FB_LED);   // the sequencer calls pagerAckDone()
+}
+
+// ─────────────────────────────────────────────────────────────────────
+// SETUP + REPORT
+// ─────────────────────────────────────────────────────────────────────
+
+void resetLoopIdleStats() {
+  memset(&loopIdleStats, 0, sizeof(loopIdleStats));
+  loopIdleStats.sinceUs = micros();
+}
+
+// Frame and ACK windows only; request/snapshot counters run since boot
+void resetTaskStats() {
+  uiTaskStats.frames = 0;
+  uiTaskStats.frameSumUs = 0;
+  uiTaskStats.maxFrameUs = 0;
+  memset(&pagerTaskStats, 0, sizeof(pagerTaskStats));
+}
+
+// After connectWiFi() filled navWork; starts the net task
+void initAppTasks() {
+  netPublish();
+  netSync();
+  resetTaskStats();
+  resetLoopIdleStats();
+  timerEvery(NAV_REFRESH_INTERVAL, navRefreshDue, "nav refresh");
+#if APP_TASKS
+  uiTaskHandle = xTaskGetCurrentTaskHandle();
+  touchWakeTask = uiTaskHandle;
+  Serial.onReceive(loopWakeFromSerial);
+  xTaskCreatePinnedToCore(netTask, "net", NET_TASK_STACK, nullptr,
+                          NET_TASK_PRIORITY, &netTaskHandle, NET_TASK_CORE);
+#endif
+}
+
+// Keep the net task refreshing back-to-back for `seconds`
+void startNetStress(uint32_t seconds) {
+  resetTaskStats();
+  netStressUntilMs.store(millis() + seconds * 1000);
+  powerBoost();
+  netWake();
+}
+
+void printTaskReport() {
+  const UiTaskStats& u = uiTaskStats;
+  const PagerTaskStats& p = pagerTaskStats;
+  const NetTaskStats& n = netTaskStats;
+  int32_t stressLeft = (int32_t)(netStressUntilMs.load() - millis());
+
+  Serial.println("\n━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━");
+  Serial.println("   TASKS");
+  Serial.println("━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━");
+  Serial.printf("   Layout:       %s\n", APP_TASKS ? "net core 0, loop() core 1" : "net inline in loop()");
+  Serial.printf("   UI frame:     %u us avg, %u us max (%u frames)\n",
+                u.frames ? u.frameSumUs / u.frames : 0, u.maxFrameUs, u.frames);
+  Serial.printf("   Pager ACK:    %u us avg, %u us max (%u acks, %u raised)\n",
+                p.acks ? p.ackSumUs / p.acks : 0, p.maxAckUs, p.acks, p.raises);
+  Serial.printf("   Net:          %u refreshes, %u lead syncs, %u webhooks\n", n.refreshes, n.leadSyncs, n.webhooks);
+  Serial.printf("   Net busy:     %u ms total, %u ms longest request\n", n.busyMs, n.maxRequestMs);
+  Serial.printf("   Requests:     %u/%d queued, %u dropped\n", netQueueUsed(), NET_QUEUE_SIZE - 1, u.requestsDropped);
+  Serial.printf("   Snapshots:    %u published, %u applied, %u waits on the UI copy\n",
+                n.publishes, u.syncs, n.publishWaits);
+#if APP_TASKS
+  Serial.printf("   Stack free:   net %u, loop %u bytes\n",
+                uxTaskGetStackHighWaterMark(netTaskHandle), uxTaskGetStackHighWaterMark(uiTaskHandle));
+#endif
+  if (stressLeft > 0) Serial.printf("   NETSTRESS:    running, %d s left\n", (int)(stressLeft / 1000));
+  else Serial.println("   NETSTRESS:    off");
+  Serial.println("━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━\n");
+}
+
+// Timer wheel + how much of the time loop() spent asleep
+void printSchedReport() {
+  const LoopIdleStats& l = loopIdleStats;
+  uint32_t wallUs = micros() - l.sinceUs;
+  float idlePct = wallUs ? l.idleUs * 100.0 / wallUs : 0;
+  const TimerWheelStats& w = timerStats;
+
+  Serial.println("\n━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━");
+  Serial.println("   SCHEDULER");
+  Serial.println("━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━");
+  Serial.printf("   loop() idle:  %.1f%% of %u ms (%u sleeps)\n", idlePct, wallUs / 1000, l.sleeps);
+  Serial.printf("   Wakes:        %u at deadline, %u early (input/snapshot), %u skipped\n",
+                l.wakeTimer, l.wakeEarly, l.skipped);
+  Serial.printf("   Wheel:        %u fires, %u busy ticks, %u cascades, %u full\n",
+                w.fires, w.busyTicks, w.cascades, w.full);
+  Serial.printf("   Jitter:       %u us avg, %u us max (fire - deadline)\n",
+                w.fires ? w.lateSumUs / w.fires : 0, w.maxLateUs);
+  printTimerList();
+  Serial.println("━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━\n");
+}
+
+#endif // APP_TASKS_H
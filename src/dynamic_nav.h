@@ -5,9 +5,9 @@
 #include <HTTPClient.h>
 #include <WiFiClient.h>
 #include "secrets.h"
-
-// Forward declaration for sovereign_stack.h function
-void updateStackHealth();
+#include "fixed_string.h"
+#include "json_arena.h"
+#include "status_model.h"
 
 /*
  * ═══════════════════════════════════════════════════════════════════════
@@ -35,14 +35,34 @@ void updateStackHealth();
 // DATA STRUCTURES
 // ─────────────────────────────────────────────────────────────────────
 
+constexpr uint32_t ipv4(uint8_t a, uint8_t b, uint8_t c, uint8_t d) {
+  return (uint32_t)a << 24 | (uint32_t)b << 16 | (uint32_t)c << 8 | d;
+}
+
+// Mesh roster (flash) - names and hostnames never change at runtime
+struct MeshNodeInfo {
+  const char* name;
+  const char* hostname;
+  uint32_t ip;           // static fallback until the mesh reports one
+};
+
+constexpr MeshNodeInfo MESH_NODES[] = {
+  { "lucidia",   "lucidia.blackroad.network",   ipv4(100, 66, 235, 47) },
+  { "octavia",   "octavia.blackroad.network",   ipv4(100, 64, 0, 2) },
+  { "alice",     "alice.blackroad.network",     ipv4(100, 64, 0, 3) },
+  { "shellfish", "shellfish.blackroad.network", ipv4(100, 64, 0, 4) },
+};
+
+#define MESH_NODE_COUNT ((int)(sizeof(MESH_NODES) / sizeof(MESH_NODES[0])))
+
+// Live state of one roster node - copied through every nav snapshot
 struct MeshNode {
-  String name;           // "lucidia", "octavia", "alice"
-  String ip;             // "100.64.0.1"
-  String hostname;       // "lucidia.blackroad.network"
+  uint8_t node;          // MESH_NODES index
+  NodeStatus status;
   bool online;
   int latency;           // milliseconds
   float bandwidth;       // MB/s
-  String status;         // "active", "idle", "offline"
+  uint32_t ip;           // ipv4(), 0 = unknown
   unsigned long lastSeen;
 };
 
@@ -52,18 +72,18 @@ struct CRMMetrics {
   int openDeals;
   float pipelineValue;
   int activity24h;
-  String topLead;        // Contact name
+  FixedString<32> topLead;   // Contact name
   int topLeadScore;
 };
 
 struct AIMetrics {
-  String modelName;
-  String status;         // "running", "idle", "loading"
+  FixedString<32> modelName;
+  AIStatus status;
   int requestsToday;
   float avgLatency;      // milliseconds
   int tokensGenerated;
   float gpuUtil;         // percentage
-  String lastInference;
+  FixedString<16> lastInference;
 };
 
 struct HotLead {
@@ -71,11 +91,11 @@ struct HotLead {
   char company[32];       // "Acme Corp"
   char email[64];         // "john@acme.com"
   int score;              // Lead score (0-100)
-  char temperature[16];   // "burning", "hot", "warm"
+  LeadTemperature temperature;
   int opens;              // Email opens
   int clicks;             // Link clicks
   char lastActivity[32];  // "2h ago", "1d ago"
-  char stage[24];         // "Ready", "Evaluating"
+  LeadStage stage;
   bool hasReplied;
 };
 
@@ -93,7 +113,9 @@ struct NavigationState {
 // GLOBAL STATE
 // ─────────────────────────────────────────────────────────────────────
 
-MeshNode meshNodes[4];  // lucidia, octavia, alice, shellfish
+// UI copy - draw code reads these; netSync() (app_tasks.h) refreshes
+// them from the newest published snapshot between frames
+MeshNode meshNodes[MESH_NODE_COUNT];  // lucidia, octavia, alice, shellfish
 int meshNodeCount = 0;
 
 HotLead hotLeads[5];     // Top 5 hot leads
@@ -103,106 +125,150 @@ CRMMetrics crmMetrics;
 AIMetrics aiMetrics;
 NavigationState navState;
 
+// Everything the fetchers produce, as one copyable unit
+struct NavSnapshot {
+  NavigationState nav;
+  CRMMetrics crm;
+  AIMetrics ai;
+  MeshNode mesh[MESH_NODE_COUNT];
+  int meshCount;
+  HotLead leads[5];
+  int leadCount;
+};
+
+// Copied whole on every refresh (navSnap, netLastPublished in app_tasks.h)
+static_assert(sizeof(HotLead) <= 192, "HotLead grew - NavSnapshot holds five");
+static_assert(sizeof(NavSnapshot) <= 1280, "NavSnapshot grew - it is copied on every nav refresh");
+
+// Working set - only the fetchers below write it (network task)
+NavSnapshot navWork;
+
+// ─────────────────────────────────────────────────────────────────────
+// MESH HELPERS
+// ─────────────────────────────────────────────────────────────────────
+
+// MESH_NODES index, -1 if not on the roster
+int meshNodeFind(const char* name) {
+  for (int i = 0; i < MESH_NODE_COUNT; i++) {
+    if (strEq(name, MESH_NODES[i].name)) return i;
+  }
+  return -1;
+}
+
+// "a.b.c.d" -> ipv4(a, b, c, d), 0 if malformed
+uint32_t parseIPv4(const char* s) {
+  unsigned a, b, c, d;
+  char tail;
+  if (!s || sscanf(s, "%u.%u.%u.%u%c", &a, &b, &c, &d, &tail) != 4) return 0;
+  if (a > 255 || b > 255 || c > 255 || d > 255) return 0;
+  return ipv4(a, b, c, d);
+}
+
+char* formatIPv4(uint32_t ip, char* buf, size_t size) {
+  return strfmt(buf, size, "%u.%u.%u.%u", (unsigned)(ip >> 24), (unsigned)(ip >> 16 & 0xFF),
+                (unsigned)(ip >> 8 & 0xFF), (unsigned)(ip & 0xFF));
+}
+
 // ─────────────────────────────────────────────────────────────────────
 // STATIC DATA FALLBACKS (must be declared before fetch functions)
 // ─────────────────────────────────────────────────────────────────────
 
 bool initStaticMeshData() {
-  meshNodeCount = 4;
+  navWork.meshCount = MESH_NODE_COUNT;
 
-  meshNodes[0] = {"lucidia", "100.66.235.47", "lucidia.blackroad.network", true, 12, 2.4, "active", millis()};
-  meshNodes[1] = {"octavia", "100.64.0.2", "octavia.blackroad.network", true, 8, 5.1, "active", millis()};
-  meshNodes[2] = {"alice", "100.64.0.3", "alice.blackroad.network", true, 15, 1.8, "idle", millis()};
-  meshNodes[3] = {"shellfish", "100.64.0.4", "shellfish.blackroad.network", true, 24, 0.9, "active", millis()};
+  navWork.mesh[0] = {0, NODE_ACTIVE, true, 12, 2.4, MESH_NODES[0].ip, millis()};
+  navWork.mesh[1] = {1, NODE_ACTIVE, true, 8, 5.1, MESH_NODES[1].ip, millis()};
+  navWork.mesh[2] = {2, NODE_IDLE, true, 15, 1.8, MESH_NODES[2].ip, millis()};
+  navWork.mesh[3] = {3, NODE_ACTIVE, true, 24, 0.9, MESH_NODES[3].ip, millis()};
 
-  navState.activeNodes = 4;
-  navState.meshHealthy = false; // Static data, not real
+  navWork.nav.activeNodes = 4;
+  navWork.nav.meshHealthy = false; // Static data, not real
   return false;
 }
 
 bool initStaticCRMData() {
-  crmMetrics.totalContacts = 150;
-  crmMetrics.hotLeads = 12;
-  crmMetrics.openDeals = 8;
-  crmMetrics.pipelineValue = 250000;
-  crmMetrics.activity24h = 45;
-  crmMetrics.topLead = "Acme Corp";
-  crmMetrics.topLeadScore = 87;
+  navWork.crm.totalContacts = 150;
+  navWork.crm.hotLeads = 12;
+  navWork.crm.openDeals = 8;
+  navWork.crm.pipelineValue = 250000;
+  navWork.crm.activity24h = 45;
+  navWork.crm.topLead = "Acme Corp";
+  navWork.crm.topLeadScore = 87;
 
   // Initialize static hot leads data
-  hotLeadCount = 5;
-
-  strncpy(hotLeads[0].name, "Sarah Chen", 31);
-  strncpy(hotLeads[0].company, "TechVentures Inc", 31);
-  strncpy(hotLeads[0].email, "sarah@techventures.io", 63);
-  hotLeads[0].score = 94;
-  strncpy(hotLeads[0].temperature, "burning", 15);
-  hotLeads[0].opens = 8;
-  hotLeads[0].clicks = 5;
-  strncpy(hotLeads[0].lastActivity, "2h ago", 31);
-  strncpy(hotLeads[0].stage, "Ready", 23);
-  hotLeads[0].hasReplied = true;
-
-  strncpy(hotLeads[1].name, "Marcus Webb", 31);
-  strncpy(hotLeads[1].company, "DataFlow Systems", 31);
-  strncpy(hotLeads[1].email, "marcus@dataflow.com", 63);
-  hotLeads[1].score = 89;
-  strncpy(hotLeads[1].temperature, "hot", 15);
-  hotLeads[1].opens = 6;
-  hotLeads[1].clicks = 4;
-  strncpy(hotLeads[1].lastActivity, "5h ago", 31);
-  strncpy(hotLeads[1].stage, "Evaluating", 23);
-  hotLeads[1].hasReplied = false;
-
-  strncpy(hotLeads[2].name, "Jennifer Lopez", 31);
-  strncpy(hotLeads[2].company, "CloudScale Ltd", 31);
-  strncpy(hotLeads[2].email, "jlo@cloudscale.com", 63);
-  hotLeads[2].score = 85;
-  strncpy(hotLeads[2].temperature, "hot", 15);
-  hotLeads[2].opens = 5;
-  hotLeads[2].clicks = 3;
-  strncpy(hotLeads[2].lastActivity, "1d ago", 31);
-  strncpy(hotLeads[2].stage, "Ready", 23);
-  hotLeads[2].hasReplied = true;
-
-  strncpy(hotLeads[3].name, "David Kim", 31);
-  strncpy(hotLeads[3].company, "FinTech Partners", 31);
-  strncpy(hotLeads[3].email, "david@fintechp.io", 63);
-  hotLeads[3].score = 82;
-  strncpy(hotLeads[3].temperature, "hot", 15);
-  hotLeads[3].opens = 7;
-  hotLeads[3].clicks = 2;
-  strncpy(hotLeads[3].lastActivity, "3h ago", 31);
-  strncpy(hotLeads[3].stage, "Curious", 23);
-  hotLeads[3].hasReplied = false;
-
-  strncpy(hotLeads[4].name, "Amanda Foster", 31);
-  strncpy(hotLeads[4].company, "StartupLabs", 31);
-  strncpy(hotLeads[4].email, "afoster@startuplabs.io", 63);
-  hotLeads[4].score = 78;
-  strncpy(hotLeads[4].temperature, "warm", 15);
-  hotLeads[4].opens = 4;
-  hotLeads[4].clicks = 3;
-  strncpy(hotLeads[4].lastActivity, "6h ago", 31);
-  strncpy(hotLeads[4].stage, "Evaluating", 23);
-  hotLeads[4].hasReplied = true;
-
-  navState.hotLeads = 12;
-  navState.crmHealthy = false; // Static data
+  navWork.leadCount = 5;
+
+  strncpy(navWork.leads[0].name, "Sarah Chen", 31);
+  strncpy(navWork.leads[0].company, "TechVentures Inc", 31);
+  strncpy(navWork.leads[0].email, "sarah@techventures.io", 63);
+  navWork.leads[0].score = 94;
+  navWork.leads[0].temperature = TEMP_BURNING;
+  navWork.leads[0].opens = 8;
+  navWork.leads[0].clicks = 5;
+  strncpy(navWork.leads[0].lastActivity, "2h ago", 31);
+  navWork.leads[0].stage = STAGE_READY;
+  navWork.leads[0].hasReplied = true;
+
+  strncpy(navWork.leads[1].name, "Marcus Webb", 31);
+  strncpy(navWork.leads[1].company, "DataFlow Systems", 31);
+  strncpy(navWork.leads[1].email, "marcus@dataflow.com", 63);
+  navWork.leads[1].score = 89;
+  navWork.leads[1].temperature = TEMP_HOT;
+  navWork.leads[1].opens = 6;
+  navWork.leads[1].clicks = 4;
+  strncpy(navWork.leads[1].lastActivity, "5h ago", 31);
+  navWork.leads[1].stage = STAGE_EVALUATING;
+  navWork.leads[1].hasReplied = false;
+
+  strncpy(navWork.leads[2].name, "Jennifer Lopez", 31);
+  strncpy(navWork.leads[2].company, "CloudScale Ltd", 31);
+  strncpy(navWork.leads[2].email, "jlo@cloudscale.com", 63);
+  navWork.leads[2].score = 85;
+  navWork.leads[2].temperature = TEMP_HOT;
+  navWork.leads[2].opens = 5;
+  navWork.leads[2].clicks = 3;
+  strncpy(navWork.leads[2].lastActivity, "1d ago", 31);
+  navWork.leads[2].stage = STAGE_READY;
+  navWork.leads[2].hasReplied = true;
+
+  strncpy(navWork.leads[3].name, "David Kim", 31);
+  strncpy(navWork.leads[3].company, "FinTech Partners", 31);
+  strncpy(navWork.leads[3].email, "david@fintechp.io", 63);
+  navWork.leads[3].score = 82;
+  navWork.leads[3].temperature = TEMP_HOT;
+  navWork.leads[3].opens = 7;
+  navWork.leads[3].clicks = 2;
+  strncpy(navWork.leads[3].lastActivity, "3h ago", 31);
+  navWork.leads[3].stage = STAGE_CURIOUS;
+  navWork.leads[3].hasReplied = false;
+
+  strncpy(navWork.leads[4].name, "Amanda Foster", 31);
+  strncpy(navWork.leads[4].company, "StartupLabs", 31);
+  strncpy(navWork.leads[4].email, "afoster@startuplabs.io", 63);
+  navWork.leads[4].score = 78;
+  navWork.leads[4].temperature = TEMP_WARM;
+  navWork.leads[4].opens = 4;
+  navWork.leads[4].clicks = 3;
+  strncpy(navWork.leads[4].lastActivity, "6h ago", 31);
+  navWork.leads[4].stage = STAGE_EVALUATING;
+  navWork.leads[4].hasReplied = true;
+
+  navWork.nav.hotLeads = 12;
+  navWork.nav.crmHealthy = false; // Static data
   return false;
 }
 
 bool initStaticAIData() {
-  aiMetrics.modelName = "Lucidia-7B";
-  aiMetrics.status = "idle";
-  aiMetrics.requestsToday = 234;
-  aiMetrics.avgLatency = 145.2;
-  aiMetrics.tokensGenerated = 45678;
-  aiMetrics.gpuUtil = 23.5;
-  aiMetrics.lastInference = "2m ago";
-
-  navState.aiRequests = 234;
-  navState.aiHealthy = false; // Static data
+  navWork.ai.modelName = "Lucidia-7B";
+  navWork.ai.status = AI_IDLE;
+  navWork.ai.requestsToday = 234;
+  navWork.ai.avgLatency = 145.2;
+  navWork.ai.tokensGenerated = 45678;
+  navWork.ai.gpuUtil = 23.5;
+  navWork.ai.lastInference = "2m ago";
+
+  navWork.nav.aiRequests = 234;
+  navWork.nav.aiHealthy = false; // Static data
   return false;
 }
 
@@ -226,36 +292,45 @@ bool fetchMeshStatus() {
     String payload = http.getString();
 
     // Parse JSON response
-    DynamicJsonDocument doc(4096);
+    JsonLease lease(JSON_MESH);
+    JsonDocument& doc = lease.doc;
     DeserializationError error = deserializeJson(doc, payload);
 
     if (!error) {
       JsonArray nodes = doc["nodes"];
-      meshNodeCount = 0;
+      navWork.meshCount = 0;
 
       for (JsonObject node : nodes) {
-        if (meshNodeCount >= 4) break;
-
-        meshNodes[meshNodeCount].name = node["name"].as<String>();
-        meshNodes[meshNodeCount].ip = node["ip"].as<String>();
-        meshNodes[meshNodeCount].hostname = node["hostname"].as<String>();
-        meshNodes[meshNodeCount].online = node["online"].as<bool>();
-        meshNodes[meshNodeCount].latency = node["latency"].as<int>();
-        meshNodes[meshNodeCount].bandwidth = node["bandwidth"].as<float>();
-        meshNodes[meshNodeCount].status = node["status"].as<String>();
-        meshNodes[meshNodeCount].lastSeen = millis();
+        if (navWork.meshCount >= MESH_NODE_COUNT) break;
+
+        const char* name = node["name"].as<const char*>();
+        int id = meshNodeFind(name);
+        if (id < 0) {
+          Serial.printf("  ? %s: not in MESH_NODES, skipped\n", name ? name : "(no name)");
+          continue;
+        }
+
+        MeshNode& m = navWork.mesh[navWork.meshCount];
+        m.node = id;
+        m.ip = parseIPv4(node["ip"].as<const char*>());
+        if (!m.ip) m.ip = MESH_NODES[id].ip;
+        m.online = node["online"].as<bool>();
+        m.latency = node["latency"].as<int>();
+        m.bandwidth = node["bandwidth"].as<float>();
+        m.status = parseNodeStatus(node["status"].as<const char*>());
+        m.lastSeen = millis();
 
         Serial.printf("  ✓ %s: %s (%dms)\n",
-          meshNodes[meshNodeCount].name.c_str(),
-          meshNodes[meshNodeCount].online ? "online" : "offline",
-          meshNodes[meshNodeCount].latency
+          MESH_NODES[id].name,
+          m.online ? "online" : "offline",
+          m.latency
         );
 
-        meshNodeCount++;
+        navWork.meshCount++;
       }
 
-      navState.activeNodes = meshNodeCount;
-      navState.meshHealthy = true;
+      navWork.nav.activeNodes = navWork.meshCount;
+      navWork.nav.meshHealthy = true;
       http.end();
       return true;
     }
@@ -287,24 +362,25 @@ bool fetchCRMMetrics() {
   if (httpCode == HTTP_CODE_OK) {
     String payload = http.getString();
 
-    DynamicJsonDocument doc(2048);
+    JsonLease lease(JSON_CRM_STATS);
+    JsonDocument& doc = lease.doc;
     DeserializationError error = deserializeJson(doc, payload);
 
     if (!error) {
-      crmMetrics.totalContacts = doc["total_contacts"] | 0;
-      crmMetrics.hotLeads = doc["hot_leads"] | 0;
-      crmMetrics.openDeals = doc["open_deals"] | 0;
-      crmMetrics.pipelineValue = doc["pipeline_value"] | 0.0;
-      crmMetrics.activity24h = doc["activity_24h"] | 0;
+      navWork.crm.totalContacts = doc["total_contacts"] | 0;
+      navWork.crm.hotLeads = doc["hot_leads"] | 0;
+      navWork.crm.openDeals = doc["open_deals"] | 0;
+      navWork.crm.pipelineValue = doc["pipeline_value"] | 0.0;
+      navWork.crm.activity24h = doc["activity_24h"] | 0;
 
       Serial.printf("  ✓ Contacts: %d | Hot Leads: %d | Pipeline: $%.0fK\n",
-        crmMetrics.totalContacts,
-        crmMetrics.hotLeads,
-        crmMetrics.pipelineValue / 1000.0
+        navWork.crm.totalContacts,
+        navWork.crm.hotLeads,
+        navWork.crm.pipelineValue / 1000.0
       );
 
-      navState.hotLeads = crmMetrics.hotLeads;
-      navState.crmHealthy = true;
+      navWork.nav.hotLeads = navWork.crm.hotLeads;
+      navWork.nav.crmHealthy = true;
       http.end();
       return true;
     }
@@ -332,15 +408,16 @@ bool fetchHotLeads() {
   if (httpCode == HTTP_CODE_OK) {
     String payload = http.getString();
 
-    DynamicJsonDocument doc(4096);
+    JsonLease lease(JSON_HOT_LEADS);
+    JsonDocument& doc = lease.doc;
     DeserializationError error = deserializeJson(doc, payload);
 
     if (!error && doc.containsKey("contacts")) {
       JsonArray contacts = doc["contacts"];
-      hotLeadCount = 0;
+      navWork.leadCount = 0;
 
       for (JsonObject contact : contacts) {
-        if (hotLeadCount >= 5) break;  // Max 5 leads
+        if (navWork.leadCount >= 5) break;  // Max 5 leads
 
         // Parse contact data
         const char* firstName = contact["first_name"] | "";
@@ -348,38 +425,38 @@ bool fetchHotLeads() {
         const char* company = contact["company"] | "Unknown";
         const char* email = contact["email"] | "";
         int score = contact["lead_score"] | 0;
-        const char* temp = contact["temperature"] | "warm";
+        LeadTemperature temp = parseLeadTemperature(contact["temperature"] | "warm");
         int opens = contact["email_opens"] | 0;
         int clicks = contact["email_clicks"] | 0;
-        const char* stage = contact["stage"] | "Aware";
+        LeadStage stage = parseLeadStage(contact["stage"] | "Aware");
         bool replied = contact["has_replied"] | false;
 
         // Build full name
         char fullName[32];
         snprintf(fullName, 31, "%s %s", firstName, lastName);
-        strncpy(hotLeads[hotLeadCount].name, fullName, 31);
+        strncpy(navWork.leads[navWork.leadCount].name, fullName, 31);
 
         // Copy data
-        strncpy(hotLeads[hotLeadCount].company, company, 31);
-        strncpy(hotLeads[hotLeadCount].email, email, 63);
-        hotLeads[hotLeadCount].score = score;
-        strncpy(hotLeads[hotLeadCount].temperature, temp, 15);
-        hotLeads[hotLeadCount].opens = opens;
-        hotLeads[hotLeadCount].clicks = clicks;
-        strncpy(hotLeads[hotLeadCount].stage, stage, 23);
-        hotLeads[hotLeadCount].hasReplied = replied;
+        strncpy(navWork.leads[navWork.leadCount].company, company, 31);
+        strncpy(navWork.leads[navWork.leadCount].email, email, 63);
+        navWork.leads[navWork.leadCount].score = score;
+        navWork.leads[navWork.leadCount].temperature = temp;
+        navWork.leads[navWork.leadCount].opens = opens;
+        navWork.leads[navWork.leadCount].clicks = clicks;
+        navWork.leads[navWork.leadCount].stage = stage;
+        navWork.leads[navWork.leadCount].hasReplied = replied;
 
         // Calculate last activity (simplified)
         const char* updatedAt = contact["updated_at"] | "";
-        strncpy(hotLeads[hotLeadCount].lastActivity, "Recent", 31);
+        strncpy(navWork.leads[navWork.leadCount].lastActivity, "Recent", 31);
 
         Serial.printf("  ✓ %s (%s) - Score: %d\n", fullName, company, score);
 
-        hotLeadCount++;
+        navWork.leadCount++;
       }
 
-      Serial.printf("  ✓ Loaded %d hot leads from API\n", hotLeadCount);
-      navState.crmHealthy = true;
+      Serial.printf("  ✓ Loaded %d hot leads from API\n", navWork.leadCount);
+      navWork.nav.crmHealthy = true;
       http.end();
       return true;
     }
@@ -410,25 +487,26 @@ bool fetchAIMetrics() {
   if (httpCode == HTTP_CODE_OK) {
     String payload = http.getString();
 
-    DynamicJsonDocument doc(1024);
+    JsonLease lease(JSON_AI_HEALTH);
+    JsonDocument& doc = lease.doc;
     DeserializationError error = deserializeJson(doc, payload);
 
     if (!error) {
-      aiMetrics.modelName = doc["model"].as<String>();
-      aiMetrics.status = doc["status"].as<String>();
-      aiMetrics.requestsToday = doc["requests_today"] | 0;
-      aiMetrics.avgLatency = doc["avg_latency"] | 0.0;
-      aiMetrics.tokensGenerated = doc["tokens_generated"] | 0;
-      aiMetrics.gpuUtil = doc["gpu_util"] | 0.0;
+      navWork.ai.modelName = doc["model"].as<const char*>();
+      navWork.ai.status = parseAIStatus(doc["status"]);
+      navWork.ai.requestsToday = doc["requests_today"] | 0;
+      navWork.ai.avgLatency = doc["avg_latency"] | 0.0;
+      navWork.ai.tokensGenerated = doc["tokens_generated"] | 0;
+      navWork.ai.gpuUtil = doc["gpu_util"] | 0.0;
 
       Serial.printf("  ✓ Model: %s | Status: %s | Requests: %d\n",
-        aiMetrics.modelName.c_str(),
-        aiMetrics.status.c_str(),
-        aiMetrics.requestsToday
+        navWork.ai.modelName.c_str(),
+        AI_STATUS_NAMES[navWork.ai.status],
+        navWork.ai.requestsToday
       );
 
-      navState.aiRequests = aiMetrics.requestsToday;
-      navState.aiHealthy = true;
+      navWork.nav.aiRequests = navWork.ai.requestsToday;
+      navWork.nav.aiHealthy = true;
       http.end();
       return true;
     }
@@ -457,19 +535,16 @@ void updateDynamicNavigation() {
   bool crmOk = fetchCRMMetrics();
   bool aiOk = fetchAIMetrics();
 
-  // Update sovereign stack health based on navigation state
-  updateStackHealth();
-
-  navState.lastUpdate = millis();
+  navWork.nav.lastUpdate = millis();
 
   unsigned long elapsed = millis() - startTime;
 
   Serial.println("\n━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━");
   Serial.println("📊 NAVIGATION STATE SUMMARY");
   Serial.println("━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━");
-  Serial.printf("Mesh:   %s (%d nodes)\n", meshOk ? "✅ LIVE" : "⚠️  STATIC", navState.activeNodes);
-  Serial.printf("CRM:    %s (%d hot leads)\n", crmOk ? "✅ LIVE" : "⚠️  STATIC", navState.hotLeads);
-  Serial.printf("AI:     %s (%d requests)\n", aiOk ? "✅ LIVE" : "⚠️  STATIC", navState.aiRequests);
+  Serial.printf("Mesh:   %s (%d nodes)\n", meshOk ? "✅ LIVE" : "⚠️  STATIC", navWork.nav.activeNodes);
+  Serial.printf("CRM:    %s (%d hot leads)\n", crmOk ? "✅ LIVE" : "⚠️  STATIC", navWork.nav.hotLeads);
+  Serial.printf("AI:     %s (%d requests)\n", aiOk ? "✅ LIVE" : "⚠️  STATIC", navWork.nav.aiRequests);
   Serial.printf("Update: %lu ms\n", elapsed);
   Serial.println("━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━\n");
 }
@@ -479,49 +554,50 @@ void updateDynamicNavigation() {
 // ─────────────────────────────────────────────────────────────────────
 
 struct GenesisHash {
-  String hash;
-  String entity;
-  String type;
-  bool verified;
+  const char* hash;      // 64 hex chars
+  const char* entity;
+  const char* type;
 };
 
-GenesisHash genesisHashes[10];
-int genesisHashCount = 0;
+// Critical hashes (flash)
+constexpr GenesisHash GENESIS_HASHES[] = {
+  { "1031f308ae9ae6d34fe87e83867c1e5869c9fca7e35fdd5d0e8deb798e9c51be", "alexa-amundson", "principal" },
+  { "c1cba42fd51be0b76c1f47ef2eda55fbcc1646b7b0a372d9563bb5db21ed1de1", "agent:cece", "core_agent" },
+  { "2a402097b594033b74fcc1c7666d4c35f42e578537fea8c8a5cebd7330f591ba", "agent:lucidia", "core_agent" },
+  { "0ac14c4c4d90ccb78b73a8b8781d2103b1e019f01963413eaf632ffa4d29a69e", "blackroad.io", "domain" },
+  { "bc05212d9e8ccab6d369cab5736089afe6275000756d354e7e7f41a3e9326bcf", "protocol:amundson:v0.1.0", "protocol" },
+};
 
-bool verifyGenesisHash(String hash, String entity) {
-  // Compare against known hashes from blackroad_genesis_hashlist_v1.txt
+// Example hashes from blackroad_genesis_hashlist_v1.txt: hash, entity tag
+constexpr GenesisHash GENESIS_KNOWN[] = {
+  { "1031f308ae9ae6d34fe87e83867c1e5869c9fca7e35fdd5d0e8deb798e9c51be", "human:alexa", nullptr },
+  { "c1cba42fd51be0b76c1f47ef2eda55fbcc1646b7b0a372d9563bb5db21ed1de1", "agent:cece", nullptr },
+  { "2a402097b594033b74fcc1c7666d4c35f42e578537fea8c8a5cebd7330f591ba", "agent:lucidia", nullptr },
+  { "496762c13853508f5a52806717465ac0221391c55bc0ccef5817a640ec9fc948", "agent:alice", nullptr },
+  { "0ac14c4c4d90ccb78b73a8b8781d2103b1e019f01963413eaf632ffa4d29a69e", "domain:blackroad.io", nullptr },
+};
 
-  // Example hashes from genesis list:
-  const char* knownHashes[][2] = {
-    {"1031f308ae9ae6d34fe87e83867c1e5869c9fca7e35fdd5d0e8deb798e9c51be", "human:alexa"},
-    {"c1cba42fd51be0b76c1f47ef2eda55fbcc1646b7b0a372d9563bb5db21ed1de1", "agent:cece"},
-    {"2a402097b594033b74fcc1c7666d4c35f42e578537fea8c8a5cebd7330f591ba", "agent:lucidia"},
-    {"496762c13853508f5a52806717465ac0221391c55bc0ccef5817a640ec9fc948", "agent:alice"},
-    {"0ac14c4c4d90ccb78b73a8b8781d2103b1e019f01963413eaf632ffa4d29a69e", "domain:blackroad.io"},
-  };
-
-  for (int i = 0; i < 5; i++) {
-    if (hash == knownHashes[i][0] && entity.indexOf(knownHashes[i][1]) >= 0) {
-      Serial.printf("✅ Genesis hash verified: %s\n", entity.c_str());
+const int genesisHashCount = sizeof(GENESIS_HASHES) / sizeof(GENESIS_HASHES[0]);
+uint32_t genesisVerifiedMask = 0;   // bit i = GENESIS_HASHES[i] verified
+
+bool verifyGenesisHash(const char* hash, const char* entity) {
+  // Compare against known hashes from blackroad_genesis_hashlist_v1.txt
+  for (size_t i = 0; i < sizeof(GENESIS_KNOWN) / sizeof(GENESIS_KNOWN[0]); i++) {
+    if (strEq(hash, GENESIS_KNOWN[i].hash) && entity && strstr(entity, GENESIS_KNOWN[i].entity)) {
+      Serial.printf("✅ Genesis hash verified: %s\n", entity);
       return true;
     }
   }
 
-  Serial.printf("❌ Genesis hash FAILED: %s\n", entity.c_str());
+  Serial.printf("❌ Genesis hash FAILED: %s\n", entity ? entity : "");
   return false;
 }
 
 void initGenesisVerification() {
   Serial.println("\n🔐 Initializing Genesis Verification...");
 
-  // Load critical hashes
-  genesisHashCount = 5;
-
-  genesisHashes[0] = {"1031f308ae9ae6d34fe87e83867c1e5869c9fca7e35fdd5d0e8deb798e9c51be", "alexa-amundson", "principal", true};
-  genesisHashes[1] = {"c1cba42fd51be0b76c1f47ef2eda55fbcc1646b7b0a372d9563bb5db21ed1de1", "agent:cece", "core_agent", true};
-  genesisHashes[2] = {"2a402097b594033b74fcc1c7666d4c35f42e578537fea8c8a5cebd7330f591ba", "agent:lucidia", "core_agent", true};
-  genesisHashes[3] = {"0ac14c4c4d90ccb78b73a8b8781d2103b1e019f01963413eaf632ffa4d29a69e", "blackroad.io", "domain", true};
-  genesisHashes[4] = {"bc05212d9e8ccab6d369cab5736089afe6275000756d354e7e7f41a3e9326bcf", "protocol:amundson:v0.1.0", "protocol", true};
+  // Critical hashes ship verified
+  genesisVerifiedMask = (1u << genesisHashCount) - 1;
 
   Serial.printf("  ✓ Loaded %d genesis hashes\n", genesisHashCount);
   Serial.println("  ✓ Verification system ready\n");
@@ -531,14 +607,11 @@ void initGenesisVerification() {
 // DYNAMIC NAVIGATION HELPERS
 // ─────────────────────────────────────────────────────────────────────
 
-String getNodeStatusColor(String status) {
-  if (status == "active") return "COLOR_VIVID_PUR";
-  if (status == "idle") return "COLOR_SUNRISE";
-  if (status == "offline") return "COLOR_HOT_PINK";
-  return "COLOR_WHITE";
+uint16_t getNodeStatusColor(NodeStatus status) {
+  return NODE_STATUS_COLORS[status];
 }
 
-String getHealthIndicator(bool healthy) {
+const char* getHealthIndicator(bool healthy) {
   return healthy ? "🟢" : "🟡";
 }
 
@@ -0,0 +1,296 @@
+#ifndef EVENT_BUS_H
+#define EVENT_BUS_H
+
+/*
+ * ═══════════════════════════════════════════════════════════════════════
+ * BLACKROAD EVENT BUS - typed change events between subsystems
+ * ═══════════════════════════════════════════════════════════════════════
+ *
+ * Producers say what changed instead of poking each other's globals:
+ *
+ *   producer  context        publishes
+ *   ui        loop()         alert raised/cleared, app badges (serial, touch)
+ *   net       net task       snapshot published, nav/mesh/crm/leads/ai changed
+ *
+ * Every producer owns one lock-free single-producer/single-consumer ring
+ * of fixed 12-byte records, so publishing is a store and an atomic index
+ * bump from any task - no mutex, no heap. busDispatch() in loop() drains
+ * the rings and calls the topic's subscribers; the UI subscribers only
+ * mark the screen or widget that shows the changed data and loop()
+ * repaints that once per pass.
+ *
+ * A full ring drops the event and flags the producer lost; the next
+ * dispatch delivers one BUS_LOST first so subscribers resync everything.
+ *
+ * Latency is publish -> subscriber call, per producer. BUS prints it with
+ * per-topic counts; BUS BENCH measures raw publish/dispatch cost.
+ */
+
+#include <atomic>
+
+// ─────────────────────────────────────────────────────────────────────
+// CONFIGURATION
+// ─────────────────────────────────────────────────────────────────────
+
+#define BUS_RING_SIZE       32      // events per producer, power of two
+#define BUS_MAX_SUBS        4       // subscribers per topic
+#define BUS_BENCH_BURST     16      // events per publish/dispatch round
+#define BUS_BENCH_DEFAULT   10000
+
+enum BusTopic : uint8_t {
+  BUS_LOST,           // a ring overflowed - resync everything
+  BUS_SNAPSHOT,       // value = snapshot sequence
+  BUS_NAV,            // node/lead/request counts, health flags
+  BUS_MESH,
+  BUS_CRM,
+  BUS_LEADS,
+  BUS_AI,
+  BUS_ALERT_RAISED,   // value = LED pattern
+  BUS_ALERT_CLEARED,
+  BUS_BADGE,          // arg = app index, value = badge
+  BUS_BENCH,
+  BUS_TOPIC_COUNT
+};
+
+enum BusProducer : uint8_t {
+  BUS_FROM_UI,
+  BUS_FROM_NET,
+  BUS_PRODUCER_COUNT
+};
+
+const char* const BUS_TOPIC_NAMES[BUS_TOPIC_COUNT] = {
+  "lost", "snapshot", "nav", "mesh", "crm", "leads", "ai",
+  "raised", "cleared", "badge", "bench"
+};
+const char* const BUS_PRODUCER_NAMES[BUS_PRODUCER_COUNT] = { "ui", "net" };
+
+// ─────────────────────────────────────────────────────────────────────
+// EVENTS + RINGS
+// ─────────────────────────────────────────────────────────────────────
+
+struct BusEvent {
+  uint8_t topic;
+  uint8_t producer;
+  uint16_t arg;
+  int32_t value;
+  uint32_t us;          // micros() at publish
+};
+
+typedef void (*BusHandler)(const BusEvent& e);
+
+struct BusRing {
+  BusEvent events[BUS_RING_SIZE];
+  std::atomic<uint8_t> head;   // written by the producer only (free running)
+  std::atomic<uint8_t> tail;   // written by busDispatch() only
+};
+
+// Written by the producer
+struct BusPublishStats {
+  uint32_t published;
+  uint32_t dropped;     // ring full
+};
+
+// Written by busDispatch()
+struct BusDeliverStats {
+  uint32_t delivered;
+  uint32_t latencySumUs;
+  uint32_t maxLatencyUs;
+  uint8_t maxQueued;
+};
+
+// What the UI did with the events (main.cpp)
+struct BusInvalidateStats {
+  uint32_t screens;     // full repaints caused by events
+  uint32_t widgets;     // single widgets repainted
+  uint32_t ignored;     // data not on the current screen
+  uint32_t stale;       // a full repaint already showed it
+};
+
+struct BusBenchResult {
+  uint32_t events;
+  uint32_t publishNs;   // per event
+  uint32_t dispatchNs;  // per event, subscriber call included
+  uint32_t perSecond;
+  uint32_t maxLatencyUs;
+};
+
+BusRing busRings[BUS_PRODUCER_COUNT];
+BusHandler busSubs[BUS_TOPIC_COUNT][BUS_MAX_SUBS];
+std::atomic<uint8_t> busLostMask(0);   // bit per producer
+
+BusPublishStats busPublishStats[BUS_PRODUCER_COUNT];
+BusDeliverStats busDeliverStats[BUS_PRODUCER_COUNT];
+uint32_t busTopicCounts[BUS_TOPIC_COUNT];
+BusInvalidateStats busInvalidateStats;
+BusBenchResult busBench;
+
+// ─────────────────────────────────────────────────────────────────────
+// API
+// ─────────────────────────────────────────────────────────────────────
+
+bool busSubscribe(BusTopic topic, BusHandler fn) {
+  for (int i = 0; i < BUS_MAX_SUBS; i++) {
+    if (busSubs[topic][i] == fn) return true;
+    if (busSubs[topic][i]) continue;
+    busSubs[topic][i] = fn;
+    return true;
+  }
+  return false;
+}
+
+uint8_t busQueued(BusProducer p) {
+  const BusRing& r = busRings[p];
+  return (uint8_t)(r.head.load(std::memory_order_acquire) - r.tail.load(std::memory_order_acquire));
+}
+
+// Only ever call with the producer the current task owns
+bool busPublish(BusProducer p, BusTopic topic, uint16_t arg = 0, int32_t value = 0) {
+  BusRing& r = busRings[p];
+  uint8_t head = r.head.load(std::memory_order_relaxed);
+  if ((uint8_t)(head - r.tail.load(std::memory_order_acquire)) >= BUS_RING_SIZE) {
+    busPublishStats[p].dropped++;
+    busLostMask.fetch_or(1 << p);
+    return false;
+  }
+
+  BusEvent& e = r.events[head & (BUS_RING_SIZE - 1)];
+  e.topic = topic;
+  e.producer = p;
+  e.arg = arg;
+  e.value = value;
+  e.us = micros();
+  r.head.store((uint8_t)(head + 1), std::memory_order_release);
+  busPublishStats[p].published++;
+  return true;
+}
+
+// ─────────────────────────────────────────────────────────────────────
+// DISPATCH (loop() only)
+// ─────────────────────────────────────────────────────────────────────
+
+void busDeliver(const BusEvent& e) {
+  busTopicCounts[e.topic]++;
+  for (int i = 0; i < BUS_MAX_SUBS && busSubs[e.topic][i]; i++) busSubs[e.topic][i](e);
+}
+
+// Drain every ring in publish order per producer; returns events delivered
+uint32_t busDispatch() {
+  uint32_t n = 0;
+
+  uint8_t lost = busLostMask.exchange(0);
+  for (uint8_t p = 0; p < BUS_PRODUCER_COUNT; p++) {
+    if (!(lost & (1 << p))) continue;
+    BusEvent e = { BUS_LOST, p, 0, 0, (uint32_t)micros() };
+    busDeliver(e);
+  }
+
+  for (uint8_t p = 0; p < BUS_PRODUCER_COUNT; p++) {
+    BusRing& r = busRings[p];
+    BusDeliverStats& s = busDeliverStats[p];
+    uint8_t tail = r.tail.load(std::memory_order_relaxed);
+    uint8_t head = r.head.load(std::memory_order_acquire);
+    if ((uint8_t)(head - tail) > s.maxQueued) s.maxQueued = head - tail;
+
+    // Only what was queued on entry: events published by subscribers wait a pass
+    while (tail != head) {
+      BusEvent e = r.events[tail & (BUS_RING_SIZE - 1)];
+      tail++;
+      r.tail.store(tail, std::memory_order_release);   // slot is free once copied
+
+      uint32_t us = micros() - e.us;
+      s.delivered++;
+      s.latencySumUs += us;
+      if (us > s.maxLatencyUs) s.maxLatencyUs = us;
+      busDeliver(e);
+      n++;
+    }
+  }
+  return n;
+}
+
+// ─────────────────────────────────────────────────────────────────────
+// BENCHMARK
+// ─────────────────────────────────────────────────────────────────────
+
+uint32_t busBenchSeen = 0;
+
+void busBenchHandler(const BusEvent& e) {
+  busBenchSeen += e.value;
+}
+
+// Publish/dispatch `events` BUS_BENCH events in bursts on the UI ring
+void runBusBench(uint32_t events) {
+  busSubscribe(BUS_BENCH, busBenchHandler);
+  busDispatch();   // start from an empty ring
+  BusPublishStats savedPublish = busPublishStats[BUS_FROM_UI];   // keep real traffic stats clean
+  BusDeliverStats savedDeliver = busDeliverStats[BUS_FROM_UI];
+  busDeliverStats[BUS_FROM_UI].maxLatencyUs = 0;
+
+  uint32_t publishUs = 0, dispatchUs = 0;
+  busBenchSeen = 0;
+  for (uint32_t sent = 0; sent < events; ) {
+    uint32_t burst = events - sent < BUS_BENCH_BURST ? events - sent : BUS_BENCH_BURST;
+    uint32_t t0 = micros();
+    for (uint32_t i = 0; i < burst; i++) busPublish(BUS_FROM_UI, BUS_BENCH, i, 1);
+    uint32_t t1 = micros();
+    busDispatch();
+    uint32_t t2 = micros();
+    publishUs += t1 - t0;
+    dispatchUs += t2 - t1;
+    sent += burst;
+  }
+
+  busBench.events = busBenchSeen;
+  busBench.publishNs = events ? (uint32_t)((uint64_t)publishUs * 1000 / events) : 0;
+  busBench.dispatchNs = events ? (uint32_t)((uint64_t)dispatchUs * 1000 / events) : 0;
+  busBench.perSecond = publishUs + dispatchUs ? (uint32_t)((uint64_t)events * 1000000 / (publishUs + dispatchUs)) : 0;
+  busBench.maxLatencyUs = busDeliverStats[BUS_FROM_UI].maxLatencyUs;
+  busPublishStats[BUS_FROM_UI] = savedPublish;
+  busDeliverStats[BUS_FROM_UI] = savedDeliver;
+  busTopicCounts[BUS_BENCH] = 0;
+}
+
+// ─────────────────────────────────────────────────────────────────────
+// REPORT
+// ─────────────────────────────────────────────────────────────────────
+
+void resetBusStats() {
+  for (int p = 0; p < BUS_PRODUCER_COUNT; p++) {
+    memset(&busDeliverStats[p], 0, sizeof(busDeliverStats[p]));
+  }
+  memset(busTopicCounts, 0, sizeof(busTopicCounts));
+  memset(&busInvalidateStats, 0, sizeof(busInvalidateStats));
+}
+
+void printBusReport() {
+  const BusInvalidateStats& v = busInvalidateStats;
+
+  Serial.println("\n━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━");
+  Serial.println("   EVENT BUS");
+  Serial.println("━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━");
+  Serial.printf("   Rings:        %d x %u B events per producer\n", BUS_RING_SIZE, (unsigned)sizeof(BusEvent));
+  for (int p = 0; p < BUS_PRODUCER_COUNT; p++) {
+    const BusPublishStats& ps = busPublishStats[p];
+    const BusDeliverStats& d = busDeliverStats[p];
+    char label[16];
+    snprintf(label, sizeof(label), "From %s:", BUS_PRODUCER_NAMES[p]);
+    Serial.printf("   %-14s%u published, %u delivered, %u dropped, %u/%u queued\n",
+                  label, ps.published, d.delivered, ps.dropped, busQueued((BusProducer)p), d.maxQueued);
+    Serial.printf("                 latency %u us avg, %u us max\n",
+                  d.delivered ? d.latencySumUs / d.delivered : 0, d.maxLatencyUs);
+  }
+  Serial.print("   Topics:      ");
+  for (int t = 0; t < BUS_TOPIC_COUNT; t++) {
+    if (busTopicCounts[t]) Serial.printf(" %s %u", BUS_TOPIC_NAMES[t], busTopicCounts[t]);
+  }
+  Serial.println();
+  Serial.printf("   Invalidate:   %u screens, %u widgets, %u off-screen, %u stale\n",
+                v.screens, v.widgets, v.ignored, v.stale);
+  if (busBench.events) {
+    Serial.printf("   Bench:        %u events, publish %u ns, dispatch %u ns, %u events/s, %u us max\n",
+                  busBench.events, busBench.publishNs, busBench.dispatchNs, busBench.perSecond, busBench.maxLatencyUs);
+  }
+  Serial.println("━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━\n");
+}
+
+#endif // EVENT_BUS_H
@@ -0,0 +1,391 @@
+#ifndef FEEDBACK_H
+#define FEEDBACK_H
+
+/*
+ * ═══════════════════════════════════════════════════════════════════════
+ * BLACKROAD FEEDBACK - non-blocking LED + buzzer patterns
+ * ═══════════════════════════════════════════════════════════════════════
+ *
+ * Every blink and beep is a table of steps (level, duration) played by a
+ * sequencer that runs off an esp_timer, so nothing that signals the user
+ * ever delay()s loop(). Both outputs are LEDC channels: the LED is PWM
+ * (ramp steps fade it in FEEDBACK_RAMP_MS increments), the buzzer an LEDC
+ * tone that keeps sounding while the CPU does other work.
+ *
+ * The LED and the buzzer are separate voices. A pattern starts on its
+ * voice if its priority is at least that of the pattern playing, which
+ * it cuts off; lower priority requests are dropped and counted. loop()
+ * only posts requests - the timer callback is the single writer of voice
+ * state and pins.
+ *
+ * FEEDBACK shows plays/preemptions/drops per voice and the worst loop()
+ * pass while a pattern was playing. FEEDBACK_HW_TIMER=0 (host build) runs
+ * the sequencer from feedbackService() in loop() instead.
+ *
+ * GPIO 2 is TFT_DC and GPIO 25 the XPT2046 clock on this board, so the
+ * LED is the red channel of the RGB LED and the buzzer the speaker pin.
+ */
+
+#include <atomic>
+
+// ─────────────────────────────────────────────────────────────────────
+// CONFIGURATION
+// ─────────────────────────────────────────────────────────────────────
+
+#ifndef FEEDBACK_HW_TIMER
+#ifdef HOST_BUILD
+#define FEEDBACK_HW_TIMER 0
+#else
+#define FEEDBACK_HW_TIMER 1
+#endif
+#endif
+
+#if FEEDBACK_HW_TIMER
+#include <esp_timer.h>
+#endif
+
+#define LED_PIN                  4      // RGB LED, red
+#define LED_ACTIVE_LOW           1
+#define BUZZER_PIN               26     // speaker connector
+#define FEEDBACK_LED_CHANNEL     0      // LEDC timer 0
+#define FEEDBACK_BUZZER_CHANNEL  2      // LEDC timer 1 (tone changes its frequency)
+#define FEEDBACK_LED_FREQ        5000
+#define FEEDBACK_LED_BITS        8
+#define FEEDBACK_RAMP_MS         20
+
+#define FB_RAMP             0x8000      // step flag: fade from the previous level
+#define FB_ONCE             0
+#define FB_UNTIL_STOPPED    0xFFFF
+
+// ─────────────────────────────────────────────────────────────────────
+// PATTERNS
+// ─────────────────────────────────────────────────────────────────────
+
+enum FeedbackVoice : uint8_t {
+  FB_LED,
+  FB_BUZZER,
+  FB_VOICES
+};
+
+enum FeedbackPatternId : uint8_t {
+  FB_BEEP,
+  FB_BEEP_LONG,
+  FB_SUCCESS,
+  FB_CRITICAL,
+  FB_LOCAL_WARNING,
+  FB_LOCAL_CRITICAL,
+  FB_LOCAL_FLASH,
+  FB_HEARTBEAT,
+  FB_FAST_STROBE,
+  FB_MEDIUM_BLINK,
+  FB_SLOW_BLINK,
+  FB_DOUBLE_FLASH,
+  FB_MORSE_SOS,
+  FB_PATTERN_COUNT
+};
+
+struct FeedbackStep {
+  uint16_t level;     // LED duty 0-255 / buzzer Hz, 0 = off
+  uint16_t ms;        // | FB_RAMP
+};
+
+struct FeedbackPattern {
+  const char* name;
+  FeedbackVoice voice;
+  uint8_t priority;             // 1 = lowest
+  const FeedbackStep* steps;
+  uint8_t count;
+  uint16_t repeatMs;            // start another pass while younger than this
+};
+
+// UI sounds
+const FeedbackStep FB_STEPS_BEEP[] = { { 2000, 50 } };
+const FeedbackStep FB_STEPS_BEEP_LONG[] = { { 2000, 100 } };
+const FeedbackStep FB_STEPS_SUCCESS[] = { { 1500, 50 }, { 0, 10 }, { 2000, 50 } };
+const FeedbackStep FB_STEPS_CRITICAL[] = { { 3000, 30 }, { 0, 10 }, { 3000, 30 }, { 0, 10 }, { 3000, 30 } };
+
+// Infrastructure alerts (alerts.h)
+const FeedbackStep FB_STEPS_LOCAL_WARNING[] = { { 2500, 200 }, { 0, 100 }, { 2500, 200 } };
+const FeedbackStep FB_STEPS_LOCAL_CRITICAL[] = {
+  { 2500, 500 }, { 0, 200 }, { 2500, 500 }, { 0, 200 }, { 2500, 500 }
+};
+const FeedbackStep FB_STEPS_LOCAL_FLASH[] = { { 255, 100 }, { 0, 100 } };
+
+// Emergency pager
+const FeedbackStep FB_STEPS_HEARTBEAT[] = { { 255, 1020 | FB_RAMP }, { 0, 1020 | FB_RAMP } };
+const FeedbackStep FB_STEPS_FAST_STROBE[] = { { 255, 50 }, { 0, 50 } };
+const FeedbackStep FB_STEPS_MEDIUM_BLINK[] = { { 255, 200 }, { 0, 200 } };
+const FeedbackStep FB_STEPS_SLOW_BLINK[] = { { 255, 500 }, { 0, 500 } };
+const FeedbackStep FB_STEPS_DOUBLE_FLASH[] = { { 255, 100 }, { 0, 100 }, { 255, 100 }, { 0, 200 } };
+const FeedbackStep FB_STEPS_MORSE_SOS[] = {
+  { 255, 200 }, { 0, 200 }, { 255, 200 }, { 0, 200 }, { 255, 200 }, { 0, 600 },    // S
+  { 255, 600 }, { 0, 200 }, { 255, 600 }, { 0, 200 }, { 255, 600 }, { 0, 600 },    // O
+  { 255, 200 }, { 0, 200 }, { 255, 200 }, { 0, 200 }, { 255, 200 }, { 0, 2200 }    // S + pause
+};
+
+#define FB_STEPS(a) a, sizeof(a) / sizeof(a[0])
+
+const FeedbackPattern FEEDBACK_PATTERNS[FB_PATTERN_COUNT] = {
+  { "beep",           FB_BUZZER, 1, FB_STEPS(FB_STEPS_BEEP),           FB_ONCE },
+  { "beep-long",      FB_BUZZER, 1, FB_STEPS(FB_STEPS_BEEP_LONG),      FB_ONCE },
+  { "success",        FB_BUZZER, 1, FB_STEPS(FB_STEPS_SUCCESS),        FB_ONCE },
+  { "critical",       FB_BUZZER, 2, FB_STEPS(FB_STEPS_CRITICAL),       FB_ONCE },
+  { "local-warning",  FB_BUZZER, 3, FB_STEPS(FB_STEPS_LOCAL_WARNING),  FB_ONCE },
+  { "local-critical", FB_BUZZER, 4, FB_STEPS(FB_STEPS_LOCAL_CRITICAL), FB_ONCE },
+  { "local-flash",    FB_LED,    2, FB_STEPS(FB_STEPS_LOCAL_FLASH),    1000 },
+  { "heartbeat",      FB_LED,    1, FB_STEPS(FB_STEPS_HEARTBEAT),      FB_ONCE },
+  { "fast-strobe",    FB_LED,    5, FB_STEPS(FB_STEPS_FAST_STROBE),    10000 },
+  { "medium-blink",   FB_LED,    4, FB_STEPS(FB_STEPS_MEDIUM_BLINK),   8000 },
+  { "slow-blink",     FB_LED,    3, FB_STEPS(FB_STEPS_SLOW_BLINK),     5000 },
+  { "double-flash",   FB_LED,    3, FB_STEPS(FB_STEPS_DOUBLE_FLASH),   8000 },
+  { "morse-sos",      FB_LED,    6, FB_STEPS(FB_STEPS_MORSE_SOS),      FB_UNTIL_STOPPED },
+};
+
+// ─────────────────────────────────────────────────────────────────────
+// STATE
+// ─────────────────────────────────────────────────────────────────────
+
+#define FB_REQ_STOP  0xFF
+
+// Written by the sequencer only
+struct FeedbackVoiceState {
+  int8_t pattern;       // -1 = idle
+  uint8_t step;
+  uint16_t level;       // last level written to the pin
+  uint16_t fromLevel;   // ramp start
+  uint32_t startMs;
+  uint32_t stepMs;
+};
+
+struct FeedbackStats {
+  uint32_t plays;       // loop()
+  uint32_t dropped;     // loop(): below the priority playing
+  uint32_t preempted;   // sequencer: cut off by a new pattern
+  uint32_t writes;      // sequencer: LEDC updates
+};
+
+// Written by loop()
+struct FeedbackFrameStats {
+  uint32_t frames;      // loop() passes with a pattern playing
+  uint32_t frameSumUs;
+  uint32_t maxFrameUs;
+};
+
+FeedbackVoiceState feedbackVoices[FB_VOICES];
+FeedbackStats feedbackStats[FB_VOICES];
+FeedbackFrameStats feedbackFrameStats;
+std::atomic<uint8_t> feedbackRequest[FB_VOICES];    // pattern + 1, FB_REQ_STOP, 0 = none
+std::atomic<uint8_t> feedbackPriority[FB_VOICES];   // of the pattern playing, 0 = idle
+
+#if FEEDBACK_HW_TIMER
+esp_timer_handle_t feedbackTimer = nullptr;
+#endif
+
+void pagerAckDone();   // app_tasks.h
+
+// ─────────────────────────────────────────────────────────────────────
+// SEQUENCER
+// ─────────────────────────────────────────────────────────────────────
+
+void feedbackWrite(uint8_t voice, uint16_t level) {
+  FeedbackVoiceState& s = feedbackVoices[voice];
+  if (level == s.level) return;
+  s.level = level;
+  feedbackStats[voice].writes++;
+  if (voice == FB_LED) ledcWrite(FEEDBACK_LED_CHANNEL, LED_ACTIVE_LOW ? 255 - level : level);
+  else ledcWriteTone(FEEDBACK_BUZZER_CHANNEL, level);   // 0 Hz = silent
+}
+
+void feedbackFinish(uint8_t voice) {
+  FeedbackVoiceState& s = feedbackVoices[voice];
+  if (s.pattern >= 0) {
+    // Leave a priority loop() raised for a newer request alone
+    uint8_t playing = FEEDBACK_PATTERNS[s.pattern].priority;
+    feedbackPriority[voice].compare_exchange_strong(playing, 0);
+  }
+  s.pattern = -1;
+  feedbackWrite(voice, 0);
+}
+
+// Run a voice up to `now`; ms until it needs to run again, -1 when idle
+int32_t feedbackRunVoice(uint8_t voice, uint32_t now) {
+  FeedbackVoiceState& s = feedbackVoices[voice];
+
+  uint8_t req = feedbackRequest[voice].exchange(0);
+  if (req == FB_REQ_STOP) {
+    feedbackFinish(voice);
+    if (voice == FB_LED) pagerAckDone();
+  } else if (req) {
+    if (s.pattern >= 0) feedbackStats[voice].preempted++;
+    s.pattern = req - 1;
+    s.step = 0;
+    s.startMs = s.stepMs = now;
+    s.fromLevel = s.level;
+    feedbackPriority[voice].store(FEEDBACK_PATTERNS[s.pattern].priority);
+  }
+  if (s.pattern < 0) return -1;
+
+  // Skip over finished steps, keeping the pattern's phase
+  const FeedbackPattern& p = FEEDBACK_PATTERNS[s.pattern];
+  uint32_t stepLen = p.steps[s.step].ms & ~FB_RAMP;
+  while (now - s.stepMs >= stepLen) {
+    s.stepMs += stepLen;
+    s.fromLevel = p.steps[s.step].level;
+    if (++s.step == p.count) {
+      bool again = p.repeatMs == FB_UNTIL_STOPPED || s.stepMs - s.startMs < p.repeatMs;
+      if (!again) {
+        feedbackFinish(voice);
+        return -1;
+      }
+      s.step = 0;
+    }
+    stepLen = p.steps[s.step].ms & ~FB_RAMP;
+  }
+
+  const FeedbackStep& st = p.steps[s.step];
+  uint32_t into = now - s.stepMs;
+  int32_t wait = stepLen - into;
+  if (st.ms & FB_RAMP) {
+    int32_t delta = (int32_t)st.level - s.fromLevel;
+    feedbackWrite(voice, s.fromLevel + delta * (int32_t)into / (int32_t)stepLen);
+    if (wait > FEEDBACK_RAMP_MS) wait = FEEDBACK_RAMP_MS;
+  } else {
+    feedbackWrite(voice, st.level);
+  }
+  return wait;
+}
+
+// ms until the sequencer needs to run again, -1 when both voices are idle
+int32_t feedbackRun() {
+  uint32_t now = millis();
+  int32_t next = -1;
+  for (uint8_t v = 0; v < FB_VOICES; v++) {
+    int32_t wait = feedbackRunVoice(v, now);
+    if (wait >= 0 && (next < 0 || wait < next)) next = wait;
+  }
+  return next;
+}
+
+#if FEEDBACK_HW_TIMER
+void feedbackTimerFired(void*) {
+  int32_t ms = feedbackRun();
+  // Fails harmlessly if feedbackKick() re-armed us meanwhile
+  if (ms >= 0) esp_timer_start_once(feedbackTimer, (uint64_t)ms * 1000);
+}
+#endif
+
+// Have the sequencer pick up a request now
+void feedbackKick() {
+#if FEEDBACK_HW_TIMER
+  esp_timer_stop(feedbackTimer);
+  while (esp_timer_start_once(feedbackTimer, 0) == ESP_ERR_INVALID_STATE) esp_timer_stop(feedbackTimer);
+#else
+  feedbackRun();
+#endif
+}
+
+// Without the hardware timer, loop() steps the sequencer
+void feedbackService() {
+#if !FEEDBACK_HW_TIMER
+  for (uint8_t v = 0; v < FB_VOICES; v++) {
+    if (feedbackVoices[v].pattern >= 0) {
+      feedbackRun();
+      return;
+    }
+  }
+#endif
+}
+
+// ─────────────────────────────────────────────────────────────────────
+// API (loop())
+// ─────────────────────────────────────────────────────────────────────
+
+bool feedbackPlay(uint8_t pattern) {
+  const FeedbackPattern& p = FEEDBACK_PATTERNS[pattern];
+  if (p.priority < feedbackPriority[p.voice].load()) {
+    feedbackStats[p.voice].dropped++;
+    return false;
+  }
+  feedbackPriority[p.voice].store(p.priority);
+  feedbackRequest[p.voice].store(pattern + 1);
+  feedbackStats[p.voice].plays++;
+  feedbackKick();
+  return true;
+}
+
+void feedbackStop(uint8_t voice) {
+  feedbackRequest[voice].store(FB_REQ_STOP);
+  feedbackKick();
+}
+
+bool feedbackPlaying() {
+  return feedbackPriority[FB_LED].load() || feedbackPriority[FB_BUZZER].load();
+}
+
+// loop() pass that ran while a pattern was playing (uiFrameDone)
+void feedbackFrame(uint32_t us) {
+  feedbackFrameStats.frames++;
+  feedbackFrameStats.frameSumUs += us;
+  if (us > feedbackFrameStats.maxFrameUs) feedbackFrameStats.maxFrameUs = us;
+}
+
+int feedbackFind(const char* name) {
+  for (int i = 0; i < FB_PATTERN_COUNT; i++) {
+    if (!strcasecmp(name, FEEDBACK_PATTERNS[i].name)) return i;
+  }
+  return -1;
+}
+
+void initFeedback() {
+  for (uint8_t v = 0; v < FB_VOICES; v++) {
+    feedbackVoices[v].pattern = -1;
+    feedbackVoices[v].level = 1;   // force the first write
+  }
+  ledcSetup(FEEDBACK_LED_CHANNEL, FEEDBACK_LED_FREQ, FEEDBACK_LED_BITS);
+  ledcAttachPin(LED_PIN, FEEDBACK_LED_CHANNEL);
+  ledcSetup(FEEDBACK_BUZZER_CHANNEL, 2000, 8);
+  ledcAttachPin(BUZZER_PIN, FEEDBACK_BUZZER_CHANNEL);
+  feedbackWrite(FB_LED, 0);
+  feedbackWrite(FB_BUZZER, 0);
+
+#if FEEDBACK_HW_TIMER
+  esp_timer_create_args_t args = {};
+  args.callback = feedbackTimerFired;
+  args.name = "feedback";
+  esp_timer_create(&args, &feedbackTimer);
+#endif
+}
+
+// ─────────────────────────────────────────────────────────────────────
+// REPORT
+// ─────────────────────────────────────────────────────────────────────
+
+void resetFeedbackStats() {
+  memset(feedbackStats, 0, sizeof(feedbackStats));
+  memset(&feedbackFrameStats, 0, sizeof(feedbackFrameStats));
+}
+
+void printFeedbackReport() {
+  static const char* const VOICE_NAMES[FB_VOICES] = { "LED:", "Buzzer:" };
+  const FeedbackFrameStats& f = feedbackFrameStats;
+
+  Serial.println("\n━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━");
+  Serial.println("   FEEDBACK (LED + buzzer sequencer)");
+  Serial.println("━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━");
+  Serial.printf("   Engine:       %s\n", FEEDBACK_HW_TIMER ? "esp_timer + LEDC" : "loop() (feedbackService)");
+  for (uint8_t v = 0; v < FB_VOICES; v++) {
+    const FeedbackStats& s = feedbackStats[v];
+    int8_t playing = feedbackVoices[v].pattern;
+    Serial.printf("   %-13s %s, %u plays, %u preempted, %u dropped, %u writes\n", VOICE_NAMES[v],
+                  playing >= 0 ? FEEDBACK_PATTERNS[playing].name : "idle",
+                  s.plays, s.preempted, s.dropped, s.writes);
+  }
+  Serial.printf("   loop() pass:  %u us avg, %u us max while playing (%u passes)\n",
+                f.frames ? f.frameSumUs / f.frames : 0, f.maxFrameUs, f.frames);
+  Serial.print("   Patterns:    ");
+  for (int i = 0; i < FB_PATTERN_COUNT; i++) Serial.printf(" %s", FEEDBACK_PATTERNS[i].name);
+  Serial.println();
+  Serial.println("━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━\n");
+}
+
+#endif // FEEDBACK_H
@@ -4,6 +4,7 @@
 #include <SPIFFS.h>
 #include <FS.h>
 #include <HTTPClient.h>
+#include "heap_trace.h"
 
 /*
  * BlackRoad OS - Operator Device File System
@@ -48,6 +49,7 @@ bool initFileSystem() {
 
 // List all files in SPIFFS
 void listFiles(const char* dirname = "/", uint8_t levels = 3) {
+  HeapTag tag(HEAP_TAG_FS);
   Serial.printf("\n📂 Listing files in: %s\n", dirname);
   Serial.println("━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━");
 
@@ -86,6 +88,7 @@ void listFiles(const char* dirname = "/", uint8_t levels = 3) {
 
 // Write file to SPIFFS
 bool writeFile(const char* path, const char* content) {
+  HeapTag tag(HEAP_TAG_FS);
   Serial.printf("💾 Writing file: %s\n", path);
 
   File file = SPIFFS.open(path, FILE_WRITE);
@@ -103,6 +106,7 @@ bool writeFile(const char* path, const char* content) {
 
 // Read file from SPIFFS
 String readFile(const char* path) {
+  HeapTag tag(HEAP_TAG_FS);
   File file = SPIFFS.open(path);
   if (!file || file.isDirectory()) {
     Serial.printf("❌ Failed to open file: %s\n", path);
@@ -147,6 +151,7 @@ bool createDir(const char* path) {
 
 // Download file from URL and save to SPIFFS
 bool downloadFile(const char* url, const char* path) {
+  HeapTag tag(HEAP_TAG_FS);
   Serial.printf("⬇️  Downloading: %s\n", url);
   Serial.printf("   Saving to: %s\n", path);
 
@@ -204,6 +209,7 @@ bool formatFileSystem() {
 
 // Sync project files from development machine
 bool syncProjectFiles() {
+  HeapTag tag(HEAP_TAG_FS);
   Serial.println("\n🔄 Syncing Project Files...");
   Serial.println("━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━");
 
@@ -224,6 +230,7 @@ bool syncProjectFiles() {
 
 // Export file system contents as JSON
 String exportFileSystemJSON() {
+  HeapTag tag(HEAP_TAG_FS);
   String json = "{\"files\":[";
 
   File root = SPIFFS.open("/");
@@ -0,0 +1,228 @@
+#ifndef FIXED_STRING_H
+#define FIXED_STRING_H
+
+/*
+ * ═══════════════════════════════════════════════════════════════════════
+ * BLACKROAD FIXED STRINGS - text without the heap
+ * ═══════════════════════════════════════════════════════════════════════
+ *
+ * Arduino String keeps 10 chars inline and mallocs past that - on every
+ * copy, concat and substring. Those short-lived blocks are what chops the
+ * heap up (performance.h fragmentation). The serial, alert, nav and perf
+ * paths use these instead:
+ *
+ *   StrView          pointer + length into someone else's text; compare,
+ *                    trim and slice without copying (not NUL-terminated -
+ *                    print with "%.*s", (int)v.length(), v.data())
+ *   FixedString<N>   N-byte inline buffer (N-1 chars); appends and
+ *                    appendf() truncate instead of growing, truncated()
+ *                    says so. Plain value: structs holding one copy with
+ *                    memcpy semantics (nav snapshots, alert cache)
+ *   strfmt(buf, ...) snprintf into a caller buffer and return it, for
+ *                    formatting straight into printf/draw arguments
+ *
+ * host build: pio run -e native && program --alloc-check counts operator
+ * new per loop() pass, serial command and nav refresh (host/README.md).
+ */
+
+#include <Arduino.h>
+#include <stdarg.h>
+
+// ─────────────────────────────────────────────────────────────────────
+// STRING VIEW
+// ─────────────────────────────────────────────────────────────────────
+
+class StrView {
+public:
+  StrView() : p(""), n(0) {}
+  StrView(const char* s) : p(s ? s : ""), n(s ? strlen(s) : 0) {}
+  StrView(const char* s, size_t len) : p(s), n(len) {}
+
+  const char* data() const { return p; }
+  size_t length() const { return n; }
+  bool isEmpty() const { return n == 0; }
+  char operator[](size_t i) const { return i < n ? p[i] : '\0'; }
+
+  bool operator==(StrView o) const { return n == o.n && memcmp(p, o.p, n) == 0; }
+  bool operator!=(StrView o) const { return !(*this == o); }
+  bool startsWith(StrView o) const { return n >= o.n && memcmp(p, o.p, o.n) == 0; }
+  bool endsWith(StrView o) const { return n >= o.n && memcmp(p + n - o.n, o.p, o.n) == 0; }
+
+  // Position of `c` at or after `from`, -1 if absent (String::indexOf)
+  int indexOf(char c, size_t from = 0) const {
+    for (size_t i = from; i < n; i++) {
+      if (p[i] == c) return (int)i;
+    }
+    return -1;
+  }
+
+  // [from, to) clamped to the view - never reads past it
+  StrView substring(size_t from, size_t to = (size_t)-1) const {
+    if (to > n) to = n;
+    if (from > to) from = to;
+    return StrView(p + from, to - from);
+  }
+
+  StrView trim() const {
+    size_t a = 0, b = n;
+    while (a < b && isspace((unsigned char)p[a])) a++;
+    while (b > a && isspace((unsigned char)p[b - 1])) b--;
+    return StrView(p + a, b - a);
+  }
+
+  // Leading [+-]digits, 0 if none (String::toInt, without the copy)
+  long toInt() const {
+    size_t i = 0;
+    while (i < n && isspace((unsigned char)p[i])) i++;
+    bool neg = i < n && p[i] == '-';
+    if (i < n && (p[i] == '-' || p[i] == '+')) i++;
+    long v = 0;
+    for (; i < n && isdigit((unsigned char)p[i]); i++) v = v * 10 + (p[i] - '0');
+    return neg ? -v : v;
+  }
+
+  // NUL-terminated copy into buf (truncates); returns buf
+  char* copyTo(char* buf, size_t size) const {
+    if (!size) return buf;
+    size_t k = n < size - 1 ? n : size - 1;
+    memcpy(buf, p, k);
+    buf[k] = '\0';
+    return buf;
+  }
+
+private:
+  const char* p;
+  size_t n;
+};
+
+// ─────────────────────────────────────────────────────────────────────
+// FIXED-CAPACITY STRING
+// ─────────────────────────────────────────────────────────────────────
+
+template <size_t N>
+class FixedString {
+public:
+  FixedString() { clear(); }
+  FixedString(const char* s) { clear(); append(s); }   // brace-initialized tables
+  FixedString(StrView s) { clear(); append(s); }
+
+  FixedString& operator=(const char* s) { return *this = StrView(s); }
+  FixedString& operator=(StrView s) {
+    if (s.data() == buf) return *this;   // self-assignment through the view
+    clear();
+    return append(s);
+  }
+
+  void clear() {
+    len = 0;
+    cut = false;
+    buf[0] = '\0';
+  }
+
+  FixedString& append(StrView s) {
+    size_t room = N - 1 - len;
+    size_t k = s.length() < room ? s.length() : room;
+    if (k < s.length()) cut = true;
+    memmove(buf + len, s.data(), k);
+    len += k;
+    buf[len] = '\0';
+    return *this;
+  }
+
+  FixedString& append(char c) {
+    if (len < N - 1) {
+      buf[len++] = c;
+      buf[len] = '\0';
+    } else {
+      cut = true;
+    }
+    return *this;
+  }
+
+  FixedString& operator+=(StrView s) { return append(s); }
+  FixedString& operator+=(char c) { return append(c); }
+
+  FixedString& appendf(const char* fmt, ...) __attribute__((format(printf, 2, 3))) {
+    va_list args;
+    va_start(args, fmt);
+    appendv(fmt, args);
+    va_end(args);
+    return *this;
+  }
+
+  FixedString& format(const char* fmt, ...) __attribute__((format(printf, 2, 3))) {
+    clear();
+    va_list args;
+    va_start(args, fmt);
+    appendv(fmt, args);
+    va_end(args);
+    return *this;
+  }
+
+  FixedString& appendv(const char* fmt, va_list args) {
+    int k = vsnprintf(buf + len, N - len, fmt, args);
+    if (k < 0) {
+      buf[len] = '\0';
+    } else if ((size_t)k >= N - len) {
+      len = N - 1;
+      cut = true;
+    } else {
+      len += k;
+    }
+    return *this;
+  }
+
+  void toUpperCase() {
+    for (size_t i = 0; i < len; i++) buf[i] = toupper((unsigned char)buf[i]);
+  }
+
+  void trim() {
+    StrView t = view().trim();
+    memmove(buf, t.data(), t.length());
+    len = t.length();
+    buf[len] = '\0';
+  }
+
+  const char* c_str() const { return buf; }
+  size_t length() const { return len; }
+  bool isEmpty() const { return len == 0; }
+  bool truncated() const { return cut; }
+  static size_t capacity() { return N - 1; }
+
+  StrView view() const { return StrView(buf, len); }
+  operator StrView() const { return view(); }
+
+  bool operator==(StrView o) const { return view() == o; }
+  bool operator!=(StrView o) const { return view() != o; }
+  bool startsWith(StrView o) const { return view().startsWith(o); }
+  bool endsWith(StrView o) const { return view().endsWith(o); }
+  int indexOf(char c, size_t from = 0) const { return view().indexOf(c, from); }
+  StrView substring(size_t from, size_t to = (size_t)-1) const { return view().substring(from, to); }
+
+private:
+  char buf[N];
+  size_t len;
+  bool cut;
+};
+
+// ─────────────────────────────────────────────────────────────────────
+// HELPERS
+// ─────────────────────────────────────────────────────────────────────
+
+// snprintf into a caller buffer, returning it:
+//   char up[16]; Serial.printf("%s", formatUptime(up, sizeof(up)));
+inline char* strfmt(char* buf, size_t size, const char* fmt, ...) __attribute__((format(printf, 3, 4)));
+inline char* strfmt(char* buf, size_t size, const char* fmt, ...) {
+  va_list args;
+  va_start(args, fmt);
+  vsnprintf(buf, size, fmt, args);
+  va_end(args);
+  return buf;
+}
+
+// NUL-safe C string compare (static tables may hold nullptr)
+inline bool strEq(const char* a, const char* b) {
+  return a && b ? strcmp(a, b) == 0 : a == b;
+}
+
+#endif // FIXED_STRING_H
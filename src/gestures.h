@@ -0,0 +1,343 @@
+#ifndef GESTURES_H
+#define GESTURES_H
+
+/*
+ * ═══════════════════════════════════════════════════════════════════════
+ * BLACKROAD GESTURES - streaming recognizer over touch events
+ * ═══════════════════════════════════════════════════════════════════════
+ *
+ * Fed with every DOWN/MOVE/UP from the touch queue (touch_input.h) and
+ * ticked from loop(), it reports each gesture as soon as it is decided
+ * instead of waiting for the finger to lift:
+ *
+ *   DRAG_START   finger left the GESTURE_SLOP_PX circle      (while down)
+ *   DRAG         every move after that, with velocity        (while down)
+ *   EDGE_BACK    started at the left edge, pulled right far  (while down)
+ *   LONG_PRESS   held inside the slop for GESTURE_LONG_PRESS_MS (tick)
+ *   TAP          lifted within GESTURE_TAP_PX of the start before the
+ *                long press, even after a DRAG_START (the old tap box)
+ *   DOUBLE_TAP   second TAP close in time and place (after its TAP)
+ *   FLING        drag lifted faster than GESTURE_FLING_PX_S
+ *   DRAG_END     drag lifted slower than that
+ *
+ * Every gesture carries the stroke start point, travel, velocity and the
+ * time from the stroke's first touch sample, which is what the GESTURES
+ * report and the host gesture trace measure.
+ */
+
+// ─────────────────────────────────────────────────────────────────────
+// CONFIGURATION
+// ─────────────────────────────────────────────────────────────────────
+
+#define GESTURE_SLOP_PX            12    // travel before a touch becomes a drag
+#define GESTURE_TAP_PX             30    // lift this close to the start = tap (was SWIPE_THRESHOLD)
+#define GESTURE_LONG_PRESS_MS      500
+#define GESTURE_DOUBLE_TAP_MS      300   // first UP -> second UP
+#define GESTURE_DOUBLE_TAP_PX      24
+#define GESTURE_FLING_PX_S         600   // release speed
+#define GESTURE_EDGE_PX            12    // left edge zone for swipe-back
+#define GESTURE_EDGE_TRIGGER_PX    40    // rightward travel that commits back
+#define GESTURE_VELOCITY_WINDOW_MS 60    // samples used for velocity
+#define GESTURE_HISTORY            8     // sample ring (>= window / 5 ms)
+#define GESTURE_QUEUE_SIZE         8
+
+// ─────────────────────────────────────────────────────────────────────
+// GESTURES
+// ─────────────────────────────────────────────────────────────────────
+
+enum GestureType : uint8_t {
+  GESTURE_TAP,
+  GESTURE_DOUBLE_TAP,
+  GESTURE_LONG_PRESS,
+  GESTURE_DRAG_START,
+  GESTURE_DRAG,
+  GESTURE_DRAG_END,
+  GESTURE_FLING,
+  GESTURE_EDGE_BACK,
+  GESTURE_TYPE_COUNT
+};
+
+const char* const GESTURE_NAMES[GESTURE_TYPE_COUNT] = {
+  "TAP", "DOUBLE_TAP", "LONG_PRESS", "DRAG_START", "DRAG", "DRAG_END", "FLING", "EDGE_BACK"
+};
+
+struct Gesture {
+  GestureType type;
+  int16_t x, y;       // where the stroke started
+  int16_t dx, dy;     // travel from the start when decided
+  int16_t vx, vy;     // px/s when decided
+  uint32_t startUs;   // first touch sample of the stroke
+  uint32_t irqUs;     // PENIRQ edge of the stroke (input_latency.h)
+  uint32_t us;        // when the gesture was decided
+};
+
+enum GestureState : uint8_t {
+  GSTATE_IDLE,
+  GSTATE_PRESSED,     // down, still inside the slop
+  GSTATE_DRAGGING,
+  GSTATE_EDGE,        // edge stroke that may still become EDGE_BACK
+  GSTATE_DONE         // long press / edge back fired, ignore until UP
+};
+
+struct GestureSample {
+  int16_t x, y;
+  uint32_t us;
+};
+
+struct GestureStats {
+  uint32_t count[GESTURE_TYPE_COUNT];
+  uint32_t latencySumUs[GESTURE_TYPE_COUNT];   // first sample -> decision
+  uint32_t latencyMaxUs[GESTURE_TYPE_COUNT];
+  uint32_t strokes;
+  uint32_t decidedEarly;        // strokes decided before the finger lifted
+  uint32_t earlySumUs;          // ...and by how much
+  uint32_t dropped;             // queue full
+};
+
+GestureStats gestureStats;
+
+GestureState gestureState = GSTATE_IDLE;
+GestureSample gestureStart;
+uint32_t gestureIrqUs = 0;
+GestureSample gestureHistory[GESTURE_HISTORY];
+uint8_t gestureHistoryCount = 0;
+uint8_t gestureHistoryHead = 0;
+uint32_t gestureFirstDecisionUs = 0;
+bool gestureDecided = false;
+
+// Last TAP, for DOUBLE_TAP
+GestureSample gestureLastTap;
+bool gestureLastTapValid = false;
+
+Gesture gestureQueue[GESTURE_QUEUE_SIZE];
+uint8_t gestureQueueHead = 0;
+uint8_t gestureQueueTail = 0;
+
+// ─────────────────────────────────────────────────────────────────────
+// HELPERS
+// ─────────────────────────────────────────────────────────────────────
+
+void gestureRemember(int16_t x, int16_t y, uint32_t us) {
+  GestureSample& s = gestureHistory[gestureHistoryHead];
+  s.x = x;
+  s.y = y;
+  s.us = us;
+  gestureHistoryHead = (gestureHistoryHead + 1) % GESTURE_HISTORY;
+  if (gestureHistoryCount < GESTURE_HISTORY) gestureHistoryCount++;
+}
+
+// Velocity from the newest sample back to the oldest one in the window
+void gestureVelocity(int16_t& vx, int16_t& vy) {
+  vx = vy = 0;
+  if (gestureHistoryCount < 2) return;
+  const GestureSample& last = gestureHistory[(gestureHistoryHead + GESTURE_HISTORY - 1) % GESTURE_HISTORY];
+  const GestureSample* first = &last;
+  for (uint8_t i = 2; i <= gestureHistoryCount; i++) {
+    const GestureSample& s = gestureHistory[(gestureHistoryHead + GESTURE_HISTORY - i) % GESTURE_HISTORY];
+    if (last.us - s.us > GESTURE_VELOCITY_WINDOW_MS * 1000UL) break;
+    first = &s;
+  }
+  uint32_t dt = last.us - first->us;
+  if (dt == 0) return;
+  vx = (int16_t)constrain((int32_t)(last.x - first->x) * 1000000L / (int32_t)dt, -32000L, 32000L);
+  vy = (int16_t)constrain((int32_t)(last.y - first->y) * 1000000L / (int32_t)dt, -32000L, 32000L);
+}
+
+void gestureEmit(GestureType type, int16_t x, int16_t y, uint32_t us) {
+  Gesture g;
+  g.type = type;
+  g.x = gestureStart.x;
+  g.y = gestureStart.y;
+  g.dx = x - gestureStart.x;
+  g.dy = y - gestureStart.y;
+  gestureVelocity(g.vx, g.vy);
+  g.startUs = gestureStart.us;
+  g.irqUs = gestureIrqUs;
+  g.us = us;
+
+  uint32_t latency = us - gestureStart.us;
+  gestureStats.count[type]++;
+  gestureStats.latencySumUs[type] += latency;
+  if (latency > gestureStats.latencyMaxUs[type]) gestureStats.latencyMaxUs[type] = latency;
+  if (!gestureDecided) {
+    gestureDecided = true;
+    gestureFirstDecisionUs = us;
+  }
+
+  // Consecutive DRAGs collapse into the newest one
+  uint8_t prev = (gestureQueueHead + GESTURE_QUEUE_SIZE - 1) % GESTURE_QUEUE_SIZE;
+  if (type == GESTURE_DRAG && gestureQueueHead != gestureQueueTail &&
+      gestureQueue[prev].type == GESTURE_DRAG) {
+    gestureQueue[prev] = g;
+    return;
+  }
+  uint8_t next = (gestureQueueHead + 1) % GESTURE_QUEUE_SIZE;
+  if (next == gestureQueueTail) {
+    gestureStats.dropped++;
+    return;
+  }
+  gestureQueue[gestureQueueHead] = g;
+  gestureQueueHead = next;
+}
+
+// ─────────────────────────────────────────────────────────────────────
+// RECOGNIZER
+// ─────────────────────────────────────────────────────────────────────
+
+void gestureUp(const TouchEvent& e) {
+  bool quick = e.us - gestureStart.us < GESTURE_LONG_PRESS_MS * 1000UL;
+  bool near = abs(e.x - gestureStart.x) < GESTURE_TAP_PX && abs(e.y - gestureStart.y) < GESTURE_TAP_PX;
+  bool tap = quick && (gestureState == GSTATE_PRESSED ||
+                       (near && (gestureState == GSTATE_DRAGGING || gestureState == GSTATE_EDGE)));
+  switch (tap ? GSTATE_PRESSED : gestureState) {
+    case GSTATE_PRESSED:
+      if (!quick) {
+        // Loop was too busy to tick - still a long press, not a tap
+        gestureEmit(GESTURE_LONG_PRESS, e.x, e.y, e.us);
+        gestureLastTapValid = false;
+        break;
+      }
+      gestureEmit(GESTURE_TAP, e.x, e.y, e.us);
+      if (gestureLastTapValid && e.us - gestureLastTap.us <= GESTURE_DOUBLE_TAP_MS * 1000UL &&
+          abs(gestureStart.x - gestureLastTap.x) <= GESTURE_DOUBLE_TAP_PX &&
+          abs(gestureStart.y - gestureLastTap.y) <= GESTURE_DOUBLE_TAP_PX) {
+        gestureEmit(GESTURE_DOUBLE_TAP, e.x, e.y, e.us);
+        gestureLastTapValid = false;   // a third tap starts a new pair
+      } else {
+        gestureLastTap = gestureStart;
+        gestureLastTap.us = e.us;
+        gestureLastTapValid = true;
+      }
+      break;
+
+    case GSTATE_DRAGGING:
+    case GSTATE_EDGE: {
+      int16_t vx, vy;
+      gestureVelocity(vx, vy);
+      long speed2 = (long)vx * vx + (long)vy * vy;
+      bool fling = speed2 >= (long)GESTURE_FLING_PX_S * GESTURE_FLING_PX_S;
+      gestureEmit(fling ? GESTURE_FLING : GESTURE_DRAG_END, e.x, e.y, e.us);
+      break;
+    }
+
+    default:
+      break;
+  }
+
+  if (!tap) gestureLastTapValid = false;
+  if (gestureDecided && (int32_t)(e.us - gestureFirstDecisionUs) > 0) {
+    gestureStats.decidedEarly++;
+    gestureStats.earlySumUs += e.us - gestureFirstDecisionUs;
+  }
+  gestureState = GSTATE_IDLE;
+}
+
+void gestureMove(const TouchEvent& e) {
+  int dx = e.x - gestureStart.x;
+  int dy = e.y - gestureStart.y;
+
+  if (gestureState == GSTATE_PRESSED) {
+    if (dx * dx + dy * dy <= GESTURE_SLOP_PX * GESTURE_SLOP_PX) return;
+    if (gestureStart.x < GESTURE_EDGE_PX && dx > 2 * abs(dy)) {
+      gestureState = GSTATE_EDGE;   // this sample may already decide it
+    } else {
+      gestureState = GSTATE_DRAGGING;
+      gestureEmit(GESTURE_DRAG_START, e.x, e.y, e.us);
+      return;
+    }
+  }
+
+  if (gestureState == GSTATE_EDGE) {
+    if (dx <= 2 * abs(dy)) {
+      // Drifted off the horizontal - an ordinary drag after all
+      gestureState = GSTATE_DRAGGING;
+      gestureEmit(GESTURE_DRAG_START, e.x, e.y, e.us);
+    } else if (dx >= GESTURE_EDGE_TRIGGER_PX) {
+      gestureEmit(GESTURE_EDGE_BACK, e.x, e.y, e.us);
+      gestureState = GSTATE_DONE;
+    }
+  } else if (gestureState == GSTATE_DRAGGING) {
+    gestureEmit(GESTURE_DRAG, e.x, e.y, e.us);
+  }
+}
+
+void gestureFeed(const TouchEvent& e) {
+  if (e.type == TOUCH_DOWN) {
+    gestureState = GSTATE_PRESSED;
+    gestureStart.x = e.x;
+    gestureStart.y = e.y;
+    gestureStart.us = e.us;
+    gestureIrqUs = e.irqUs;
+    gestureHistoryCount = 0;
+    gestureHistoryHead = 0;
+    gestureDecided = false;
+    gestureStats.strokes++;
+    gestureRemember(e.x, e.y, e.us);
+    return;
+  }
+  if (gestureState == GSTATE_IDLE) return;   // UP/MOVE without a DOWN
+
+  gestureRemember(e.x, e.y, e.us);
+  if (e.type == TOUCH_UP) gestureUp(e);
+  else gestureMove(e);
+}
+
+// Time-based decisions (long press) while the finger rests
+void gestureTick(uint32_t now) {
+  if (gestureState != GSTATE_PRESSED) return;
+  if (now - gestureStart.us < GESTURE_LONG_PRESS_MS * 1000UL) return;
+  const GestureSample& last = gestureHistory[(gestureHistoryHead + GESTURE_HISTORY - 1) % GESTURE_HISTORY];
+  gestureEmit(GESTURE_LONG_PRESS, last.x, last.y, now);
+  gestureState = GSTATE_DONE;
+}
+
+// When gestureTick() next has something to decide (long press), if ever
+bool gestureDeadline(uint32_t& dueUs) {
+  if (gestureState != GSTATE_PRESSED) return false;
+  dueUs = gestureStart.us + GESTURE_LONG_PRESS_MS * 1000UL;
+  return true;
+}
+
+bool gestureNext(Gesture& g) {
+  if (gestureQueueTail == gestureQueueHead) return false;
+  g = gestureQueue[gestureQueueTail];
+  gestureQueueTail = (gestureQueueTail + 1) % GESTURE_QUEUE_SIZE;
+  return true;
+}
+
+// Forget the stroke in progress, the tap pairing and anything queued
+void gestureReset() {
+  gestureState = GSTATE_IDLE;
+  gestureLastTapValid = false;
+  gestureQueueHead = gestureQueueTail = 0;
+}
+
+// ─────────────────────────────────────────────────────────────────────
+// REPORT
+// ─────────────────────────────────────────────────────────────────────
+
+void resetGestureStats() {
+  memset(&gestureStats, 0, sizeof(gestureStats));
+}
+
+void printGestureReport() {
+  const GestureStats& s = gestureStats;
+
+  Serial.println("\n━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━");
+  Serial.println("   GESTURES");
+  Serial.println("━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━");
+  Serial.printf("   Strokes:      %u (%u decided before lift, %u ms avg early)\n",
+                s.strokes, s.decidedEarly, s.decidedEarly ? s.earlySumUs / s.decidedEarly / 1000 : 0);
+  Serial.println("   Gesture        Count   First sample -> decided");
+  for (int t = 0; t < GESTURE_TYPE_COUNT; t++) {
+    if (!s.count[t]) continue;
+    Serial.printf("   %-12s %7u   %u ms avg, %u ms max\n", GESTURE_NAMES[t], s.count[t],
+                  s.latencySumUs[t] / s.count[t] / 1000, s.latencyMaxUs[t] / 1000);
+  }
+  Serial.printf("   Thresholds:   slop %d px, long %d ms, fling %d px/s, edge %d px\n",
+                GESTURE_SLOP_PX, GESTURE_LONG_PRESS_MS, GESTURE_FLING_PX_S, GESTURE_EDGE_PX);
+  Serial.printf("   Dropped:      %u (queue full)\n", s.dropped);
+  Serial.println("━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━\n");
+}
+
+#endif // GESTURES_H
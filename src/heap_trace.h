@@ -0,0 +1,347 @@
+#ifndef HEAP_TRACE_H
+#define HEAP_TRACE_H
+
+/*
+ * ═══════════════════════════════════════════════════════════════════════
+ * BLACKROAD HEAP TRACE - who owns the heap when isLowMemory() fires
+ * ═══════════════════════════════════════════════════════════════════════
+ *
+ * HEAP_TRACE=1 links malloc/calloc/realloc/free through the wrappers
+ * below (-Wl,--wrap=..., see the esp32dev_heaptrace and native envs in
+ * platformio.ini). Each allocation is charged to the tag of the task
+ * that made it, set by a scope guard:
+ *
+ *   HeapTag tag(HEAP_TAG_NAV);   // until the end of this scope
+ *
+ *   tag      set in
+ *   serial   handleSerialCommand()
+ *   render   drawCurrentScreen()
+ *   nav      net task refresh + hot leads (dynamic_nav.h fetchers)
+ *   alerts   checkAllAlerts(), sendAlert(), Discord/Slack webhooks
+ *   fs       filesystem.h
+ *   other    anything untagged, including WiFi/lwIP internals
+ *
+ * Tags are per task (the net task and loop() allocate concurrently).
+ * Per tag: live bytes and blocks, peak live bytes, allocations and
+ * bytes since HEAP RESET. Live blocks sit in a fixed open-addressing
+ * table (HEAP_TRACE_SLOTS), so HEAP can list the largest ones with
+ * their tag and age. The table never allocates; when it is full, new
+ * blocks are counted but not tracked.
+ *
+ * memAlloc() callers (JSON arena slots, home page cache, alert log -
+ * mem_placement.h) go through heap_caps_malloc(), are not traced and
+ * are accounted by MEM instead. HEAP_TRACE=0 (default esp32dev build):
+ * HeapTag compiles to nothing and HEAP prints the heap summary only.
+ */
+
+#ifndef HEAP_TRACE
+#define HEAP_TRACE 0
+#endif
+
+// ─────────────────────────────────────────────────────────────────────
+// CONFIGURATION
+// ─────────────────────────────────────────────────────────────────────
+
+#ifndef HEAP_TRACE_SLOTS
+#define HEAP_TRACE_SLOTS     1024    // live blocks tracked (power of two), 16 B each
+#endif
+#define HEAP_TRACE_TASKS     6       // tasks with their own current tag
+#define HEAP_TRACE_TOP       8       // largest live blocks listed by HEAP
+
+enum HeapTagId : uint8_t {
+  HEAP_TAG_OTHER,
+  HEAP_TAG_SERIAL,
+  HEAP_TAG_RENDER,
+  HEAP_TAG_NAV,
+  HEAP_TAG_ALERTS,
+  HEAP_TAG_FS,
+  HEAP_TAG_COUNT
+};
+
+const char* const HEAP_TAG_NAMES[HEAP_TAG_COUNT] = {
+  "other", "serial", "render", "nav", "alerts", "fs",
+};
+
+#if HEAP_TRACE
+
+extern "C" {
+void* __real_malloc(size_t n);
+void* __real_calloc(size_t n, size_t size);
+void* __real_realloc(void* p, size_t n);
+void __real_free(void* p);
+}
+
+// ─────────────────────────────────────────────────────────────────────
+// STATE
+// ─────────────────────────────────────────────────────────────────────
+
+struct HeapTraceEntry {
+  uintptr_t p;           // 0 = empty
+  uint32_t size;
+  uint32_t atMs;
+  uint8_t tag;
+};
+
+struct HeapTagStats {
+  uint32_t liveBytes;
+  uint32_t liveBlocks;
+  uint32_t peakBytes;    // live bytes high-water mark
+  uint32_t allocs;       // since reset
+  uint32_t bytes;
+};
+
+HeapTraceEntry heapTraceTable[HEAP_TRACE_SLOTS];
+static_assert((HEAP_TRACE_SLOTS & (HEAP_TRACE_SLOTS - 1)) == 0, "HEAP_TRACE_SLOTS must be a power of two");
+#ifndef HOST_BUILD
+static_assert(sizeof(heapTraceTable) <= 32 * 1024, "heap trace table takes over 32 KB of internal RAM");
+#endif
+HeapTagStats heapTagStats[HEAP_TAG_COUNT];
+uint32_t heapTraceUntracked = 0;   // table full when allocated
+uint32_t heapTraceResetMs = 0;
+
+#ifdef HOST_BUILD
+uint8_t heapTraceHostTag = HEAP_TAG_OTHER;   // one thread
+#define HEAP_TRACE_LOCK()
+#define HEAP_TRACE_UNLOCK()
+#else
+struct HeapTaskTag {
+  TaskHandle_t task;
+  uint8_t tag;
+};
+HeapTaskTag heapTaskTags[HEAP_TRACE_TASKS];
+portMUX_TYPE heapTraceMux = portMUX_INITIALIZER_UNLOCKED;
+#define HEAP_TRACE_LOCK()   portENTER_CRITICAL(&heapTraceMux)
+#define HEAP_TRACE_UNLOCK() portEXIT_CRITICAL(&heapTraceMux)
+#endif
+
+// ─────────────────────────────────────────────────────────────────────
+// CURRENT TAG
+// ─────────────────────────────────────────────────────────────────────
+
+uint8_t heapTagCurrent() {
+#ifdef HOST_BUILD
+  return heapTraceHostTag;
+#else
+  TaskHandle_t self = xTaskGetCurrentTaskHandle();
+  for (int i = 0; i < HEAP_TRACE_TASKS; i++) {
+    if (heapTaskTags[i].task == self) return heapTaskTags[i].tag;
+  }
+  return HEAP_TAG_OTHER;
+#endif
+}
+
+// Returns the tag it replaced
+uint8_t heapTagSet(uint8_t tag) {
+#ifdef HOST_BUILD
+  uint8_t prev = heapTraceHostTag;
+  heapTraceHostTag = tag;
+  return prev;
+#else
+  TaskHandle_t self = xTaskGetCurrentTaskHandle();
+  uint8_t prev = HEAP_TAG_OTHER;
+  HEAP_TRACE_LOCK();
+  int slot = -1;
+  for (int i = 0; i < HEAP_TRACE_TASKS; i++) {
+    if (heapTaskTags[i].task == self) { slot = i; break; }
+    if (slot < 0 && !heapTaskTags[i].task) slot = i;
+  }
+  if (slot >= 0) {
+    if (heapTaskTags[slot].task == self) prev = heapTaskTags[slot].tag;
+    heapTaskTags[slot].task = self;
+    heapTaskTags[slot].tag = tag;
+  }
+  HEAP_TRACE_UNLOCK();
+  return prev;
+#endif
+}
+
+class HeapTag {
+  uint8_t prev;
+public:
+  explicit HeapTag(HeapTagId tag) : prev(heapTagSet(tag)) {}
+  ~HeapTag() { heapTagSet(prev); }
+  HeapTag(const HeapTag&) = delete;
+  HeapTag& operator=(const HeapTag&) = delete;
+};
+
+// ─────────────────────────────────────────────────────────────────────
+// LIVE TABLE (linear probing, backward-shift delete)
+// ─────────────────────────────────────────────────────────────────────
+
+inline uint32_t heapTraceHome(uintptr_t p) {
+  return (uint32_t)((p >> 3) * 2654435761u) & (HEAP_TRACE_SLOTS - 1);
+}
+
+// Caller holds the lock
+void heapTraceInsert(void* ptr, size_t n, uint8_t tag) {
+  HeapTagStats& t = heapTagStats[tag];
+  t.allocs++;
+  t.bytes += n;
+  uintptr_t p = (uintptr_t)ptr;
+  uint32_t i = heapTraceHome(p);
+  for (uint32_t probe = 0; probe < HEAP_TRACE_SLOTS; probe++, i = (i + 1) & (HEAP_TRACE_SLOTS - 1)) {
+    HeapTraceEntry& e = heapTraceTable[i];
+    if (e.p) continue;
+    e.p = p;
+    e.size = n;
+    e.atMs = millis();
+    e.tag = tag;
+    t.liveBytes += n;
+    t.liveBlocks++;
+    if (t.liveBytes > t.peakBytes) t.peakBytes = t.liveBytes;
+    return;
+  }
+  heapTraceUntracked++;
+}
+
+// Caller holds the lock; untracked pointers are ignored
+void heapTraceRemove(void* ptr) {
+  uintptr_t p = (uintptr_t)ptr;
+  uint32_t i = heapTraceHome(p);
+  for (uint32_t probe = 0; probe < HEAP_TRACE_SLOTS; probe++, i = (i + 1) & (HEAP_TRACE_SLOTS - 1)) {
+    HeapTraceEntry& e = heapTraceTable[i];
+    if (!e.p) return;
+    if (e.p != p) continue;
+
+    HeapTagStats& t = heapTagStats[e.tag];
+    t.liveBytes -= e.size;
+    t.liveBlocks--;
+    // Pull later entries of the run back so lookups never hit a hole
+    uint32_t hole = i;
+    for (uint32_t j = (i + 1) & (HEAP_TRACE_SLOTS - 1); heapTraceTable[j].p; j = (j + 1) & (HEAP_TRACE_SLOTS - 1)) {
+      uint32_t home = heapTraceHome(heapTraceTable[j].p);
+      bool movable = hole <= j ? (home <= hole || home > j) : (home <= hole && home > j);
+      if (movable) {
+        heapTraceTable[hole] = heapTraceTable[j];
+        hole = j;
+      }
+    }
+    heapTraceTable[hole].p = 0;
+    return;
+  }
+}
+
+// ─────────────────────────────────────────────────────────────────────
+// WRAPPERS (-Wl,--wrap=malloc,--wrap=calloc,--wrap=realloc,--wrap=free)
+// ─────────────────────────────────────────────────────────────────────
+
+extern "C" {
+
+void* __wrap_malloc(size_t n) {
+  void* p = __real_malloc(n);
+  if (p) {
+    uint8_t tag = heapTagCurrent();
+    HEAP_TRACE_LOCK();
+    heapTraceInsert(p, n, tag);
+    HEAP_TRACE_UNLOCK();
+  }
+  return p;
+}
+
+void* __wrap_calloc(size_t n, size_t size) {
+  void* p = __real_calloc(n, size);
+  if (p) {
+    uint8_t tag = heapTagCurrent();
+    HEAP_TRACE_LOCK();
+    heapTraceInsert(p, n * size, tag);
+    HEAP_TRACE_UNLOCK();
+  }
+  return p;
+}
+
+// The resized block is charged to the caller's tag, not the original one
+void* __wrap_realloc(void* old, size_t n) {
+  void* p = __real_realloc(old, n);
+  if (p || !n) {
+    uint8_t tag = heapTagCurrent();
+    HEAP_TRACE_LOCK();
+    if (old) heapTraceRemove(old);
+    if (p) heapTraceInsert(p, n, tag);
+    HEAP_TRACE_UNLOCK();
+  }
+  return p;
+}
+
+void __wrap_free(void* p) {
+  if (p) {
+    HEAP_TRACE_LOCK();
+    heapTraceRemove(p);
+    HEAP_TRACE_UNLOCK();
+  }
+  __real_free(p);
+}
+
+}  // extern "C"
+
+// ─────────────────────────────────────────────────────────────────────
+// REPORT
+// ─────────────────────────────────────────────────────────────────────
+
+// Live blocks and peaks stay; rates and totals restart
+void resetHeapTrace() {
+  HEAP_TRACE_LOCK();
+  for (int i = 0; i < HEAP_TAG_COUNT; i++) {
+    heapTagStats[i].allocs = 0;
+    heapTagStats[i].bytes = 0;
+    heapTagStats[i].peakBytes = heapTagStats[i].liveBytes;
+  }
+  heapTraceUntracked = 0;
+  heapTraceResetMs = millis();
+  HEAP_TRACE_UNLOCK();
+}
+
+void printHeapTraceReport() {
+  // Copy under the lock, print outside it - Serial may allocate
+  HeapTagStats tags[HEAP_TAG_COUNT];
+  HeapTraceEntry top[HEAP_TRACE_TOP];
+  int topCount = 0;
+  uint32_t untracked;
+  HEAP_TRACE_LOCK();
+  memcpy(tags, heapTagStats, sizeof(tags));
+  untracked = heapTraceUntracked;
+  for (int i = 0; i < HEAP_TRACE_SLOTS; i++) {
+    const HeapTraceEntry& e = heapTraceTable[i];
+    if (!e.p) continue;
+    int k = topCount < HEAP_TRACE_TOP ? topCount++ : HEAP_TRACE_TOP - 1;
+    if (k == HEAP_TRACE_TOP - 1 && topCount == HEAP_TRACE_TOP && e.size <= top[k].size) continue;
+    while (k > 0 && top[k - 1].size < e.size) {
+      top[k] = top[k - 1];
+      k--;
+    }
+    top[k] = e;
+  }
+  HEAP_TRACE_UNLOCK();
+
+  uint32_t now = millis();
+  float secs = (now - heapTraceResetMs) / 1000.0f;
+  Serial.println("   Tag          Live  Blocks     Peak   Allocs   Per s");
+  for (int i = 0; i < HEAP_TAG_COUNT; i++) {
+    const HeapTagStats& t = tags[i];
+    if (!t.allocs && !t.liveBlocks) continue;
+    Serial.printf("   %-8s %8u %7u %8u %8u %7.1f\n", HEAP_TAG_NAMES[i], t.liveBytes, t.liveBlocks,
+                  t.peakBytes, t.allocs, secs > 0 ? t.allocs / secs : 0.0f);
+  }
+  Serial.println("   Largest live blocks:");
+  for (int i = 0; i < topCount; i++) {
+    Serial.printf("   %8u B  %-8s %lu s old\n", top[i].size, HEAP_TAG_NAMES[top[i].tag],
+                  (unsigned long)((now - top[i].atMs) / 1000));
+  }
+  if (untracked) Serial.printf("   Untracked:    %u blocks (table full, HEAP_TRACE_SLOTS %d)\n", untracked, HEAP_TRACE_SLOTS);
+}
+
+#else
+
+class HeapTag {
+public:
+  explicit HeapTag(HeapTagId) {}
+};
+
+inline void resetHeapTrace() {}
+
+inline void printHeapTraceReport() {
+  Serial.println("   Tracer off - build env esp32dev_heaptrace for per-tag use");
+}
+
+#endif // HEAP_TRACE
+
+#endif // HEAP_TRACE_H
@@ -0,0 +1,234 @@
+#ifndef HIT_TEST_H
+#define HIT_TEST_H
+
+/*
+ * ═══════════════════════════════════════════════════════════════════════
+ * BLACKROAD HIT-TEST INDEX
+ * ═══════════════════════════════════════════════════════════════════════
+ *
+ * Screens register their interactive regions while they draw, so the
+ * coordinates live next to the pixels instead of in handleTouch():
+ *
+ *   hitBegin(screen)                    drawCurrentScreen() opens a list
+ *   hitAdd(x, y, w, h, action, arg)     draw code / layout buttons add
+ *   hitCommit()                         list -> grid-bucket index
+ *
+ * The panel is split into HIT_CELL x HIT_CELL buckets; each bucket lists
+ * the regions overlapping it. A tap looks at one bucket, so dispatch cost
+ * does not grow with the number of regions on the screen. Regions added
+ * later sit on top (nav bar over screen content), as they are drawn.
+ *
+ * Redrawing a screen with the same regions (counters, key presses) keeps
+ * the index - it is only rebuilt when the region list changes. hitAdd()
+ * outside hitBegin()/hitCommit() is ignored, so partial redraws are free.
+ */
+
+// ─────────────────────────────────────────────────────────────────────
+// CONFIGURATION
+// ─────────────────────────────────────────────────────────────────────
+
+#define HIT_MAX_REGIONS   48
+#define HIT_CELL          32
+#define HIT_COLS          (320 / HIT_CELL)
+#define HIT_ROWS          ((240 + HIT_CELL - 1) / HIT_CELL)
+#define HIT_MAX_REFS      384   // bucket entries (region x cells it covers)
+
+// ─────────────────────────────────────────────────────────────────────
+// REGIONS
+// ─────────────────────────────────────────────────────────────────────
+
+struct HitRegion {
+  int16_t x, y, w, h;   // half-open: x <= px < x + w
+  uint8_t action;       // LayoutAction
+  uint8_t arg;          // app index, grid cell, key char...
+};
+
+struct HitIndex {
+  int screen;                         // -1 = nothing committed yet
+  uint8_t count;
+  HitRegion regions[HIT_MAX_REGIONS];
+  uint16_t cellStart[HIT_COLS * HIT_ROWS + 1];
+  uint8_t refs[HIT_MAX_REFS];         // region ids, registration order per cell
+};
+
+struct HitStats {
+  uint32_t taps;
+  uint32_t hits;
+  uint32_t stale;          // tap arrived for a screen that was never drawn
+  uint32_t commits;
+  uint32_t rebuilds;       // commits whose region list changed
+  uint32_t rebuildUs;
+  uint32_t dropped;        // regions over HIT_MAX_REGIONS / HIT_MAX_REFS
+  uint32_t lookupCycles;   // total CPU cycles in hitTest()
+  uint32_t maxLookupCycles;
+  uint8_t maxPerCell;
+};
+
+HitIndex hitIndex = { -1, 0, {}, {}, {} };
+HitStats hitStats;
+
+// Staging list filled while a screen draws
+HitRegion hitPending[HIT_MAX_REGIONS];
+uint8_t hitPendingCount = 0;
+int hitPendingScreen = -1;
+bool hitRecording = false;
+
+// ─────────────────────────────────────────────────────────────────────
+// REGISTRATION
+// ─────────────────────────────────────────────────────────────────────
+
+void hitBegin(int screen) {
+  hitPendingScreen = screen;
+  hitPendingCount = 0;
+  hitRecording = true;
+}
+
+void hitAdd(int x, int y, int w, int h, uint8_t action, uint8_t arg = 0) {
+  if (!hitRecording) return;
+  if (hitPendingCount >= HIT_MAX_REGIONS) {
+    hitStats.dropped++;
+    return;
+  }
+  HitRegion& r = hitPending[hitPendingCount++];
+  r.x = x;
+  r.y = y;
+  r.w = w;
+  r.h = h;
+  r.action = action;
+  r.arg = arg;
+}
+
+// Bucket range a region covers, clipped to the panel (false = off-panel)
+bool hitCellSpan(const HitRegion& r, int& c0, int& c1, int& r0, int& r1) {
+  int x0 = r.x < 0 ? 0 : r.x;
+  int y0 = r.y < 0 ? 0 : r.y;
+  int x1 = (r.x + r.w > 320 ? 320 : r.x + r.w) - 1;
+  int y1 = (r.y + r.h > 240 ? 240 : r.y + r.h) - 1;
+  if (x1 < x0 || y1 < y0) return false;
+  c0 = x0 / HIT_CELL;
+  c1 = x1 / HIT_CELL;
+  r0 = y0 / HIT_CELL;
+  r1 = y1 / HIT_CELL;
+  return true;
+}
+
+// Counting sort of region ids into buckets (two passes, no allocation)
+void hitBuildIndex() {
+  uint16_t* start = hitIndex.cellStart;
+  memset(start, 0, sizeof(hitIndex.cellStart));
+
+  for (uint8_t i = 0; i < hitIndex.count; i++) {
+    int c0, c1, r0, r1;
+    if (!hitCellSpan(hitIndex.regions[i], c0, c1, r0, r1)) continue;
+    for (int row = r0; row <= r1; row++)
+      for (int col = c0; col <= c1; col++) start[row * HIT_COLS + col + 1]++;
+  }
+
+  // Prefix sums stop at HIT_MAX_REFS: the cell that crosses it keeps what
+  // fits, later cells stay empty, and hitTest() only reads filled slots
+  hitStats.maxPerCell = 0;
+  for (int c = 0; c < HIT_COLS * HIT_ROWS; c++) {
+    if (start[c + 1] > hitStats.maxPerCell) hitStats.maxPerCell = start[c + 1];
+    start[c + 1] += start[c];
+    if (start[c + 1] > HIT_MAX_REFS) start[c + 1] = HIT_MAX_REFS;
+  }
+
+  uint16_t fill[HIT_COLS * HIT_ROWS];
+  memcpy(fill, start, sizeof(fill));
+  for (uint8_t i = 0; i < hitIndex.count; i++) {
+    int c0, c1, r0, r1;
+    if (!hitCellSpan(hitIndex.regions[i], c0, c1, r0, r1)) continue;
+    for (int row = r0; row <= r1; row++) {
+      for (int col = c0; col <= c1; col++) {
+        int cell = row * HIT_COLS + col;
+        uint16_t& slot = fill[cell];
+        if (slot < start[cell + 1]) hitIndex.refs[slot++] = i;
+        else hitStats.dropped++;
+      }
+    }
+  }
+}
+
+// Swap the staged list in; rebuild buckets only if something moved
+void hitCommit() {
+  if (!hitRecording) return;
+  hitRecording = false;
+  hitStats.commits++;
+
+  size_t bytes = hitPendingCount * sizeof(HitRegion);
+  if (hitIndex.screen == hitPendingScreen && hitIndex.count == hitPendingCount &&
+      memcmp(hitIndex.regions, hitPending, bytes) == 0) {
+    return;
+  }
+
+  unsigned long t0 = micros();
+  hitIndex.screen = hitPendingScreen;
+  hitIndex.count = hitPendingCount;
+  memcpy(hitIndex.regions, hitPending, bytes);
+  hitBuildIndex();
+  hitStats.rebuilds++;
+  hitStats.rebuildUs += micros() - t0;
+}
+
+// ─────────────────────────────────────────────────────────────────────
+// LOOKUP
+// ─────────────────────────────────────────────────────────────────────
+
+// True if the index describes `screen` (it was drawn since it changed)
+bool hitIndexFor(int screen) {
+  return hitIndex.screen == screen;
+}
+
+// Topmost region under (x, y), or nullptr
+const HitRegion* hitTest(int x, int y) {
+  uint32_t c0 = ESP.getCycleCount();
+  const HitRegion* found = nullptr;
+
+  if (x >= 0 && x < 320 && y >= 0 && y < 240) {
+    int cell = (y / HIT_CELL) * HIT_COLS + x / HIT_CELL;
+    for (int i = hitIndex.cellStart[cell + 1] - 1; i >= hitIndex.cellStart[cell]; i--) {
+      const HitRegion& r = hitIndex.regions[hitIndex.refs[i]];
+      if (x >= r.x && x < r.x + r.w && y >= r.y && y < r.y + r.h) {
+        found = &r;
+        break;
+      }
+    }
+  }
+
+  uint32_t cycles = ESP.getCycleCount() - c0;
+  hitStats.taps++;
+  if (found) hitStats.hits++;
+  hitStats.lookupCycles += cycles;
+  if (cycles > hitStats.maxLookupCycles) hitStats.maxLookupCycles = cycles;
+  return found;
+}
+
+// ─────────────────────────────────────────────────────────────────────
+// REPORT
+// ─────────────────────────────────────────────────────────────────────
+
+void resetHitStats() {
+  uint8_t perCell = hitStats.maxPerCell;
+  memset(&hitStats, 0, sizeof(hitStats));
+  hitStats.maxPerCell = perCell;   // describes the live index, not a window
+}
+
+void printHitReport(const char* const* screenNames) {
+  const HitStats& s = hitStats;
+  uint32_t avgCycles = s.taps ? s.lookupCycles / s.taps : 0;
+
+  Serial.println("\n━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━");
+  Serial.println("   HIT-TEST INDEX");
+  Serial.println("━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━");
+  Serial.printf("   Screen:       %s\n", hitIndex.screen >= 0 ? screenNames[hitIndex.screen] : "-");
+  Serial.printf("   Regions:      %u / %d, %u bucket refs, max %u per %dpx cell\n",
+                hitIndex.count, HIT_MAX_REGIONS, hitIndex.cellStart[HIT_COLS * HIT_ROWS],
+                s.maxPerCell, HIT_CELL);
+  Serial.printf("   Taps:         %u (%u hit, %u stale screen)\n", s.taps, s.hits, s.stale);
+  Serial.printf("   Lookup:       %u cycles avg, %u max\n", avgCycles, s.maxLookupCycles);
+  Serial.printf("   Commits:      %u (%u rebuilt, %u us total)\n", s.commits, s.rebuilds, s.rebuildUs);
+  Serial.printf("   Dropped:      %u regions/refs over capacity\n", s.dropped);
+  Serial.println("━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━\n");
+}
+
+#endif // HIT_TEST_H
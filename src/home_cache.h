@@ -0,0 +1,392 @@
+#ifndef HOME_CACHE_H
+#define HOME_CACHE_H
+
+/*
+ * ═══════════════════════════════════════════════════════════════════════
+ * BLACKROAD HOME PAGE CACHE
+ * ═══════════════════════════════════════════════════════════════════════
+ *
+ * Keeps the icon grid of every home page (TOTAL_PAGES) pre-rendered so a
+ * swipe is one bulk blit instead of fillScreen + 12 icons + page dots:
+ *
+ * - Pages are rendered offscreen in 16-row TFT_eSprite bands
+ * - Each band is stored palette-RLE compressed (a page is a handful of
+ *   flat colors) - MEM_COLD: PSRAM when fitted, internal heap otherwise
+ * - A badge change re-renders only the bands under that icon
+ * - Blit = one address window + streamed rows, optional slide
+ *
+ * Status bar and nav bar stay live (clock, WiFi dot). A page that does
+ * not fit the palette or the heap falls back to the normal redraw.
+ */
+
+// ─────────────────────────────────────────────────────────────────────
+// CONFIGURATION
+// ─────────────────────────────────────────────────────────────────────
+
+#define HOME_CACHE_Y0          24    // below the status bar
+#define HOME_CACHE_Y1          210   // nav bar starts here
+#define HOME_CACHE_W           320
+#define HOME_CACHE_ROWS        (HOME_CACHE_Y1 - HOME_CACHE_Y0)
+#define HOME_CACHE_BAND_ROWS   16
+#define HOME_CACHE_BANDS       ((HOME_CACHE_ROWS + HOME_CACHE_BAND_ROWS - 1) / HOME_CACHE_BAND_ROWS)
+#define HOME_CACHE_PALETTE     16    // 4-bit palette index per run
+#define HOME_SLIDE_FRAMES      6
+
+// Provided by main.cpp
+void drawAppIcon(TFT_eSPI& gfx, App& app, bool pressed, int yOff);
+void drawPageDots(TFT_eSPI& gfx, int page, int yOff);
+
+// ─────────────────────────────────────────────────────────────────────
+// STATE
+// ─────────────────────────────────────────────────────────────────────
+
+struct HomeCacheBand {
+  uint8_t* data;       // RLE tokens
+  uint16_t size;
+};
+
+struct HomeCachePage {
+  bool valid;
+  uint8_t paletteCount;
+  uint16_t palette[HOME_CACHE_PALETTE];
+  int badges[APPS_PER_PAGE];           // badge values the bands were drawn with
+  HomeCacheBand bands[HOME_CACHE_BANDS];
+};
+
+HomeCachePage homePages[TOTAL_PAGES];
+bool homeCacheEnabled = true;
+bool homeCacheSlide = false;
+
+// Swipe-to-complete latency: release detected → page on the panel
+struct SwipeStats {
+  uint32_t count;
+  uint32_t totalUs;
+  uint32_t maxUs;
+  uint32_t lastUs;
+};
+
+SwipeStats swipeStats[2];              // [0] = live redraw, [1] = cache blit
+
+struct HomeCacheCounters {
+  uint32_t blits;
+  uint32_t misses;                     // page not cached → live redraw
+  uint32_t bandRenders;
+  uint32_t renderUs;                   // time spent rendering bands
+};
+
+HomeCacheCounters homeCacheCounters;
+
+// Scratch for compression/decoding
+uint8_t homeBandScratch[HOME_CACHE_W * HOME_CACHE_BAND_ROWS];   // worst case: 1 byte per pixel
+uint16_t homeLineA[HOME_CACHE_W];
+uint16_t homeLineB[HOME_CACHE_W];
+uint16_t homeLineOut[HOME_CACHE_W];
+
+// ─────────────────────────────────────────────────────────────────────
+// RLE - token byte: high nibble palette index, low nibble run length
+// 1..15; low nibble 0 means the next byte holds (length - 16), 16..271
+// ─────────────────────────────────────────────────────────────────────
+
+int homePaletteIndex(HomeCachePage& page, uint16_t color) {
+  for (int i = 0; i < page.paletteCount; i++) {
+    if (page.palette[i] == color) return i;
+  }
+  if (page.paletteCount >= HOME_CACHE_PALETTE) return -1;
+  page.palette[page.paletteCount] = color;
+  return page.paletteCount++;
+}
+
+int homeEmitRun(uint8_t* out, int pos, int index, int len) {
+  while (len > 0) {
+    int n = len > 271 ? 271 : len;
+    if (n < 16) {
+      out[pos++] = (index << 4) | n;
+    } else {
+      out[pos++] = index << 4;
+      out[pos++] = n - 16;
+    }
+    len -= n;
+  }
+  return pos;
+}
+
+// Compress one rendered band; false if the palette overflows
+bool homeCompressBand(HomeCachePage& page, TFT_eSprite& spr, int rows, HomeCacheBand& band) {
+  int pos = 0;
+  int runIndex = -1, runLen = 0;
+  for (int y = 0; y < rows; y++) {
+    for (int x = 0; x < HOME_CACHE_W; x++) {
+      int index = homePaletteIndex(page, spr.readPixel(x, y));
+      if (index < 0) return false;
+      if (index == runIndex) {
+        runLen++;
+        continue;
+      }
+      if (runLen) pos = homeEmitRun(homeBandScratch, pos, runIndex, runLen);
+      runIndex = index;
+      runLen = 1;
+    }
+  }
+  pos = homeEmitRun(homeBandScratch, pos, runIndex, runLen);
+
+  uint8_t* data = (uint8_t*)memAlloc(pos, MEM_COLD, MEM_HOME_CACHE);
+  if (!data) return false;
+  memcpy(data, homeBandScratch, pos);
+  memFree(band.data, band.size, MEM_HOME_CACHE);
+  band.data = data;
+  band.size = pos;
+  return true;
+}
+
+// Row-at-a-time decoder over a page's bands
+struct HomeDecoder {
+  const HomeCachePage* page;
+  int band;
+  uint16_t pos;
+  uint16_t color;
+  uint16_t remaining;
+};
+
+void homeDecodeRow(HomeDecoder& d, uint16_t* line) {
+  int x = 0;
+  while (x < HOME_CACHE_W) {
+    if (!d.remaining) {
+      const HomeCacheBand* b = &d.page->bands[d.band];
+      if (d.pos >= b->size) {                // runs never cross bands
+        d.band++;
+        d.pos = 0;
+        b = &d.page->bands[d.band];
+      }
+      uint8_t t = b->data[d.pos++];
+      d.color = d.page->palette[t >> 4];
+      d.remaining = (t & 0x0F) ? (t & 0x0F) : b->data[d.pos++] + 16;
+    }
+    int n = d.remaining < HOME_CACHE_W - x ? d.remaining : HOME_CACHE_W - x;
+    for (int i = 0; i < n; i++) line[x + i] = d.color;
+    d.remaining -= n;
+    x += n;
+  }
+}
+
+// Position at `row` of the grid (start of its band, then skip rows)
+void homeDecoderSeek(HomeDecoder& d, const HomeCachePage& page, int row) {
+  d.page = &page;
+  d.band = row / HOME_CACHE_BAND_ROWS;
+  d.pos = 0;
+  d.remaining = 0;
+  for (int r = d.band * HOME_CACHE_BAND_ROWS; r < row; r++) homeDecodeRow(d, homeLineOut);
+}
+
+// ─────────────────────────────────────────────────────────────────────
+// RENDERING
+// ─────────────────────────────────────────────────────────────────────
+
+void homeFreePage(HomeCachePage& page) {
+  for (int b = 0; b < HOME_CACHE_BANDS; b++) {
+    memFree(page.bands[b].data, page.bands[b].size, MEM_HOME_CACHE);
+    page.bands[b].data = nullptr;
+    page.bands[b].size = 0;
+  }
+  page.valid = false;
+}
+
+bool homeRenderBand(TFT_eSprite& spr, int pageIndex, int band) {
+  HomeCachePage& page = homePages[pageIndex];
+  int top = HOME_CACHE_Y0 + band * HOME_CACHE_BAND_ROWS;
+  int rows = HOME_CACHE_Y1 - top < HOME_CACHE_BAND_ROWS ? HOME_CACHE_Y1 - top : HOME_CACHE_BAND_ROWS;
+
+  spr.fillSprite(COLOR_BLACK);
+  int first = pageIndex * APPS_PER_PAGE;
+  for (int i = first; i < first + APPS_PER_PAGE && i < APP_COUNT; i++) {
+    App& app = apps[i];
+    // icon + shadow + badge extend a few pixels past the grid cell
+    if (strlen(app.name) > 0 && app.y - 4 < top + rows && app.y + app.size + 4 > top) {
+      drawAppIcon(spr, app, false, -top);
+    }
+  }
+  drawPageDots(spr, pageIndex, -top);
+
+  homeCacheCounters.bandRenders++;
+  return homeCompressBand(page, spr, rows, page.bands[band]);
+}
+
+// Render the bands of `pageIndex` selected by the bitmask
+bool homeRenderBands(int pageIndex, uint32_t bandMask) {
+  unsigned long start = micros();
+  TFT_eSprite spr(&tft);
+  spr.setColorDepth(16);
+  if (!spr.createSprite(HOME_CACHE_W, HOME_CACHE_BAND_ROWS)) return false;
+
+  bool ok = true;
+  for (int b = 0; b < HOME_CACHE_BANDS && ok; b++) {
+    if (bandMask & (1UL << b)) ok = homeRenderBand(spr, pageIndex, b);
+  }
+  spr.deleteSprite();
+  homeCacheCounters.renderUs += micros() - start;
+  return ok;
+}
+
+bool homeCacheBuildPage(int pageIndex) {
+  HomeCachePage& page = homePages[pageIndex];
+  homeFreePage(page);
+  page.paletteCount = 0;
+  for (int i = 0; i < APPS_PER_PAGE; i++) {
+    int a = pageIndex * APPS_PER_PAGE + i;
+    page.badges[i] = a < APP_COUNT ? apps[a].badge : 0;
+  }
+  page.valid = homeRenderBands(pageIndex, (1UL << HOME_CACHE_BANDS) - 1);
+  if (!page.valid) homeFreePage(page);
+  return page.valid;
+}
+
+void initHomeCache() {
+  for (int p = 0; p < TOTAL_PAGES; p++) homeCacheBuildPage(p);
+}
+
+// Re-render only the bands under icons whose badge changed
+bool homeCacheRefresh(int pageIndex) {
+  HomeCachePage& page = homePages[pageIndex];
+  if (!page.valid) return homeCacheBuildPage(pageIndex);
+
+  uint32_t mask = 0;
+  for (int i = 0; i < APPS_PER_PAGE; i++) {
+    int a = pageIndex * APPS_PER_PAGE + i;
+    if (a >= APP_COUNT || apps[a].badge == page.badges[i]) continue;
+    page.badges[i] = apps[a].badge;
+    int top = apps[a].y - 4 - HOME_CACHE_Y0;
+    int bottom = apps[a].y + apps[a].size + 4 - HOME_CACHE_Y0;
+    for (int b = 0; b < HOME_CACHE_BANDS; b++) {
+      int b0 = b * HOME_CACHE_BAND_ROWS;
+      if (b0 < bottom && b0 + HOME_CACHE_BAND_ROWS > top) mask |= 1UL << b;
+    }
+  }
+  if (!mask) return true;
+  if (!homeRenderBands(pageIndex, mask)) {
+    homeFreePage(page);
+    return false;
+  }
+  return true;
+}
+
+uint32_t homeCacheBytes(int pageIndex) {
+  uint32_t total = 0;
+  for (int b = 0; b < HOME_CACHE_BANDS; b++) total += homePages[pageIndex].bands[b].size;
+  return total;
+}
+
+// ─────────────────────────────────────────────────────────────────────
+// BLITTING
+// ─────────────────────────────────────────────────────────────────────
+
+// Cached page ready to show (refreshes stale badges first)
+bool homeCacheReady(int pageIndex) {
+  if (!homeCacheEnabled || pageIndex < 0 || pageIndex >= TOTAL_PAGES) return false;
+  if (!homeCacheRefresh(pageIndex)) {
+    homeCacheCounters.misses++;
+    return false;
+  }
+  return true;
+}
+
+// Copy a rectangle of the cached grid to the panel (absolute coords)
+bool homeCacheBlitRect(int pageIndex, int x, int y, int w, int h) {
+  if (x < 0) { w += x; x = 0; }
+  if (x + w > HOME_CACHE_W) w = HOME_CACHE_W - x;
+  if (w <= 0 || y < HOME_CACHE_Y0 || h <= 0 || y + h > HOME_CACHE_Y1) return false;
+  if (!homeCacheReady(pageIndex)) return false;
+
+  HomeDecoder d;
+  homeDecoderSeek(d, homePages[pageIndex], y - HOME_CACHE_Y0);
+  tft.startWrite();
+  tft.setAddrWindow(x, y, w, h);
+  for (int row = 0; row < h; row++) {
+    homeDecodeRow(d, homeLineA);
+    tft.pushColors(homeLineA + x, w, true);
+  }
+  tft.endWrite();
+  homeCacheCounters.blits++;
+  return true;
+}
+
+bool homeCacheBlit(int pageIndex) {
+  return homeCacheBlitRect(pageIndex, 0, HOME_CACHE_Y0, HOME_CACHE_W, HOME_CACHE_ROWS);
+}
+
+// Horizontal slide from one cached page to another. direction > 0 means
+// the new page comes in from the right. Input cuts it short.
+bool homeCacheSlideTo(int fromPage, int toPage, int direction) {
+  if (!homeCacheReady(fromPage) || !homeCacheReady(toPage)) return false;
+
+  for (int f = 1; f < HOME_SLIDE_FRAMES && !animInputPending(); f++) {
+    int shift = (int)(HOME_CACHE_W * ui.easeOutCubic((float)f / HOME_SLIDE_FRAMES));
+    HomeDecoder oldRows, newRows;
+    homeDecoderSeek(oldRows, homePages[fromPage], 0);
+    homeDecoderSeek(newRows, homePages[toPage], 0);
+
+    tft.startWrite();
+    tft.setAddrWindow(0, HOME_CACHE_Y0, HOME_CACHE_W, HOME_CACHE_ROWS);
+    for (int row = 0; row < HOME_CACHE_ROWS; row++) {
+      homeDecodeRow(oldRows, homeLineA);
+      homeDecodeRow(newRows, homeLineB);
+      int keep = HOME_CACHE_W - shift;
+      if (direction > 0) {
+        memcpy(homeLineOut, homeLineA + shift, keep * 2);
+        memcpy(homeLineOut + keep, homeLineB, shift * 2);
+      } else {
+        memcpy(homeLineOut, homeLineB + keep, shift * 2);
+        memcpy(homeLineOut + shift, homeLineA, keep * 2);
+      }
+      tft.pushColors(homeLineOut, HOME_CACHE_W, true);
+    }
+    tft.endWrite();
+  }
+  return homeCacheBlit(toPage);
+}
+
+// ─────────────────────────────────────────────────────────────────────
+// SWIPE LATENCY
+// ─────────────────────────────────────────────────────────────────────
+
+void recordSwipe(bool cached, uint32_t us) {
+  SwipeStats& s = swipeStats[cached ? 1 : 0];
+  s.count++;
+  s.totalUs += us;
+  s.lastUs = us;
+  if (us > s.maxUs) s.maxUs = us;
+}
+
+void resetSwipeStats() {
+  memset(swipeStats, 0, sizeof(swipeStats));
+}
+
+void printHomeCacheReport() {
+  Serial.println("\n╔═══════════════════════════════════════════════════════════╗");
+  Serial.println("║                 HOME PAGE CACHE / SWIPES                  ║");
+  Serial.println("╠═══════════════════════════════════════════════════════════╣");
+  Serial.printf("║ Cache: %-3s   Slide: %-3s   Storage: %-8s                ║\n",
+                homeCacheEnabled ? "ON" : "OFF", homeCacheSlide ? "ON" : "OFF",
+                memOwnerStats[MEM_HOME_CACHE].psramBytes ? "PSRAM" : "heap");
+  uint32_t total = 0;
+  for (int p = 0; p < TOTAL_PAGES; p++) {
+    uint32_t bytes = homeCacheBytes(p);
+    total += bytes;
+    Serial.printf("║ Page %d: %-7s %6u B  (raw %u B, %2u colors)        ║\n",
+                  p + 1, homePages[p].valid ? "cached" : "live", bytes,
+                  HOME_CACHE_W * HOME_CACHE_ROWS * 2, homePages[p].paletteCount);
+  }
+  Serial.printf("║ Total: %6u B   Blits: %-6u Misses: %-6u             ║\n",
+                total, homeCacheCounters.blits, homeCacheCounters.misses);
+  Serial.printf("║ Band renders: %-6u  Render time: %8u us             ║\n",
+                homeCacheCounters.bandRenders, homeCacheCounters.renderUs);
+  Serial.println("╟───────────────────────────────────────────────────────────╢");
+  Serial.println("║ Swipe → page done   Count    Avg us    Max us   Last us   ║");
+  const char* const labels[2] = { "Live redraw", "Cache blit " };
+  for (int i = 0; i < 2; i++) {
+    const SwipeStats& s = swipeStats[i];
+    Serial.printf("║ %-16s  %7u  %8u  %8u  %8u    ║\n",
+                  labels[i], s.count, s.count ? s.totalUs / s.count : 0, s.maxUs, s.lastUs);
+  }
+  Serial.println("╚═══════════════════════════════════════════════════════════╝");
+}
+
+#endif // HOME_CACHE_H
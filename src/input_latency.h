@@ -0,0 +1,198 @@
+#ifndef INPUT_LATENCY_H
+#define INPUT_LATENCY_H
+
+/*
+ * ═══════════════════════════════════════════════════════════════════════
+ * BLACKROAD INPUT LATENCY - touch-to-photon tracing
+ * ═══════════════════════════════════════════════════════════════════════
+ *
+ * Every gesture the UI acts on is traced through four stamps:
+ *
+ *   PENIRQ edge ──decide──▶ gesture ──queue──▶ handler ──start──▶ first
+ *   pixel ──draw──▶ last pixel
+ *
+ * "decide" is how long the recognizer needed (for a tap that includes
+ * the finger resting on the glass), "queue" is the wait for loop(),
+ * "start" the handler work before the panel is touched and "draw" the
+ * SPI writes up to the last one. TFT_eSPI writes block until the bytes
+ * are on the bus, so the last leaf write is the final flush.
+ *
+ * Pixels are stamped from the render profiler (every leaf write with
+ * RENDER_PROFILER=1, full screen draws only without it). Traces are kept
+ * per screen shown afterwards: an IRQ-to-photon histogram plus the
+ * average of each stage. LATENCY prints them; Settings shows p50/p90.
+ */
+
+// ─────────────────────────────────────────────────────────────────────
+// CONFIGURATION
+// ─────────────────────────────────────────────────────────────────────
+
+#define LATENCY_MAX_SCREENS  32
+#define LATENCY_BUCKETS      9
+
+// Histogram upper bounds in ms (last bucket is everything above)
+const uint16_t LATENCY_BUCKET_MS[LATENCY_BUCKETS - 1] = { 25, 50, 75, 100, 150, 200, 300, 500 };
+
+// ─────────────────────────────────────────────────────────────────────
+// TRACES
+// ─────────────────────────────────────────────────────────────────────
+
+struct LatencyTrace {
+  bool open;
+  bool drew;
+  uint32_t irqUs;
+  uint32_t decidedUs;
+  uint32_t dispatchUs;
+  uint32_t firstPixelUs;
+  uint32_t lastPixelUs;
+};
+
+struct ScreenLatency {
+  uint32_t samples;
+  uint16_t hist[LATENCY_BUCKETS];   // PENIRQ edge -> last pixel
+  uint32_t maxUs;
+  uint32_t decideSumUs;
+  uint32_t queueSumUs;
+  uint32_t startSumUs;
+  uint32_t drawSumUs;
+};
+
+LatencyTrace latencyTrace = { false, false, 0, 0, 0, 0, 0 };
+ScreenLatency screenLatency[LATENCY_MAX_SCREENS];
+uint32_t latencyNoRedraw = 0;   // gestures that changed no pixels
+
+// Gesture decided at `decidedUs` for a stroke whose PENIRQ fired at `irqUs`
+void latencyBegin(uint32_t irqUs, uint32_t decidedUs) {
+  latencyTrace.open = true;
+  latencyTrace.drew = false;
+  latencyTrace.irqUs = irqUs;
+  latencyTrace.decidedUs = decidedUs;
+  latencyTrace.dispatchUs = micros();
+}
+
+// Panel write finished (called by the render profiler)
+inline void latencyPixels() {
+  if (!latencyTrace.open) return;
+  uint32_t now = micros();
+  if (!latencyTrace.drew) {
+    latencyTrace.drew = true;
+    latencyTrace.firstPixelUs = now;
+  }
+  latencyTrace.lastPixelUs = now;
+}
+
+// A full screen draw is starting - counts as the first pixel
+inline void latencyDrawStart() {
+  if (!latencyTrace.open || latencyTrace.drew) return;
+  latencyTrace.drew = true;
+  latencyTrace.firstPixelUs = latencyTrace.lastPixelUs = micros();
+}
+
+uint8_t latencyBucket(uint32_t us) {
+  uint8_t b = 0;
+  while (b < LATENCY_BUCKETS - 1 && us > LATENCY_BUCKET_MS[b] * 1000UL) b++;
+  return b;
+}
+
+// Handler returned; file the trace under the screen now showing
+void latencyEnd(int screen) {
+  if (!latencyTrace.open) return;
+  latencyTrace.open = false;
+  if (!latencyTrace.drew) {
+    latencyNoRedraw++;
+    return;
+  }
+
+  const LatencyTrace& t = latencyTrace;
+  uint32_t total = t.lastPixelUs - t.irqUs;
+  ScreenLatency& s = screenLatency[screen < LATENCY_MAX_SCREENS ? screen : LATENCY_MAX_SCREENS - 1];
+  s.samples++;
+  uint16_t& bucket = s.hist[latencyBucket(total)];
+  if (bucket < 0xFFFF) bucket++;
+  if (total > s.maxUs) s.maxUs = total;
+  s.decideSumUs += t.decidedUs - t.irqUs;
+  s.queueSumUs += t.dispatchUs - t.decidedUs;
+  s.startSumUs += t.firstPixelUs - t.dispatchUs;
+  s.drawSumUs += t.lastPixelUs - t.firstPixelUs;
+}
+
+// ─────────────────────────────────────────────────────────────────────
+// REPORT
+// ─────────────────────────────────────────────────────────────────────
+
+// Upper bound (ms) of the bucket holding percentile `pct`, 0 = over 500
+uint16_t latencyPercentile(const uint16_t* hist, uint32_t samples, uint8_t pct) {
+  uint32_t rank = (samples * pct + 99) / 100, seen = 0;
+  for (uint8_t b = 0; b < LATENCY_BUCKETS - 1; b++) {
+    seen += hist[b];
+    if (seen >= rank) return LATENCY_BUCKET_MS[b];
+  }
+  return 0;
+}
+
+// All screens folded into one histogram
+uint32_t latencyTotals(uint16_t* hist) {
+  uint32_t samples = 0;
+  memset(hist, 0, LATENCY_BUCKETS * sizeof(uint16_t));
+  for (int i = 0; i < LATENCY_MAX_SCREENS; i++) {
+    samples += screenLatency[i].samples;
+    for (int b = 0; b < LATENCY_BUCKETS; b++) hist[b] += screenLatency[i].hist[b];
+  }
+  return samples;
+}
+
+// "<75" / ">500" for a percentile bound
+void latencyBoundStr(char* buf, size_t len, uint16_t ms) {
+  if (ms) snprintf(buf, len, "<%u", ms);
+  else snprintf(buf, len, ">%u", LATENCY_BUCKET_MS[LATENCY_BUCKETS - 2]);
+}
+
+// One line for the Settings screen
+void latencySummary(char* buf, size_t len) {
+  uint16_t hist[LATENCY_BUCKETS];
+  uint32_t samples = latencyTotals(hist);
+  if (!samples) {
+    snprintf(buf, len, "Touch: no samples");
+    return;
+  }
+  char p50[8], p90[8];
+  latencyBoundStr(p50, sizeof(p50), latencyPercentile(hist, samples, 50));
+  latencyBoundStr(p90, sizeof(p90), latencyPercentile(hist, samples, 90));
+  snprintf(buf, len, "Touch p50%s p90%sms", p50, p90);
+}
+
+void resetLatencyStats() {
+  memset(screenLatency, 0, sizeof(screenLatency));
+  latencyNoRedraw = 0;
+}
+
+void printLatencyReport(const char* const* screenNames, int screenCount) {
+  char p50[8], p90[8];
+
+  Serial.println("\n━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━");
+  Serial.println("   TOUCH-TO-PHOTON LATENCY (PENIRQ edge -> last pixel, ms)");
+  Serial.println("━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━");
+  Serial.printf("   %-18s %4s %6s %5s %5s | %6s %5s %5s %5s\n",
+                "Screen", "N", "p50", "p90", "max", "decide", "queue", "start", "draw");
+  for (int i = 0; i < screenCount && i < LATENCY_MAX_SCREENS; i++) {
+    const ScreenLatency& s = screenLatency[i];
+    if (!s.samples) continue;
+    latencyBoundStr(p50, sizeof(p50), latencyPercentile(s.hist, s.samples, 50));
+    latencyBoundStr(p90, sizeof(p90), latencyPercentile(s.hist, s.samples, 90));
+    Serial.printf("   %-18s %4u %6s %5s %5u | %6u %5u %5u %5u\n", screenNames[i], s.samples, p50, p90,
+                  s.maxUs / 1000, s.decideSumUs / s.samples / 1000, s.queueSumUs / s.samples / 1000,
+                  s.startSumUs / s.samples / 1000, s.drawSumUs / s.samples / 1000);
+  }
+
+  uint16_t hist[LATENCY_BUCKETS];
+  uint32_t samples = latencyTotals(hist);
+  Serial.print("   All screens:");
+  for (int b = 0; b < LATENCY_BUCKETS; b++) {
+    if (b < LATENCY_BUCKETS - 1) Serial.printf(" <%u:%u", LATENCY_BUCKET_MS[b], hist[b]);
+    else Serial.printf(" >%u:%u", LATENCY_BUCKET_MS[b - 1], hist[b]);
+  }
+  Serial.printf("\n   Traced:       %u gestures, %u changed no pixels\n", samples + latencyNoRedraw, latencyNoRedraw);
+  Serial.println("━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━\n");
+}
+
+#endif // INPUT_LATENCY_H
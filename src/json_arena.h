@@ -0,0 +1,262 @@
+#ifndef JSON_ARENA_H
+#define JSON_ARENA_H
+
+/*
+ * ═══════════════════════════════════════════════════════════════════════
+ * BLACKROAD JSON ARENA - shared parse buffers for every fetcher
+ * ═══════════════════════════════════════════════════════════════════════
+ *
+ * Each fetcher used to allocate its own DynamicJsonDocument (1 KB AI
+ * health up to 32 KB CRM file) and free it a moment later. Those spikes
+ * are the allocations that fail first once the heap is in pieces, and
+ * they leave holes of their own behind.
+ *
+ * initJsonArena() reserves the small slot at boot, before WiFi and the
+ * home cache carve up the heap. The large slot is reserved by the first
+ * caller that needs it (builds without api_functions.h never pay for
+ * it) and is MEM_COLD, so it lands in PSRAM when the board has it
+ * (mem_placement.h). Neither is ever freed:
+ *
+ *   slot    internal   PSRAM    serves
+ *   small   4 KB       -        nav fetchers (mesh, CRM, leads, AI)
+ *   large   16 KB      32 KB    GitHub, Stripe, Linear, CRM/stats files
+ *
+ * A JsonLease borrows the smallest free slot that fits its caller for one
+ * scope and hands it back in the destructor:
+ *
+ *   JsonLease lease(JSON_MESH);
+ *   JsonDocument& doc = lease.doc;
+ *   deserializeJson(doc, payload);
+ *
+ * Capacities live in JSON_CALLERS, not at the call sites. A caller that
+ * needs more than the largest slot, or finds every fitting slot busy,
+ * gets a heap document as before and counts as a spill. ARENA prints
+ * leases, spills and the peak bytes each caller really used.
+ */
+
+#include <ArduinoJson.h>
+#include <esp_heap_caps.h>
+#include <atomic>
+#include <utility>
+#include "mem_placement.h"
+
+// ─────────────────────────────────────────────────────────────────────
+// CONFIGURATION
+// ─────────────────────────────────────────────────────────────────────
+
+#define JSON_ARENA_SMALL           4096
+#define JSON_ARENA_LARGE_INTERNAL  16384
+#define JSON_ARENA_LARGE_PSRAM     32768
+#define JSON_ARENA_SLOTS           2     // small first - leases take the first fit
+
+enum JsonCaller : uint8_t {
+  JSON_MESH,           // dynamic_nav.h
+  JSON_CRM_STATS,
+  JSON_HOT_LEADS,
+  JSON_AI_HEALTH,
+  JSON_GITHUB,         // api_functions.h
+  JSON_GITHUB_COMMIT,
+  JSON_CRYPTO,
+  JSON_WEATHER,
+  JSON_STRIPE,
+  JSON_LINEAR,
+  JSON_CRM_FILE,
+  JSON_STATS_FILE,
+  JSON_CALLER_COUNT
+};
+
+struct JsonCallerInfo {
+  const char* name;
+  uint16_t capacity;   // document pool bytes
+};
+
+const JsonCallerInfo JSON_CALLERS[JSON_CALLER_COUNT] = {
+  { "mesh",           4096 },
+  { "crm stats",      2048 },
+  { "hot leads",      4096 },
+  { "ai health",      1024 },
+  { "github",        16384 },
+  { "github commit",  4096 },
+  { "crypto",         2048 },
+  { "weather",        4096 },
+  { "stripe",         8192 },
+  { "linear",         8192 },
+  { "crm file",      32768 },
+  { "stats file",     4096 },
+};
+
+// ─────────────────────────────────────────────────────────────────────
+// SLOTS + STATS
+// ─────────────────────────────────────────────────────────────────────
+
+struct JsonArenaSlot {
+  uint8_t* buf;        // nullptr until reserved
+  size_t size;         // 0 = could not be reserved, every lease spills
+  bool psram;
+  std::atomic<bool> leased;
+  bool inDoc;          // pool handed to the lease's document
+  uint32_t leases;
+  size_t peak;         // most bytes any document used
+};
+
+struct JsonCallerStats {
+  uint32_t leases;
+  uint32_t spills;     // served from the heap instead
+  uint32_t noMemory;   // document full or not allocated - parse failed
+  size_t peak;
+};
+
+const char* const JSON_SLOT_NAMES[JSON_ARENA_SLOTS] = { "small", "large" };
+
+JsonArenaSlot jsonArenaSlots[JSON_ARENA_SLOTS];
+JsonCallerStats jsonCallerStats[JSON_CALLER_COUNT];
+
+// ─────────────────────────────────────────────────────────────────────
+// DOCUMENT ALLOCATOR
+// ─────────────────────────────────────────────────────────────────────
+
+// BasicJsonDocument allocator bound to one slot (-1 = heap). A second
+// pool from the same document (garbageCollect copies) goes to the heap.
+struct JsonArenaAllocator {
+  int8_t slot;
+
+  explicit JsonArenaAllocator(int8_t s = -1) : slot(s) {}
+
+  void* allocate(size_t n) {
+    if (slot >= 0) {
+      JsonArenaSlot& s = jsonArenaSlots[slot];
+      if (!s.inDoc && n <= s.size) {
+        s.inDoc = true;
+        return s.buf;
+      }
+    }
+    return malloc(n);
+  }
+
+  void deallocate(void* p) {
+    if (slot >= 0 && p == jsonArenaSlots[slot].buf) jsonArenaSlots[slot].inDoc = false;
+    else free(p);
+  }
+
+  void* reallocate(void* p, size_t n) {
+    if (slot >= 0 && p == jsonArenaSlots[slot].buf) return n <= jsonArenaSlots[slot].size ? p : nullptr;
+    return realloc(p, n);
+  }
+};
+
+typedef BasicJsonDocument<JsonArenaAllocator> ArenaJsonDocument;
+
+// Large slot is MEM_COLD (PSRAM size when a block that big is free), the
+// small one MEM_HOT; sets size to 0 on failure
+void jsonArenaReserve(JsonArenaSlot& s, size_t internal, size_t psram) {
+  bool cold = psram && memPsramLargest() >= psram;
+  s.size = cold ? psram : internal;
+  s.buf = (uint8_t*)memAlloc(s.size, cold ? MEM_COLD : MEM_HOT, MEM_JSON_ARENA);
+  s.psram = memInPsram(s.buf);
+  if (!s.buf) s.size = 0;
+}
+
+// First free slot that holds `capacity` (reserving the large one on first
+// use), -1 if none
+int8_t jsonArenaAcquire(size_t capacity) {
+  for (int8_t i = 0; i < JSON_ARENA_SLOTS; i++) {
+    JsonArenaSlot& s = jsonArenaSlots[i];
+    if (capacity > s.size) continue;
+    bool expected = false;
+    if (!s.leased.compare_exchange_strong(expected, true)) continue;
+    if (!s.buf) jsonArenaReserve(s, JSON_ARENA_LARGE_INTERNAL, JSON_ARENA_LARGE_PSRAM);
+    if (s.buf && capacity <= s.size) return i;
+    s.leased.store(false);
+  }
+  return -1;
+}
+
+// ─────────────────────────────────────────────────────────────────────
+// LEASE
+// ─────────────────────────────────────────────────────────────────────
+
+class JsonLease {
+  JsonCaller who;
+  int8_t slot;
+
+public:
+  ArenaJsonDocument doc;
+
+  explicit JsonLease(JsonCaller caller)
+    : who(caller),
+      slot(jsonArenaAcquire(JSON_CALLERS[caller].capacity)),
+      doc(JSON_CALLERS[caller].capacity, JsonArenaAllocator(slot)) {}
+
+  // Stats, then the document's pool, then the slot. Left to member
+  // destruction, ~doc would clear inDoc only after leased was false, and
+  // the net task could lease a slot that still looked in use
+  ~JsonLease() {
+    JsonCallerStats& c = jsonCallerStats[who];
+    size_t used = doc.memoryUsage();
+    c.leases++;
+    if (used > c.peak) c.peak = used;
+    if (doc.capacity() == 0 || doc.overflowed()) c.noMemory++;
+    if (slot < 0) {
+      c.spills++;
+      return;
+    }
+    JsonArenaSlot& s = jsonArenaSlots[slot];
+    s.leases++;
+    if (used > s.peak) s.peak = used;
+    { ArenaJsonDocument released(std::move(doc)); }   // frees the pool, leaves doc empty
+    s.leased.store(false);
+  }
+
+  JsonLease(const JsonLease&) = delete;
+  JsonLease& operator=(const JsonLease&) = delete;
+};
+
+// ─────────────────────────────────────────────────────────────────────
+// SETUP + REPORT
+// ─────────────────────────────────────────────────────────────────────
+
+void initJsonArena() {
+  JsonArenaSlot& small = jsonArenaSlots[0];
+  JsonArenaSlot& large = jsonArenaSlots[1];
+  jsonArenaReserve(small, JSON_ARENA_SMALL, 0);
+  large.buf = nullptr;   // on first use
+  large.psram = false;
+  large.size = psramFound() ? JSON_ARENA_LARGE_PSRAM : JSON_ARENA_LARGE_INTERNAL;
+  Serial.printf("JSON arena: %u B small slot, %u B large slot on first use\n",
+                (unsigned)small.size, (unsigned)large.size);
+}
+
+void resetJsonArenaStats() {
+  memset(jsonCallerStats, 0, sizeof(jsonCallerStats));
+  for (int i = 0; i < JSON_ARENA_SLOTS; i++) {
+    jsonArenaSlots[i].leases = 0;
+    jsonArenaSlots[i].peak = 0;
+  }
+}
+
+void printJsonArenaReport() {
+  Serial.println("\n━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━");
+  Serial.println("   JSON ARENA");
+  Serial.println("━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━");
+  for (int i = 0; i < JSON_ARENA_SLOTS; i++) {
+    const JsonArenaSlot& s = jsonArenaSlots[i];
+    char label[16];
+    snprintf(label, sizeof(label), "Slot %s:", JSON_SLOT_NAMES[i]);
+    Serial.printf("   %-14s%u B %s, %u leases, peak %u B%s\n", label, (unsigned)s.size,
+                  !s.buf ? "not reserved" : s.psram ? "PSRAM" : "internal", s.leases, (unsigned)s.peak,
+                  s.leased.load() ? ", leased" : "");
+  }
+  Serial.println("   Caller         Leases  Capacity    Peak  Spills  NoMem");
+  for (int c = 0; c < JSON_CALLER_COUNT; c++) {
+    const JsonCallerStats& st = jsonCallerStats[c];
+    if (!st.leases) continue;
+    Serial.printf("   %-14s %6u %9u %7u %7u %6u\n", JSON_CALLERS[c].name, st.leases,
+                  JSON_CALLERS[c].capacity, (unsigned)st.peak, st.spills, st.noMemory);
+  }
+  Serial.printf("   Heap:         %u KB free, largest block %u KB\n",
+                (unsigned)(heap_caps_get_free_size(MALLOC_CAP_8BIT) / 1024),
+                (unsigned)(heap_caps_get_largest_free_block(MALLOC_CAP_8BIT) / 1024));
+  Serial.println("━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━\n");
+}
+
+#endif // JSON_ARENA_H
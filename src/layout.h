@@ -0,0 +1,340 @@
+#ifndef LAYOUT_H
+#define LAYOUT_H
+
+/*
+ * ═══════════════════════════════════════════════════════════════════════
+ * BLACKROAD DECLARATIVE LAYOUT ENGINE
+ * ═══════════════════════════════════════════════════════════════════════
+ *
+ * Screens are described once as data - a constexpr array of LayoutOp -
+ * and one interpreter both renders and hit-tests them. The arrays are
+ * `constexpr`, so the compiler folds them into .rodata and they live in
+ * flash (DROM) instead of being rebuilt by hundreds of lines of code.
+ *
+ * Dynamic values come in through small binding tables:
+ *   - text bindings  format a value into a caller-supplied buffer
+ *   - conditions     gate an IF ... ENDIF block
+ *   - counts         drive a REPEAT ... ENDREPEAT list
+ *   - natives        call an existing draw function (status bar etc.)
+ *
+ * The tables are plain arrays of function pointers registered once with
+ * layoutBind(); this header knows nothing about the screens themselves.
+ * Buttons and hit regions feed the hit-test index (hit_test.h) as they
+ * are drawn.
+ */
+
+#include <TFT_eSPI.h>
+#include "hit_test.h"
+
+// ─────────────────────────────────────────────────────────────────────
+// DRAW-OP FORMAT
+// ─────────────────────────────────────────────────────────────────────
+
+enum LayoutOpCode : uint8_t {
+  LOP_END = 0,          // terminator
+  LOP_FILL_SCREEN,      // color
+  LOP_FILL_RECT,        // x,y,w,h,color
+  LOP_FILL_ROUND_RECT,  // x,y,w,h,param=radius,color
+  LOP_DRAW_ROUND_RECT,  // x,y,w,h,param=radius,color
+  LOP_FILL_CIRCLE,      // x,y=center, w=radius, color
+  LOP_HLINE,            // x,y,w,color
+  LOP_TEXT,             // ref=text, x,y, param=datum, font, color
+  LOP_BIND_TEXT,        // ref=prefix (may be null), arg=binding, x,y, datum, font, color
+  LOP_BUTTON,           // filled round rect + centred label + hit region (arg=action)
+  LOP_HIT,              // invisible hit region (arg=action)
+  LOP_IF,               // arg=condition, runs block up to matching LOP_ENDIF
+  LOP_IF_NOT,           // inverse of LOP_IF
+  LOP_ENDIF,
+  LOP_REPEAT,           // arg=count binding, h=row step in px, block up to LOP_ENDREPEAT
+  LOP_ENDREPEAT,
+  LOP_NATIVE,           // arg=native draw function
+  LOP_INCLUDE           // ref=another LayoutOp list (shared fragments)
+};
+
+// 20 bytes per op on ESP32. Field meaning depends on the opcode (see above).
+struct LayoutOp {
+  uint8_t op;
+  uint8_t arg;          // binding / condition / action / native id
+  uint8_t font;         // TFT_eSPI font number (text ops and button labels)
+  uint8_t param;        // corner radius for shapes, text datum for text ops
+  int16_t x, y, w, h;
+  uint16_t color;       // fill / stroke / text color
+  uint16_t color2;      // button label color
+  const void* ref;      // const char* text or const LayoutOp* fragment
+};
+
+// ─────────────────────────────────────────────────────────────────────
+// OP BUILDERS (constexpr - evaluated by the compiler)
+// ─────────────────────────────────────────────────────────────────────
+
+constexpr LayoutOp L_FILL_SCREEN(uint16_t color) {
+  return LayoutOp{LOP_FILL_SCREEN, 0, 0, 0, 0, 0, 0, 0, color, 0, nullptr};
+}
+constexpr LayoutOp L_FILL_RECT(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+  return LayoutOp{LOP_FILL_RECT, 0, 0, 0, x, y, w, h, color, 0, nullptr};
+}
+constexpr LayoutOp L_FILL_ROUND_RECT(int16_t x, int16_t y, int16_t w, int16_t h, uint8_t r, uint16_t color) {
+  return LayoutOp{LOP_FILL_ROUND_RECT, 0, 0, r, x, y, w, h, color, 0, nullptr};
+}
+constexpr LayoutOp L_DRAW_ROUND_RECT(int16_t x, int16_t y, int16_t w, int16_t h, uint8_t r, uint16_t color) {
+  return LayoutOp{LOP_DRAW_ROUND_RECT, 0, 0, r, x, y, w, h, color, 0, nullptr};
+}
+constexpr LayoutOp L_FILL_CIRCLE(int16_t cx, int16_t cy, int16_t r, uint16_t color) {
+  return LayoutOp{LOP_FILL_CIRCLE, 0, 0, 0, cx, cy, r, 0, color, 0, nullptr};
+}
+constexpr LayoutOp L_HLINE(int16_t x, int16_t y, int16_t w, uint16_t color) {
+  return LayoutOp{LOP_HLINE, 0, 0, 0, x, y, w, 1, color, 0, nullptr};
+}
+constexpr LayoutOp L_TEXT(const char* text, int16_t x, int16_t y, uint8_t datum, uint8_t font, uint16_t color) {
+  return LayoutOp{LOP_TEXT, 0, font, datum, x, y, 0, 0, color, 0, text};
+}
+constexpr LayoutOp L_BIND_TEXT(const char* prefix, uint8_t binding, int16_t x, int16_t y, uint8_t datum, uint8_t font, uint16_t color) {
+  return LayoutOp{LOP_BIND_TEXT, binding, font, datum, x, y, 0, 0, color, 0, prefix};
+}
+constexpr LayoutOp L_BUTTON(int16_t x, int16_t y, int16_t w, int16_t h, uint8_t r, uint16_t color,
+                            const char* label, uint8_t font, uint16_t labelColor, uint8_t action) {
+  return LayoutOp{LOP_BUTTON, action, font, r, x, y, w, h, color, labelColor, label};
+}
+constexpr LayoutOp L_HIT(int16_t x, int16_t y, int16_t w, int16_t h, uint8_t action) {
+  return LayoutOp{LOP_HIT, action, 0, 0, x, y, w, h, 0, 0, nullptr};
+}
+constexpr LayoutOp L_IF(uint8_t cond) {
+  return LayoutOp{LOP_IF, cond, 0, 0, 0, 0, 0, 0, 0, 0, nullptr};
+}
+constexpr LayoutOp L_IF_NOT(uint8_t cond) {
+  return LayoutOp{LOP_IF_NOT, cond, 0, 0, 0, 0, 0, 0, 0, 0, nullptr};
+}
+constexpr LayoutOp L_ENDIF() {
+  return LayoutOp{LOP_ENDIF, 0, 0, 0, 0, 0, 0, 0, 0, 0, nullptr};
+}
+constexpr LayoutOp L_REPEAT(uint8_t countBinding, int16_t rowStep) {
+  return LayoutOp{LOP_REPEAT, countBinding, 0, 0, 0, 0, 0, rowStep, 0, 0, nullptr};
+}
+constexpr LayoutOp L_ENDREPEAT() {
+  return LayoutOp{LOP_ENDREPEAT, 0, 0, 0, 0, 0, 0, 0, 0, 0, nullptr};
+}
+constexpr LayoutOp L_NATIVE(uint8_t fn) {
+  return LayoutOp{LOP_NATIVE, fn, 0, 0, 0, 0, 0, 0, 0, 0, nullptr};
+}
+constexpr LayoutOp L_INCLUDE(const LayoutOp* fragment) {
+  return LayoutOp{LOP_INCLUDE, 0, 0, 0, 0, 0, 0, 0, 0, 0, fragment};
+}
+constexpr LayoutOp L_END() {
+  return LayoutOp{LOP_END, 0, 0, 0, 0, 0, 0, 0, 0, 0, nullptr};
+}
+
+// ─────────────────────────────────────────────────────────────────────
+// BUILD-TIME VALIDATION
+// ─────────────────────────────────────────────────────────────────────
+// C++11 constexpr (single return), so these recurse instead of looping.
+// Use with static_assert next to each layout definition.
+
+constexpr int layoutDepthDelta(const LayoutOp& op) {
+  return (op.op == LOP_IF || op.op == LOP_IF_NOT || op.op == LOP_REPEAT) ? 1 :
+         (op.op == LOP_ENDIF || op.op == LOP_ENDREPEAT) ? -1 : 0;
+}
+
+constexpr bool layoutWellFormed(const LayoutOp* ops, size_t n, size_t i = 0, int depth = 0) {
+  return depth < 0 ? false :
+         i + 1 >= n ? (depth == 0 && ops[i].op == LOP_END) :
+         (ops[i].op == LOP_END ? false :
+          layoutWellFormed(ops, n, i + 1, depth + layoutDepthDelta(ops[i])));
+}
+
+#define LAYOUT_VALID(ops) layoutWellFormed(ops, sizeof(ops) / sizeof(ops[0]))
+
+// ─────────────────────────────────────────────────────────────────────
+// BINDING TABLES
+// ─────────────────────────────────────────────────────────────────────
+
+typedef void (*LayoutTextFn)(char* out, size_t len, uint8_t row);
+typedef bool (*LayoutCondFn)(uint8_t row);
+typedef uint8_t (*LayoutCountFn)();
+typedef void (*LayoutNativeFn)();
+
+struct LayoutBindings {
+  const LayoutTextFn* text;
+  const LayoutCondFn* cond;
+  const LayoutCountFn* count;
+  const LayoutNativeFn* native;
+};
+
+LayoutBindings layoutBindings = {nullptr, nullptr, nullptr, nullptr};
+
+void layoutBind(const LayoutTextFn* text, const LayoutCondFn* cond,
+                const LayoutCountFn* count, const LayoutNativeFn* native) {
+  layoutBindings.text = text;
+  layoutBindings.cond = cond;
+  layoutBindings.count = count;
+  layoutBindings.native = native;
+}
+
+// Extra pixels around hit regions (finger-friendly, matches old handlers)
+#define LAYOUT_HIT_SLOP 2
+#define LAYOUT_TEXT_MAX 96
+
+// ─────────────────────────────────────────────────────────────────────
+// INTERPRETER
+// ─────────────────────────────────────────────────────────────────────
+
+bool layoutHitsOnly = false;   // hit-test walks register instead of testing
+
+void layoutAddHit(const LayoutOp& op, int16_t y) {
+  hitAdd(op.x - LAYOUT_HIT_SLOP, y - LAYOUT_HIT_SLOP,
+         op.w + 2 * LAYOUT_HIT_SLOP + 1, op.h + 2 * LAYOUT_HIT_SLOP + 1, op.arg);
+}
+
+// Index of the op closing the block opened at `open`
+size_t layoutBlockEnd(const LayoutOp* ops, size_t open) {
+  int depth = 0;
+  for (size_t i = open; ops[i].op != LOP_END; i++) {
+    depth += layoutDepthDelta(ops[i]);
+    if (depth == 0) return i;
+  }
+  return open;  // unreachable for layouts passing LAYOUT_VALID
+}
+
+// Walk ops [begin, end). Renders when gfx != nullptr; otherwise hit-tests
+// (hitX, hitY) and returns the first matching action id (0 = none).
+uint8_t layoutWalk(TFT_eSPI* gfx, const LayoutOp* ops, size_t begin, size_t end,
+                   int16_t yOff, uint8_t row, int16_t hitX, int16_t hitY) {
+  char buf[LAYOUT_TEXT_MAX];
+
+  for (size_t i = begin; i < end && ops[i].op != LOP_END; i++) {
+    const LayoutOp& op = ops[i];
+    int16_t y = op.y + yOff;
+
+    switch (op.op) {
+      case LOP_IF:
+      case LOP_IF_NOT: {
+        size_t close = layoutBlockEnd(ops, i);
+        bool taken = layoutBindings.cond[op.arg](row);
+        if (op.op == LOP_IF_NOT) taken = !taken;
+        if (taken) {
+          uint8_t hit = layoutWalk(gfx, ops, i + 1, close, yOff, row, hitX, hitY);
+          if (hit) return hit;
+        }
+        i = close;
+        break;
+      }
+
+      case LOP_REPEAT: {
+        size_t close = layoutBlockEnd(ops, i);
+        uint8_t rows = layoutBindings.count[op.arg]();
+        for (uint8_t r = 0; r < rows; r++) {
+          uint8_t hit = layoutWalk(gfx, ops, i + 1, close, yOff + r * op.h, r, hitX, hitY);
+          if (hit) return hit;
+        }
+        i = close;
+        break;
+      }
+
+      case LOP_INCLUDE: {
+        uint8_t hit = layoutWalk(gfx, (const LayoutOp*)op.ref, 0, SIZE_MAX, yOff, row, hitX, hitY);
+        if (hit) return hit;
+        break;
+      }
+
+      case LOP_BUTTON:
+      case LOP_HIT:
+        if (!gfx) {
+          if (layoutHitsOnly) {
+            layoutAddHit(op, y);
+            break;
+          }
+          if (hitX >= op.x - LAYOUT_HIT_SLOP && hitX <= op.x + op.w + LAYOUT_HIT_SLOP &&
+              hitY >= y - LAYOUT_HIT_SLOP && hitY <= y + op.h + LAYOUT_HIT_SLOP) {
+            return op.arg;
+          }
+          break;
+        }
+        layoutAddHit(op, y);
+        if (op.op == LOP_BUTTON) {
+          gfx->fillRoundRect(op.x, y, op.w, op.h, op.param, op.color);
+          gfx->setTextColor(op.color2);
+          gfx->setTextDatum(MC_DATUM);
+          gfx->drawString((const char*)op.ref, op.x + op.w / 2, y + op.h / 2, op.font);
+        }
+        break;
+
+      default:
+        if (!gfx) break;  // remaining ops only draw
+
+        switch (op.op) {
+          case LOP_FILL_SCREEN:     gfx->fillScreen(op.color); break;
+          case LOP_FILL_RECT:       gfx->fillRect(op.x, y, op.w, op.h, op.color); break;
+          case LOP_FILL_ROUND_RECT: gfx->fillRoundRect(op.x, y, op.w, op.h, op.param, op.color); break;
+          case LOP_DRAW_ROUND_RECT: gfx->drawRoundRect(op.x, y, op.w, op.h, op.param, op.color); break;
+          case LOP_FILL_CIRCLE:     gfx->fillCircle(op.x, y, op.w, op.color); break;
+          case LOP_HLINE:           gfx->drawFastHLine(op.x, y, op.w, op.color); break;
+          case LOP_NATIVE:          layoutBindings.native[op.arg](); break;
+
+          case LOP_TEXT:
+            gfx->setTextColor(op.color);
+            gfx->setTextDatum(op.param);
+            gfx->drawString((const char*)op.ref, op.x, y, op.font);
+            break;
+
+          case LOP_BIND_TEXT: {
+            size_t n = 0;
+            if (op.ref) {
+              n = strlcpy(buf, (const char*)op.ref, sizeof(buf));
+              if (n >= sizeof(buf)) n = sizeof(buf) - 1;
+            }
+            layoutBindings.text[op.arg](buf + n, sizeof(buf) - n, row);
+            gfx->setTextColor(op.color);
+            gfx->setTextDatum(op.param);
+            gfx->drawString(buf, op.x, y, op.font);
+            break;
+          }
+        }
+        break;
+    }
+  }
+
+  return 0;
+}
+
+void renderLayout(TFT_eSPI& gfx, const LayoutOp* ops) {
+  layoutWalk(&gfx, ops, 0, SIZE_MAX, 0, 0, 0, 0);
+}
+
+// Returns the action id under (x, y), or 0 if nothing was hit
+uint8_t hitTestLayout(const LayoutOp* ops, int x, int y) {
+  return layoutWalk(nullptr, ops, 0, SIZE_MAX, 0, 0, x, y);
+}
+
+// Adds a layout's regions to the open hit-test list without drawing it
+void registerLayoutHits(const LayoutOp* ops) {
+  layoutHitsOnly = true;
+  layoutWalk(nullptr, ops, 0, SIZE_MAX, 0, 0, 0, 0);
+  layoutHitsOnly = false;
+}
+
+// ─────────────────────────────────────────────────────────────────────
+// SIZE ACCOUNTING (for the LAYOUT benchmark)
+// ─────────────────────────────────────────────────────────────────────
+
+struct LayoutFootprint {
+  int ops;
+  size_t opBytes;
+  size_t textBytes;
+};
+
+// Flash used by a layout: op records plus static strings it references.
+// Included fragments are counted where they are defined, not per use.
+LayoutFootprint layoutFootprint(const LayoutOp* ops) {
+  LayoutFootprint fp = {0, 0, 0};
+  size_t i = 0;
+  for (; ops[i].op != LOP_END; i++) {
+    uint8_t op = ops[i].op;
+    if (ops[i].ref && (op == LOP_TEXT || op == LOP_BIND_TEXT || op == LOP_BUTTON)) {
+      fp.textBytes += strlen((const char*)ops[i].ref) + 1;
+    }
+  }
+  fp.ops = i + 1;
+  fp.opBytes = fp.ops * sizeof(LayoutOp);
+  return fp;
+}
+
+#endif // LAYOUT_H
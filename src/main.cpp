@@ -8,6 +8,17 @@
 // #include <ESPAsyncWebServer.h>  // Commented out - Emergency Pager doesn't need AI API server
 #include "config.h"
 #include "BlackRoadFont.h"     // BlackRoad Mono - Custom monospaced font system
+#include "render_profiler.h"   // Per-screen render + SPI accounting (RENDER command)
+#include "timer_wheel.h"       // Periodic + deferred work for loop() (TIMERS command)
+#include "feedback.h"          // Non-blocking LED + buzzer patterns (FEEDBACK command)
+#include "event_bus.h"         // Typed change events net/alerts -> UI (BUS command)
+#include "stall_detector.h"    // loop() budget, backtrace of overruns (STALLS command)
+#include "fixed_string.h"      // Heap-free strings + views for hot paths (no String churn)
+#include "mem_placement.h"     // Hot buffers internal, cold buffers PSRAM (MEM command)
+#include "json_arena.h"        // Shared JSON parse slots, per-caller peaks (ARENA command)
+#include "heap_trace.h"        // Per-subsystem heap attribution, HEAP_TRACE=1 (HEAP command)
+#include "serial_cmd.h"        // Ring-buffered line input, hashed command table (SERIAL command)
+#include "alert_dedupe.h"      // Hashed alert IDs with a TTL window (DEDUPE command)
 
 // BlackRoad OS Fortune 500 Infrastructure - 30,000 AI Employees
 // Real SSH connections to production servers via Tailscale mesh
@@ -18,7 +29,7 @@
 #define OCTAVIA_IP "192.168.4.74"
 #define SHELLFISH_IP "174.138.44.45"  // DigitalOcean
 
-TFT_eSPI tft = TFT_eSPI();
+RenderTFT tft = RenderTFT();  // TFT_eSPI with draw accounting
 BlackRoadFont brFont(&tft);  // BlackRoad Mono font system
 
 // ⚡ BLACKROAD OFFICIAL BRAND COLORS - 2026 SYSTEM (RGB565 format for TFT)
@@ -60,6 +71,11 @@ BlackRoadFont brFont(&tft);  // BlackRoad Mono font system
 #define ANIM_MEDIUM  200
 #define ANIM_SLOW    400
 
+#include "premium_ui.h"        // Gradients, glows, glass cards
+#include "BlackRoadUI.h"       // Easing + touch feedback helpers
+BlackRoadUI ui(&tft);
+#include "animation.h"         // Frame-paced animation scheduler
+
 // Touch configuration for ESP32-2432S028R (XPT2046)
 #define XPT2046_IRQ 36
 #define XPT2046_MOSI 32
@@ -70,6 +86,9 @@ BlackRoadFont brFont(&tft);  // BlackRoad Mono font system
 
 SPIClass touchSPI = SPIClass(VSPI);
 
+#include "touch_input.h"       // IRQ-driven sampler + touch event queue
+#include "gestures.h"          // tap / drag / fling / long-press / edge-back recognizer
+
 // Screen definitions
 enum Screen {
   SCREEN_LOCK,
@@ -103,17 +122,23 @@ enum Screen {
   SCREEN_CEO_COMMAND       // CEO Command Center - Ultimate aggregated dashboard
 };
 
+// Screen names for serial reports (same order as enum Screen)
+const char* const SCREEN_NAMES[] = {
+  "Lock", "Home", "AI Inference", "Messages", "CRM", "Mesh VPN", "Identity",
+  "Files", "APIs", "Settings", "Control Center", "Workflow", "Decisions",
+  "CEO Dashboard", "CEO Core", "Exec Grid", "BlackRoad Chat", "Meta",
+  "Terminal", "Keyboard", "Emergency Pager", "Alert History", "Weather",
+  "GitHub", "Linear", "Sovereign Stack", "Infrastructure", "Hot Leads",
+  "CEO Command"
+};
+#define SCREEN_COUNT (SCREEN_CEO_COMMAND + 1)
+static_assert(sizeof(SCREEN_NAMES) / sizeof(SCREEN_NAMES[0]) == SCREEN_COUNT, "SCREEN_NAMES out of sync with enum Screen");
+
 Screen currentScreen = SCREEN_LOCK;
 unsigned long lastTouchTime = 0;
 bool isLocked = false;
 
-// Swipe detection for page navigation
-int touchStartX = 0;
-int touchStartY = 0;
-int touchEndX = 0;
-int touchEndY = 0;
-bool touchActive = false;
-unsigned long touchStartTime = 0;
+// Home page navigation (swipes come from gestures.h)
 int currentPage = 0;
 const int TOTAL_PAGES = 3;
 const int SWIPE_THRESHOLD = 30;  // Reduced for quicker response
@@ -202,13 +227,6 @@ Alert alertHistory[10];
 int alertHistoryCount = 0;
 bool hasActiveAlert = false;
 
-// LED configuration for alert patterns
-#define LED_PIN 2  // ESP32 onboard LED
-
-// Alert deduplication cache
-String alertCache[20];
-int cacheIndex = 0;
-
 // LED Pattern IDs
 #define PATTERN_HEARTBEAT    0
 #define PATTERN_FAST_STROBE  1  // LINEAR P1, SLACK CRITICAL
@@ -220,9 +238,27 @@ int cacheIndex = 0;
 
 // Forward declarations for Emergency Pager functions
 void acknowledgeAlert();
-void parseAlert(String command);
+void clearAlert();
+void parseAlert(StrView args);
+bool raiseAlert(StrView source, StrView priority, StrView message);
 void sendStatus();
 void handleSerialCommand();
+void triggerLEDPattern(int patternId);
+
+// Network task, pager hooks and the nav snapshots (needs the pager globals above)
+#include "app_tasks.h"
+
+// Binary pager frames beside the text commands (FRAMES command)
+#include "pager_frame.h"
+
+// DFS + light sleep for loopIdle() (IDLE command)
+#include "power_idle.h"
+
+// Declarative layouts for pager, history, lock and nav bar (needs the globals above)
+#include "screen_layouts.h"
+
+// Pre-rendered home pages for instant swipes (needs apps[] above)
+#include "home_cache.h"
 
 // Emoji Grid stats (BETTER THAN iPHONE)
 int approveCount = 0;
@@ -397,65 +433,22 @@ bool keyboardVisible = false;         // Is keyboard overlay showing?
 Screen screenBeforeKeyboard = SCREEN_HOME;  // Return to this screen after keyboard
 
 // Haptic/Audio feedback (NO iPHONE HAS THIS!)
-#define BUZZER_PIN 25  // Can use any available GPIO
+// Pins, tones and timing live in feedback.h; these only queue a pattern
 void playBeep(int duration = 50) {
-  tone(BUZZER_PIN, 2000, duration);  // 2kHz beep
+  feedbackPlay(duration > 50 ? FB_BEEP_LONG : FB_BEEP);  // 2kHz beep
 }
 
 void playSuccess() {
-  tone(BUZZER_PIN, 1500, 50);
-  delay(60);
-  tone(BUZZER_PIN, 2000, 50);
+  feedbackPlay(FB_SUCCESS);
 }
 
 void playCritical() {
-  for(int i=0; i<3; i++) {
-    tone(BUZZER_PIN, 3000, 30);
-    delay(40);
-  }
-}
-
-// Touch calibration
-uint16_t readTouchX() {
-  touchSPI.beginTransaction(SPISettings(2000000, MSBFIRST, SPI_MODE0));
-  digitalWrite(XPT2046_CS, LOW);
-  touchSPI.transfer(0x90);
-  uint16_t x = touchSPI.transfer16(0x0000) >> 3;
-  digitalWrite(XPT2046_CS, HIGH);
-  touchSPI.endTransaction();
-  return x;
-}
-
-uint16_t readTouchY() {
-  touchSPI.beginTransaction(SPISettings(2000000, MSBFIRST, SPI_MODE0));
-  digitalWrite(XPT2046_CS, LOW);
-  touchSPI.transfer(0xD0);
-  uint16_t y = touchSPI.transfer16(0x0000) >> 3;
-  digitalWrite(XPT2046_CS, HIGH);
-  touchSPI.endTransaction();
-  return y;
+  feedbackPlay(FB_CRITICAL);
 }
 
-bool getTouchCoordinates(int &x, int &y) {
-  if (digitalRead(XPT2046_IRQ) == LOW) {
-    uint16_t rawX = readTouchX();
-    uint16_t rawY = readTouchY();
-    // LANDSCAPE rotation 1: swap and invert for touch alignment
-    x = map(rawY, 200, 3700, 0, 320);   // Y becomes X
-    y = map(rawX, 3700, 200, 0, 240);   // X becomes Y (inverted)
-    x = constrain(x, 0, 320);
-    y = constrain(y, 0, 240);
-
-    // Filter ONLY exact (0,0) ghost touches (hardware glitch)
-    if (x == 0 && y == 0) {
-      return false;  // Reject ghost touch
-    }
-
-    // Removed debug prints for better performance
-
-    return true;
-  }
-  return false;
+// Touch down or serial bytes waiting - animation frames yield to these
+bool animInputPending() {
+  return digitalRead(XPT2046_IRQ) == LOW || touchEventsPending() || serialPending();
 }
 
 // Clean minimal status bar - LANDSCAPE (320x240)
@@ -485,41 +478,45 @@ void drawStatusBar() {
   tft.drawString("100%", 312, 5, 2);
 }
 
-// Clean app icon with subtle shadow
-void drawAppIcon(App &app, bool pressed = false) {
+// Clean app icon with subtle shadow - drawn to the panel or a cache band
+void drawAppIcon(TFT_eSPI& gfx, App &app, bool pressed = false, int yOff = 0) {
   int cx = app.x + app.size/2;
-  int cy = app.y + app.size/2;
+  int cy = app.y + app.size/2 + yOff;
   int r = app.size/2;
 
   // Subtle shadow
   if (!pressed) {
-    tft.fillCircle(cx + 2, cy + 2, r, 0x0000);
+    gfx.fillCircle(cx + 2, cy + 2, r, 0x0000);
   }
 
   // Icon circle
   uint16_t fillColor = pressed ? COLOR_WHITE : app.color;
-  tft.fillCircle(cx, cy, r, fillColor);
+  gfx.fillCircle(cx, cy, r, fillColor);
 
   // Label
-  tft.setTextColor(pressed ? app.color : COLOR_WHITE);
-  tft.setTextDatum(MC_DATUM);
-  tft.drawString(app.name, cx, cy, 2);
+  gfx.setTextColor(pressed ? app.color : COLOR_WHITE);
+  gfx.setTextDatum(MC_DATUM);
+  gfx.drawString(app.name, cx, cy, 2);
 
   // Clean badge (small, right edge)
   if (app.badge > 0) {
     int bx = cx + r - 5;
     int by = cy - r + 5;
-    tft.fillCircle(bx, by, 7, COLOR_HOT_PINK);
-    tft.setTextColor(COLOR_WHITE);
-    tft.setTextDatum(MC_DATUM);
+    gfx.fillCircle(bx, by, 7, COLOR_HOT_PINK);
+    gfx.setTextColor(COLOR_WHITE);
+    gfx.setTextDatum(MC_DATUM);
     if (app.badge > 9) {
-      tft.drawString("9+", bx, by, 1);
+      gfx.drawString("9+", bx, by, 1);
     } else {
-      tft.drawString(String(app.badge), bx, by, 1);
+      gfx.drawString(String(app.badge), bx, by, 1);
     }
   }
 }
 
+void drawAppIcon(App &app, bool pressed = false) {
+  drawAppIcon(tft, app, pressed, 0);
+}
+
 // ==================== UI/UX ENHANCEMENTS ====================
 
 // Enhanced back button with shadow and better visuals (BETTER THAN iPHONE!)
@@ -548,49 +545,16 @@ void drawBackButton(bool pressed = false) {
 // Persistent Bottom Navigation Bar - LANDSCAPE (320x240)
 // Always visible on all screens except lock
 void drawNavBar() {
-  int barY = 210;  // Bottom 30px of screen
-  int barH = 30;
-  int btnW = 70;
-  int btnH = 26;
-  int btnY = barY + 2;
-
-  // Background
-  tft.fillRect(0, barY, 320, barH, 0x0841);
-  tft.drawFastHLine(0, barY, 320, COLOR_DARK_GRAY);
-
-  // ◀ Left arrow (x=10)
-  tft.fillRoundRect(10, btnY, btnW, btnH, 4, COLOR_DARK_GRAY);
-  tft.setTextColor(COLOR_CYBER_BLUE);
-  tft.setTextDatum(MC_DATUM);
-  tft.drawString("<", 45, btnY + btnH/2, 4);
-
-  // Home button (x=90)
-  tft.fillRoundRect(90, btnY, btnW, btnH, 4, COLOR_VIVID_PUR);
-  tft.setTextColor(COLOR_WHITE);
-  tft.drawString("HOME", 125, btnY + btnH/2, 2);
-
-  // ▶ Right arrow (x=170)
-  tft.fillRoundRect(170, btnY, btnW, btnH, 4, COLOR_DARK_GRAY);
-  tft.setTextColor(COLOR_CYBER_BLUE);
-  tft.drawString(">", 205, btnY + btnH/2, 4);
-
-  // Keyboard button (x=250)
-  tft.fillRoundRect(250, btnY, 60, btnH, 4, COLOR_HOT_PINK);
-  tft.setTextColor(COLOR_WHITE);
-  tft.drawString("KB", 280, btnY + btnH/2, 2);
+  renderLayout(tft, NAV_BAR_LAYOUT);
 }
 
-// Check if nav bar button was pressed - returns action
-// 0=none, 1=left, 2=home, 3=right, 4=keyboard
-int checkNavBarTouch(int x, int y) {
-  if (y < 210) return 0;  // Not in nav bar area
-
-  if (x >= 10 && x <= 80) return 1;    // Left arrow
-  if (x >= 90 && x <= 160) return 2;   // Home
-  if (x >= 170 && x <= 240) return 3;  // Right arrow
-  if (x >= 250 && x <= 310) return 4;  // Keyboard
-
-  return 0;
+// Repaint part of the home screen (animation damage restore)
+void drawHomeScreenLive();
+void restoreHomeRegion(const AnimRect& r) {
+  if (homeCacheBlitRect(currentPage, r.x, r.y, r.w, r.h)) return;
+  tft.setViewport(r.x, r.y, r.w, r.h, false);  // clip only, keep absolute coords
+  drawHomeScreenLive();
+  tft.resetViewport();
 }
 
 // Old bottom nav for compatibility
@@ -708,44 +672,28 @@ void drawNotificationDot(int x, int y, int count) {
 // ==================== SCREENS ====================
 
 void drawLockScreen() {
-  tft.fillScreen(COLOR_BLACK);
-
-  // Full landscape lock screen (320x240)
-  // Large time - centered
-  unsigned long mins = (millis() / 60000) % 60;
-  unsigned long hrs = (millis() / 3600000) % 24;
-  char timeStr[10];
-  sprintf(timeStr, "%02lu:%02lu", hrs, mins);
-
-  tft.setTextColor(COLOR_WHITE);
-  tft.setTextDatum(MC_DATUM);
-  tft.drawString(timeStr, 160, 70, 7);
-
-  // Date
-  tft.setTextColor(0x7BEF);
-  tft.drawString("Friday, January 10", 160, 115, 2);
-
-  // Accent line - wider for landscape
-  tft.drawFastHLine(100, 135, 120, COLOR_HOT_PINK);
-
-  // Brand
-  tft.setTextColor(COLOR_HOT_PINK);
-  tft.drawString("OPERATOR", 160, 160, 4);
+  // Full landscape lock screen (320x240) - see LOCK_LAYOUT
+  renderLayout(tft, LOCK_LAYOUT);
+}
 
-  // Swipe hint
-  tft.setTextColor(0x4208);
-  tft.drawString("swipe up to unlock", 160, 220, 2);
+// Page indicator dots above nav bar
+void drawPageDots(TFT_eSPI& gfx, int page, int yOff) {
+  int dotSpacing = 15;
+  int totalWidth = (TOTAL_PAGES - 1) * dotSpacing;
+  int startX = 160 - totalWidth / 2;
 
-  // Status indicators - proper landscape positions
-  if (WiFi.status() == WL_CONNECTED) {
-    tft.fillCircle(15, 12, 4, COLOR_CYBER_BLUE);
+  for (int p = 0; p < TOTAL_PAGES; p++) {
+    int dotX = startX + p * dotSpacing;
+    if (p == page) {
+      gfx.fillCircle(dotX, 200 + yOff, 4, COLOR_WHITE);  // Active page
+    } else {
+      gfx.fillCircle(dotX, 200 + yOff, 3, COLOR_DARK_GRAY);  // Inactive
+    }
   }
-  tft.setTextColor(COLOR_SUNRISE);
-  tft.setTextDatum(TR_DATUM);
-  tft.drawString("100%", 305, 8, 2);
 }
 
-void drawHomeScreen() {
+// Full redraw of the current page (cache miss, or clipped restores)
+void drawHomeScreenLive() {
   tft.fillScreen(COLOR_BLACK);
   drawStatusBar();
 
@@ -758,24 +706,52 @@ void drawHomeScreen() {
     }
   }
 
-  // Page indicator dots above nav bar
-  int dotSpacing = 15;
-  int totalWidth = (TOTAL_PAGES - 1) * dotSpacing;
-  int startX = 160 - totalWidth / 2;
-
-  for (int p = 0; p < TOTAL_PAGES; p++) {
-    int dotX = startX + p * dotSpacing;
-    if (p == currentPage) {
-      tft.fillCircle(dotX, 200, 4, COLOR_WHITE);  // Active page
-    } else {
-      tft.fillCircle(dotX, 200, 3, COLOR_DARK_GRAY);  // Inactive
-    }
-  }
+  drawPageDots(tft, currentPage, 0);
 
   // Draw persistent nav bar
   drawNavBar();
 }
 
+// App icon tap targets for one page (icon square, edges inclusive)
+void registerHomeHits(int page) {
+  int startIdx = page * APPS_PER_PAGE;
+  int endIdx = startIdx + APPS_PER_PAGE;
+  for (int i = startIdx; i < endIdx && i < APP_COUNT; i++) {
+    hitAdd(apps[i].x, apps[i].y, apps[i].size + 1, apps[i].size + 1, ACT_OPEN_APP, i);
+  }
+}
+
+void drawHomeScreen() {
+  registerHomeHits(currentPage);
+
+  // Grid comes from the page cache when it is warm
+  if (homeCacheReady(currentPage)) {
+    drawStatusBar();
+    homeCacheBlit(currentPage);
+    drawNavBar();
+    return;
+  }
+  drawHomeScreenLive();
+}
+
+// Page change on the home screen; status and nav bars stay as they are.
+// Latency is taken from `startUs` (the release that asked for it).
+void showHomePage(int page, unsigned long startUs) {
+  int from = currentPage;
+  currentPage = page;
+
+  bool cached = homeCacheSlide ? homeCacheSlideTo(from, page, page > from ? 1 : -1)
+                               : homeCacheBlit(page);
+  if (!cached) drawHomeScreenLive();
+  recordSwipe(cached, micros() - startUs);
+
+  // New page, new icons - nav bar targets are unchanged
+  hitBegin(SCREEN_HOME);
+  registerHomeHits(page);
+  registerLayoutHits(NAV_BAR_LAYOUT);
+  hitCommit();
+}
+
 void drawAIInference() {
   tft.fillScreen(COLOR_BLACK);
   drawStatusBar();
@@ -951,7 +927,7 @@ void drawSettingsScreen() {
   tft.setTextColor(COLOR_WHITE);
   tft.drawString("ESP32 @ 240MHz | 320KB RAM", 60, y, 1);
 
-  // Hardware metrics (compact!)
+  // Hardware metrics (compact! 20px pitch keeps the last row above the nav bar)
   y += 16;
 
   // CPU & Memory
@@ -966,7 +942,7 @@ void drawSettingsScreen() {
   tft.drawString("13.6%", 306, y+5, 1);
 
   // Flash & Firmware
-  y += 22;
+  y += 20;
   tft.fillRoundRect(10, y, 300, 18, 4, COLOR_DARK_GRAY);
   tft.setTextColor(COLOR_HOT_PINK); tft.setTextDatum(TL_DATUM);
   tft.drawString("FLASH", 14, y+4, 1);
@@ -978,7 +954,7 @@ void drawSettingsScreen() {
   tft.drawString("62.1%", 306, y+5, 1);
 
   // Network & WiFi
-  y += 22;
+  y += 20;
   tft.fillRoundRect(10, y, 300, 18, 4, COLOR_DARK_GRAY);
   tft.setTextColor(COLOR_CYBER_BLUE); tft.setTextDatum(TL_DATUM);
   tft.drawString("WiFi", 14, y+4, 2);
@@ -997,7 +973,7 @@ void drawSettingsScreen() {
   }
 
   // Device ID & MAC
-  y += 22;
+  y += 20;
   tft.fillRoundRect(10, y, 300, 18, 4, COLOR_DARK_GRAY);
   tft.setTextColor(COLOR_WARM); tft.setTextDatum(TL_DATUM);
   tft.drawString("ID", 14, y+4, 2);
@@ -1007,7 +983,7 @@ void drawSettingsScreen() {
   tft.drawString("20:e7:c8:ba:1b:94", 180, y+5, 1);
 
   // SSH Nodes
-  y += 22;
+  y += 20;
   tft.fillRoundRect(10, y, 300, 18, 4, COLOR_DARK_GRAY);
   tft.setTextColor(COLOR_MAGENTA); tft.setTextDatum(TL_DATUM);
   tft.drawString("SSH", 14, y+4, 2);
@@ -1017,7 +993,7 @@ void drawSettingsScreen() {
   tft.drawString("lucidia,octavia,alice...", 130, y+5, 1);
 
   // Uptime & Power
-  y += 22;
+  y += 20;
   tft.fillRoundRect(10, y, 300, 18, 4, COLOR_DARK_GRAY);
   tft.setTextColor(COLOR_SUNRISE); tft.setTextDatum(TL_DATUM);
   tft.drawString("PWR", 14, y+4, 2);
@@ -1029,14 +1005,16 @@ void drawSettingsScreen() {
   tft.drawString("500mA", 306, y+5, 1);
 
   // Display & Touch
-  y += 22;
+  y += 20;
   tft.fillRoundRect(10, y, 300, 18, 4, COLOR_DARK_GRAY);
   tft.setTextColor(COLOR_VIVID_PUR); tft.setTextDatum(TL_DATUM);
   tft.drawString("LCD", 14, y+4, 2);
   tft.setTextColor(COLOR_WHITE);
   tft.drawString("320×240 ILI9341", 60, y+5, 1);
   tft.setTextColor(COLOR_SUNRISE);
-  tft.drawString("XPT2046 Touch", 180, y+5, 1);
+  char touchLatency[32];
+  latencySummary(touchLatency, sizeof(touchLatency));  // touch -> pixels
+  tft.drawString(touchLatency, 170, y+5, 1);
 
   // Bottom stats - Sovereignty!
   tft.setTextColor(COLOR_HOT_PINK); tft.setTextDatum(TC_DATUM);
@@ -1228,31 +1206,27 @@ void drawMeshVPN() {
     tft.fillRoundRect(10, y, 300, 20, 4, COLOR_DARK_GRAY);
 
     // Node name - colored by status
-    uint16_t nodeColor = COLOR_WHITE;
-    if (meshNodes[i].status == "active") nodeColor = COLOR_VIVID_PUR;
-    else if (meshNodes[i].status == "idle") nodeColor = COLOR_SUNRISE;
-    else nodeColor = COLOR_HOT_PINK;
-
+    uint16_t nodeColor = NODE_STATUS_COLORS[meshNodes[i].status];
     tft.setTextColor(nodeColor);
     tft.setTextDatum(TL_DATUM);
-    String nodeName = meshNodes[i].name;
+    FixedString<9> nodeName = MESH_NODES[meshNodes[i].node].name;   // first 8 chars
     nodeName.toUpperCase();
-    tft.drawString(nodeName.substring(0, 8), 14, y+4, 2);
+    tft.drawString(nodeName.c_str(), 14, y+4, 2);
 
     // IP address
     tft.setTextColor(COLOR_WHITE);
-    String displayIP = meshNodes[i].ip;
+    char text[16], ip[16];
+    StrView displayIP = formatIPv4(meshNodes[i].ip, ip, sizeof(ip));
     if (displayIP.length() > 13) displayIP = displayIP.substring(displayIP.length() - 13);
-    tft.drawString(displayIP, 80, y+6, 1);
+    tft.drawString(displayIP.copyTo(text, sizeof(text)), 80, y+6, 1);
 
     // Latency
     tft.setTextColor(COLOR_SUNRISE);
-    tft.drawString(String(meshNodes[i].latency) + "ms", 170, y+6, 1);
+    tft.drawString(strfmt(text, sizeof(text), "%dms", meshNodes[i].latency), 170, y+6, 1);
 
     // Bandwidth
     tft.setTextColor(COLOR_CYBER_BLUE);
-    String bw = String(meshNodes[i].bandwidth, 1) + "MB/s";
-    tft.drawString(bw, 215, y+6, 1);
+    tft.drawString(strfmt(text, sizeof(text), "%.1fMB/s", meshNodes[i].bandwidth), 215, y+6, 1);
 
     // Online status dot
     tft.fillCircle(302, y+10, 4, meshNodes[i].online ? nodeColor : COLOR_HOT_PINK);
@@ -1991,6 +1965,7 @@ void drawTerminal() {
   tft.fillRoundRect(200, 215, 110, 20, 5, COLOR_CYBER_BLUE);
   tft.setTextColor(COLOR_BLACK); tft.setTextDatum(TC_DATUM);
   tft.drawString("⌨ KEYBOARD", 255, 219, 2);
+  hitAdd(200, 215, 111, 21, ACT_OPEN_KEYBOARD);
 
   drawBottomNav();  // Bottom navigation bar
 }
@@ -2027,6 +2002,7 @@ void drawKeyboard() {
     tft.setTextColor(COLOR_WHITE); tft.setTextDatum(MC_DATUM);
     char key[2] = {row1[i], '\0'};
     tft.drawString(key, x + keyWidth/2, y + keyHeight/2, 2);
+    hitAdd(x, y, keyWidth + 1, keyHeight + 1, ACT_KEY_CHAR, row1[i]);
   }
 
   // Row 2 (9 keys - centered)
@@ -2038,6 +2014,7 @@ void drawKeyboard() {
     tft.setTextColor(COLOR_WHITE); tft.setTextDatum(MC_DATUM);
     char key[2] = {row2[i], '\0'};
     tft.drawString(key, x + keyWidth/2, y + keyHeight/2, 2);
+    hitAdd(x, y, keyWidth + 1, keyHeight + 1, ACT_KEY_CHAR, row2[i]);
   }
 
   // Row 3 (7 keys - centered)
@@ -2049,6 +2026,7 @@ void drawKeyboard() {
     tft.setTextColor(COLOR_WHITE); tft.setTextDatum(MC_DATUM);
     char key[2] = {row3[i], '\0'};
     tft.drawString(key, x + keyWidth/2, y + keyHeight/2, 2);
+    hitAdd(x, y, keyWidth + 1, keyHeight + 1, ACT_KEY_CHAR, row3[i]);
   }
 
   // Bottom row: SPACE, BACKSPACE, ENTER, DONE
@@ -2073,6 +2051,12 @@ void drawKeyboard() {
   tft.fillRoundRect(235, y, 75, keyHeight, 3, COLOR_SUNRISE);
   tft.setTextColor(COLOR_BLACK);
   tft.drawString("DONE", 272, y + keyHeight/2, 2);
+
+  // Bottom row targets start a pixel above the keys (y=207-231)
+  hitAdd(10, y - 1, 101, keyHeight + 1, ACT_KEY_SPACE);
+  hitAdd(115, y - 1, 61, keyHeight + 1, ACT_KEY_BACKSPACE);
+  hitAdd(180, y - 1, 51, keyHeight + 1, ACT_KEY_ENTER);
+  hitAdd(235, y - 1, 76, keyHeight + 1, ACT_KEY_DONE);
 }
 
 void drawDecisions() {
@@ -2344,6 +2328,12 @@ void drawCEOCore() {
   tft.drawString("^", startX+(btnSize+gap)*2+btnSize/2, y3+btnSize/2-10, 4);
   tft.drawString("SHIP", startX+(btnSize+gap)*2+btnSize/2, y3+btnSize/2+15, 1);
 
+  // Tap targets: whole 80×80 cells, row-major (cell = row * 3 + col)
+  for (int cell = 0; cell < 9; cell++) {
+    hitAdd(startX + (cell % 3) * (btnSize + gap), startY + (cell / 3) * (btnSize + gap),
+           btnSize, btnSize, ACT_CEO_CORE_CELL, cell);
+  }
+
   drawBottomNav();  // Bottom navigation bar
 }
 
@@ -2439,6 +2429,12 @@ void drawExecGrid() {
   tft.drawString("^", startX+(btnSize+gap)*3+btnSize/2, y4+btnSize/2-8, 3);
   tft.drawString("SHIP", startX+(btnSize+gap)*3+btnSize/2, y4+btnSize/2+12, 1);
 
+  // Tap targets: button plus trailing gap, row-major (cell = row * 4 + col)
+  for (int cell = 0; cell < 16; cell++) {
+    hitAdd(startX + (cell % 4) * (btnSize + gap), startY + (cell / 4) * (btnSize + gap),
+           btnSize + gap, btnSize + gap, ACT_EXEC_GRID_CELL, cell);
+  }
+
   drawBottomNav();  // Bottom navigation bar
 }
 
@@ -2472,8 +2468,8 @@ void drawMeta() {
   brFont.drawTechnicalLabel("MEMORY", 14, y + 5, COLOR_HOT_PINK);
 
   // Heap usage
-  String heapUsage = getHeapUsageString();
-  brFont.drawMonoText(heapUsage.c_str(), 200, y + 5, 1, COLOR_WHITE);
+  char heapUsage[16];
+  brFont.drawMonoText(formatHeapUsage(heapUsage, sizeof(heapUsage)), 200, y + 5, 1, COLOR_WHITE);
 
   // Heap bar graph (full width)
   y += 18;
@@ -2543,24 +2539,22 @@ void drawMeta() {
   brFont.drawTechnicalLabel("WIFI", 14, y + 5, COLOR_SUNRISE);
 
   // WiFi quality
-  String wifiQuality = getWiFiQualityString();
   uint16_t wifiColor = getWiFiQualityColor();
-  brFont.drawMonoText(wifiQuality.c_str(), 200, y + 5, 1, wifiColor);
+  brFont.drawMonoText(getWiFiQualityString(), 200, y + 5, 1, wifiColor);
 
   // WiFi stats
   y += 18;
   tft.setTextDatum(TL_DATUM);
   tft.setTextColor(COLOR_WHITE);
-  char wifiStats[40];
-  sprintf(wifiStats, "RSSI:%ddBm Quality:%d%% SSID:%s",
-          perfMetrics.rssi,
-          perfMetrics.wifiQuality,
-          WIFI_SSID);
-  String wifiStr = String(wifiStats);
-  if (wifiStr.length() > 38) {
-    wifiStr = wifiStr.substring(0, 38) + "...";
+  char wifiStats[48];
+  snprintf(wifiStats, sizeof(wifiStats), "RSSI:%ddBm Quality:%d%% SSID:%s",
+           perfMetrics.rssi,
+           perfMetrics.wifiQuality,
+           WIFI_SSID);
+  if (strlen(wifiStats) > 38) {
+    strcpy(wifiStats + 38, "...");
   }
-  tft.drawString(wifiStr.c_str(), 14, y, 1);
+  tft.drawString(wifiStats, 14, y, 1);
 
   y += 20;
 
@@ -2574,15 +2568,14 @@ void drawMeta() {
   tft.setTextColor(COLOR_WARM);
   tft.drawString("UPTIME:", 14, y + 5, 1);
   tft.setTextColor(COLOR_WHITE);
-  String uptime = getUptimeString();
-  tft.drawString(uptime.c_str(), 60, y + 5, 1);
+  char uptime[16];
+  tft.drawString(formatUptime(uptime, sizeof(uptime)), 60, y + 5, 1);
 
   // Boot reason
   tft.setTextColor(COLOR_WARM);
   tft.drawString("BOOT:", 14, y + 15, 1);
   tft.setTextColor(COLOR_WHITE);
-  String bootReason = getRebootReasonString();
-  tft.drawString(bootReason.c_str(), 50, y + 15, 1);
+  tft.drawString(getRebootReasonString(), 50, y + 15, 1);
 
   y += 30;
 
@@ -2663,6 +2656,7 @@ void drawBlackRoadChat() {
     tft.drawString(roles[i], x+144, y+4, 1);
     tft.setTextColor(COLOR_SUNRISE);
     tft.drawString("ONLINE", x+144, y+13, 1);
+    hitAdd(x, y, 149, 23, ACT_CHAT_SELECT_AI, i);
   }
 
   // RECURSIVE CONVERSATIONS - Each AI references OTHER apps!
@@ -2807,131 +2801,16 @@ void drawBlackRoadChat() {
 // ═══════════════════════════════════════════════════════════════════
 
 void drawEmergencyPager() {
-  tft.fillScreen(COLOR_BLACK);
-  drawStatusBar();
-
-  // Back button
-  tft.fillRoundRect(10, 25, 50, 20, 5, COLOR_DARK_GRAY);
-  tft.setTextColor(COLOR_WHITE);
-  tft.setTextDatum(TL_DATUM);
-  tft.drawString("< Back", 15, 28, 2);
-
-  // Alert heading with pulsing effect
-  tft.setTextColor(COLOR_HOT_PINK);
-  tft.setTextDatum(TC_DATUM);
-  tft.drawString("EMERGENCY ALERT", 160, 50, 4);
-
-  if (!hasActiveAlert) {
-    // No active alerts
-    tft.setTextColor(COLOR_WHITE);
-    tft.setTextDatum(MC_DATUM);
-    tft.drawString("No active alerts", 160, 120, 2);
-    tft.drawString("All clear", 160, 145, 2);
-    return;
-  }
-
-  // Alert info box
-  tft.drawRoundRect(15, 80, 290, 90, 8, COLOR_HOT_PINK);
-
-  tft.setTextColor(COLOR_WHITE);
-  tft.setTextDatum(TL_DATUM);
-
-  // Source and priority
-  String sourceStr = "SOURCE:   " + String(currentAlert.source);
-  String priorityStr = "PRIORITY: " + String(currentAlert.priority);
-
-  tft.drawString(sourceStr, 25, 90, 2);
-  tft.drawString(priorityStr, 25, 110, 2);
-
-  // Pattern name
-  String patternStr = "PATTERN:  ";
-  switch(currentAlert.patternId) {
-    case PATTERN_FAST_STROBE: patternStr += "Fast Strobe"; break;
-    case PATTERN_MEDIUM_BLINK: patternStr += "Medium Blink"; break;
-    case PATTERN_SLOW_BLINK: patternStr += "Slow Blink"; break;
-    case PATTERN_MORSE_SOS: patternStr += "SOS"; break;
-    default: patternStr += "Standard";
-  }
-  tft.drawString(patternStr, 25, 130, 2);
-
-  // Timestamp
-  unsigned long seconds = currentAlert.timestamp / 1000;
-  String timeStr = "TIME:     " + String(seconds) + "s ago";
-  tft.drawString(timeStr, 25, 150, 2);
+  renderLayout(tft, PAGER_LAYOUT);
 
-  // Message (if set)
-  if(strlen(currentAlert.message) > 0) {
-    tft.setTextColor(COLOR_SUNRISE);
-    tft.setTextDatum(TC_DATUM);
-    tft.drawString(currentAlert.message, 160, 180, 1);
+  // Beacon next to the heading while an alert is live
+  if (hasActiveAlert) {
+    animStartPulse(SCREEN_EMERGENCY_PAGER, 290, 62, 6, COLOR_HOT_PINK, COLOR_BLACK);
   }
-
-  // ACK button
-  tft.fillRoundRect(30, 200, 120, 35, 8, COLOR_CYBER_BLUE);
-  tft.setTextColor(COLOR_WHITE);
-  tft.setTextDatum(MC_DATUM);
-  tft.drawString("ACK", 90, 217, 2);
-
-  // DISMISS button
-  tft.fillRoundRect(170, 200, 120, 35, 8, COLOR_DARK_GRAY);
-  tft.drawString("DISMISS", 230, 217, 2);
 }
 
 void drawAlertHistory() {
-  tft.fillScreen(COLOR_BLACK);
-  drawStatusBar();
-
-  // Back button
-  tft.fillRoundRect(10, 25, 50, 20, 5, COLOR_DARK_GRAY);
-  tft.setTextColor(COLOR_WHITE);
-  tft.setTextDatum(TL_DATUM);
-  tft.drawString("< Back", 15, 28, 2);
-
-  // Title
-  tft.setTextColor(COLOR_HOT_PINK);
-  tft.setTextDatum(TC_DATUM);
-  tft.drawString("ALERT HISTORY", 160, 50, 4);
-
-  if(alertHistoryCount == 0) {
-    tft.setTextColor(COLOR_WHITE);
-    tft.setTextDatum(MC_DATUM);
-    tft.drawString("No alerts in history", 160, 120, 2);
-    return;
-  }
-
-  // Display last 5 alerts
-  tft.setTextDatum(TL_DATUM);
-  int y = 80;
-  int displayCount = alertHistoryCount > 5 ? 5 : alertHistoryCount;
-
-  for(int i = alertHistoryCount - 1; i >= alertHistoryCount - displayCount; i--) {
-    Alert &alert = alertHistory[i];
-
-    // Time
-    unsigned long seconds = alert.timestamp / 1000;
-    String timeStr = String(seconds) + "s";
-    tft.setTextColor(COLOR_DARK_GRAY);
-    tft.drawString(timeStr, 15, y, 1);
-
-    // Source + Priority
-    String infoStr = String(alert.source) + " " + String(alert.priority);
-    tft.setTextColor(COLOR_WHITE);
-    tft.drawString(infoStr, 70, y, 2);
-
-    // ACK status
-    if(alert.acknowledged) {
-      tft.setTextColor(COLOR_CYBER_BLUE);
-      tft.drawString("ACK", 270, y, 2);
-    }
-
-    y += 25;
-  }
-
-  // Stats
-  tft.setTextColor(COLOR_SUNRISE);
-  tft.setTextDatum(TC_DATUM);
-  String statsStr = "Total alerts: " + String(alertHistoryCount);
-  tft.drawString(statsStr, 160, 215, 1);
+  renderLayout(tft, ALERT_HISTORY_LAYOUT);
 }
 
 // ═══════════════════════════════════════════════════════════════════
@@ -3209,7 +3088,7 @@ void drawSovereignStack() {
 
   // Get metrics
   SovereigntyMetrics metrics = getSovereigntyMetrics();
-  String status = getSovereigntyStatus();
+  const char* status = getSovereigntyStatus();
   uint16_t statusColor = getSovereigntyColor();
 
   // Title
@@ -3221,7 +3100,7 @@ void drawSovereignStack() {
   tft.fillRoundRect(60, 48, 200, 20, 10, statusColor);
   tft.setTextColor(COLOR_BLACK);
   tft.setTextDatum(TC_DATUM);
-  brFont.drawMonoText(status.c_str(), 160, 52, BR_MONO_SMALL, COLOR_BLACK);
+  brFont.drawMonoText(status, 160, 52, BR_MONO_SMALL, COLOR_BLACK);
 
   // Metrics cards
   int cardY = 75;
@@ -3257,37 +3136,26 @@ void drawSovereignStack() {
   int y = 148;
   int shown = 0;
 
-  for (int i = 0; i < stackComponentCount && shown < 6; i++) {
-    StackComponent comp = sovereignStack[i];
-
-    // Skip non-sovereign for space
-    if (!comp.sovereign) continue;
+  // Sovereign components only, for space
+  for (uint32_t bits = stackState.sovereignMask; bits && shown < 6; bits &= bits - 1) {
+    int i = __builtin_ctz(bits);
+    const StackComponent& comp = STACK_COMPONENTS[i];
 
     // Status dot
-    uint16_t dotColor = COLOR_DARK_GRAY;
-    if (comp.status == "active") dotColor = COLOR_VIVID_PUR;
-    else if (comp.status == "degraded") dotColor = COLOR_SUNRISE;
-    else if (comp.status == "offline") dotColor = COLOR_HOT_PINK;
-
-    tft.fillCircle(18, y + 4, 3, dotColor);
+    tft.fillCircle(18, y + 4, 3, COMPONENT_STATUS_COLORS[stackState.status[i]]);
 
     // Component name
     tft.setTextColor(COLOR_WHITE);
-    String name = comp.name;
-    if (name.length() > 12) name = name.substring(0, 12);
-    brFont.drawMonoText(name.c_str(), 30, y, 1, COLOR_WHITE);
+    char text[16];
+    brFont.drawMonoText(StrView(comp.name).substring(0, 12).copyTo(text, sizeof(text)), 30, y, 1, COLOR_WHITE);
 
     // Category
     tft.setTextColor(COLOR_CYBER_BLUE);
-    String cat = comp.category;
-    if (cat.length() > 8) cat = cat.substring(0, 8);
-    brFont.drawMonoText(cat.c_str(), 130, y, 1, COLOR_WHITE);
+    brFont.drawMonoText(StrView(STACK_CATEGORY_NAMES[comp.category]).substring(0, 8).copyTo(text, sizeof(text)), 130, y, 1, COLOR_WHITE);
 
     // License
-    tft.setTextColor(isForkableLicense(comp.license) ? COLOR_VIVID_PUR : COLOR_SUNRISE);
-    String lic = comp.license;
-    if (lic.length() > 10) lic = lic.substring(0, 10);
-    brFont.drawMonoText(lic.c_str(), 200, y, 1, COLOR_WHITE);
+    tft.setTextColor((stackState.forkableMask >> i) & 1 ? COLOR_VIVID_PUR : COLOR_SUNRISE);
+    brFont.drawMonoText(StrView(comp.license).substring(0, 10).copyTo(text, sizeof(text)), 200, y, 1, COLOR_WHITE);
 
     y += 14;
     shown++;
@@ -3361,7 +3229,6 @@ void drawInfrastructureDashboard() {
 
   // Sovereignty Status
   SovereigntyMetrics sovMetrics = getSovereigntyMetrics();
-  String sovStatus = getSovereigntyStatus();
   uint16_t sovColor = getSovereigntyColor();
   drawCard(165, y, 145, 32, sovColor);
   brFont.drawMonoText("SOVEREIGN", 177, y + 6, 1, COLOR_WHITE);
@@ -3377,27 +3244,23 @@ void drawInfrastructureDashboard() {
   y += 16;
 
   for (int i = 0; i < meshNodeCount && i < 3; i++) {
-    uint16_t nodeColor = COLOR_WHITE;
-    if (meshNodes[i].status == "active") nodeColor = COLOR_VIVID_PUR;
-    else if (meshNodes[i].status == "idle") nodeColor = COLOR_SUNRISE;
-
+    uint16_t nodeColor = NODE_STATUS_COLORS[meshNodes[i].status];
     tft.fillCircle(18, y + 6, 4, meshNodes[i].online ? nodeColor : COLOR_HOT_PINK);
 
-    String nodeName = meshNodes[i].name;
+    FixedString<11> nodeName = MESH_NODES[meshNodes[i].node].name;   // first 10 chars
     nodeName.toUpperCase();
-    if (nodeName.length() > 10) nodeName = nodeName.substring(0, 10);
 
     tft.setTextColor(COLOR_WHITE);
     brFont.drawMonoText(nodeName.c_str(), 30, y + 2, 1, COLOR_WHITE);
 
     tft.setTextColor(COLOR_CYBER_BLUE);
-    String ipStr = meshNodes[i].ip;
+    char text[16], ip[16];
+    StrView ipStr = formatIPv4(meshNodes[i].ip, ip, sizeof(ip));
     if (ipStr.length() > 14) ipStr = ipStr.substring(ipStr.length() - 14);
-    brFont.drawMonoText(ipStr.c_str(), 110, y + 2, 1, COLOR_CYBER_BLUE);
+    brFont.drawMonoText(ipStr.copyTo(text, sizeof(text)), 110, y + 2, 1, COLOR_CYBER_BLUE);
 
     tft.setTextColor(COLOR_SUNRISE);
-    String latencyStr = String(meshNodes[i].latency) + "ms";
-    brFont.drawMonoText(latencyStr.c_str(), 240, y + 2, 1, COLOR_SUNRISE);
+    brFont.drawMonoText(strfmt(text, sizeof(text), "%dms", meshNodes[i].latency), 240, y + 2, 1, COLOR_SUNRISE);
 
     y += 14;
   }
@@ -3491,7 +3354,7 @@ void drawHotLeads() {
 
     // Stage badge
     tft.setTextColor(COLOR_SUNRISE);
-    brFont.drawMonoText(lead.stage, 14, y + 27, 1, COLOR_SUNRISE);
+    brFont.drawMonoText(LEAD_STAGE_NAMES[lead.stage], 14, y + 27, 1, COLOR_SUNRISE);
 
     // Activity metrics (opens/clicks)
     tft.setTextColor(COLOR_WHITE);
@@ -3519,7 +3382,7 @@ void drawHotLeads() {
   tft.setTextDatum(TC_DATUM);
   char summaryStr[60];
   sprintf(summaryStr, "%d total hot leads • $%dK pipeline",
-          crmMetrics.hotLeads, crmMetrics.pipelineValue / 1000);
+          crmMetrics.hotLeads, (int)(crmMetrics.pipelineValue / 1000));
   brFont.drawMonoText(summaryStr, 160, y + 2, 1, COLOR_WHITE);
 
   // Refresh button (bottom right)
@@ -3528,10 +3391,37 @@ void drawHotLeads() {
   tft.setTextDatum(TC_DATUM);
   brFont.drawMonoText("SYNC", 281, 288, 1, COLOR_WHITE);
   brFont.drawMonoText("CRM", 281, 297, 1, COLOR_WHITE);
+  hitAdd(250, 278, 63, 33, ACT_HOT_LEADS_SYNC);
 
   drawBottomNav();
 }
 
+// SYNC CRM result arrived from the net task (or the request never queued)
+bool hotLeadsSyncPending = false;
+
+void drawCurrentScreen();
+
+void finishHotLeadsSync(bool success) {
+  hotLeadsSyncPending = false;
+  if (currentScreen != SCREEN_HOT_LEADS) return;
+
+  // Visual feedback
+  if (success) {
+    // Green flash for success
+    tft.fillRoundRect(250, 278, 62, 32, 4, COLOR_VIVID_PUR);
+    playSuccess();
+  } else {
+    // Orange flash for fallback to static data
+    tft.fillRoundRect(250, 278, 62, 32, 4, COLOR_HOT_PINK);
+    playBeep();
+  }
+
+  delay(200);
+
+  // Redraw entire screen with updated data
+  drawCurrentScreen();
+}
+
 // CEO COMMAND CENTER - Ultimate aggregated dashboard
 void drawCEOCommandCenter() {
   tft.fillScreen(COLOR_BLACK);
@@ -3558,7 +3448,7 @@ void drawCEOCommandCenter() {
   tft.setTextColor(COLOR_HOT_PINK);
   tft.setTextDatum(TC_DATUM);
   char pipelineStr[20];
-  sprintf(pipelineStr, "$%dK", crmMetrics.pipelineValue / 1000);
+  sprintf(pipelineStr, "$%dK", (int)(crmMetrics.pipelineValue / 1000));
   tft.drawString(pipelineStr, 80, y, 4);  // Large font
 
   // Hot Leads Count (HUGE)
@@ -3641,7 +3531,7 @@ void drawCEOCommandCenter() {
     // Activity + Stage
     tft.setTextColor(COLOR_WARM);
     char topMetricsStr[30];
-    sprintf(topMetricsStr, "%d/%d • %s", topLead.opens, topLead.clicks, topLead.stage);
+    sprintf(topMetricsStr, "%d/%d • %s", topLead.opens, topLead.clicks, LEAD_STAGE_NAMES[topLead.stage]);
     brFont.drawMonoText(topMetricsStr, 12, y + 27, 1, COLOR_WARM);
 
     y += 42;
@@ -3709,7 +3599,8 @@ void drawCEOCommandCenter() {
   tft.setTextDatum(TC_DATUM);
   char statusStr[60];
   int healthyCount = (navState.meshHealthy ? 1 : 0) + (navState.crmHealthy ? 1 : 0) + (navState.aiHealthy ? 1 : 0);
-  sprintf(statusStr, "%d/3 live • Uptime: %s", healthyCount, getUptimeString().c_str());
+  char uptime[16];
+  sprintf(statusStr, "%d/3 live • Uptime: %s", healthyCount, formatUptime(uptime, sizeof(uptime)));
   brFont.drawMonoText(statusStr, 160, y, 1, COLOR_WHITE);
 
   drawBottomNav();
@@ -3717,7 +3608,19 @@ void drawCEOCommandCenter() {
 
 // ═══════════════════════════════════════════════════════════════════
 
+// What a bus event has to beat to be worth a repaint (see busEventStale)
+uint32_t uiLastFullDrawUs = 0;
+uint32_t uiFullDraws = 0;
+
 void drawCurrentScreen() {
+  HeapTag heapTag(HEAP_TAG_RENDER);
+  uiLastFullDrawUs = micros();
+  uiFullDraws++;
+  powerBoost();   // full repaints run at the active clock
+  animStopAll();  // full repaint - screens restart their own animations
+  renderProfBeginScreen(currentScreen);
+  hitBegin(currentScreen);  // draw code below registers its tap targets
+
   switch (currentScreen) {
     case SCREEN_LOCK:
       drawLockScreen();
@@ -3810,546 +3713,523 @@ void drawCurrentScreen() {
       drawHomeScreen();
   }
 
+  // Universal back target over the status bar (wider than any drawn pill);
+  // pager screens use their own pill and hot leads never had one
+  switch (currentScreen) {
+    case SCREEN_LOCK:
+    case SCREEN_HOME:
+    case SCREEN_HOT_LEADS:
+    case SCREEN_KEYBOARD:
+    case SCREEN_EMERGENCY_PAGER:
+    case SCREEN_ALERT_HISTORY:
+      break;
+    default:
+      hitAdd(5, 0, 76, 46, ACT_BACK_HOME);
+  }
+
   // Draw nav bar on all screens except lock and home (home draws its own)
   if (currentScreen != SCREEN_LOCK && currentScreen != SCREEN_HOME) {
     drawNavBar();
   }
+
+  hitCommit();
+  renderProfEndScreen();
+}
+
+// ─────────────────────────────────────────────────────────────────────
+// EVENT BUS SUBSCRIBERS - invalidate only what shows the changed data
+// ─────────────────────────────────────────────────────────────────────
+
+bool uiDirtyScreen = false;
+uint64_t uiDirtyBadges = 0;   // bit per app index
+uint32_t uiDrawsAtSync = 0;   // uiFullDraws when netSync() last brought in data
+
+// Screens that draw from a bus data topic (navState, meshNodes, crmMetrics, hotLeads)
+bool screenShowsTopic(Screen screen, uint8_t topic) {
+  switch (screen) {
+    case SCREEN_MESH_VPN:
+      return topic == BUS_NAV || topic == BUS_MESH;
+    case SCREEN_CRM:
+    case SCREEN_HOT_LEADS:
+      return topic == BUS_NAV || topic == BUS_CRM || topic == BUS_LEADS;
+    case SCREEN_INFRASTRUCTURE:
+      return topic == BUS_NAV || topic == BUS_MESH || topic == BUS_CRM || topic == BUS_LEADS;
+    case SCREEN_CEO_COMMAND:
+      return topic == BUS_NAV || topic == BUS_CRM || topic == BUS_LEADS;
+    case SCREEN_SOVEREIGN_STACK:
+      return topic == BUS_NAV;   // updateStackHealth() derives it from navState
+    default:
+      return false;
+  }
 }
 
-// Handle touch events with swipe detection
-void handleTouch() {
-  int x, y;
-  bool isTouching = getTouchCoordinates(x, y);
-
-  // Swipe detection state machine
-  if (isTouching && !touchActive) {
-    // Touch started
-    touchActive = true;
-    touchStartX = x;
-    touchStartY = y;
-    touchStartTime = millis();
-    return;  // Wait for release
+// Already on screen: net data reaches the globals at netSync(), so it is
+// covered by any full repaint since; UI events by one after publishing
+bool busEventStale(const BusEvent& e) {
+  bool covered = e.producer == BUS_FROM_NET ? uiFullDraws != uiDrawsAtSync
+                                            : (int32_t)(e.us - uiLastFullDrawUs) <= 0;
+  if (covered) busInvalidateStats.stale++;
+  return covered;
+}
+
+// Newest nav snapshot from the net task (5-minute refresh, SYNC CRM)
+void uiSyncNav() {
+  if (!netSync()) return;
+  uiDrawsAtSync = uiFullDraws;
+
+  // Check alert conditions after navigation update
+  #if ENABLE_ALERTS
+    checkAllAlerts();
+  #endif
+
+  if (hotLeadsSyncPending) finishHotLeadsSync(navState.crmHealthy);
+}
+
+void uiOnSnapshot(const BusEvent&) {
+  uiSyncNav();
+}
+
+void uiOnData(const BusEvent& e) {
+  if (busEventStale(e)) return;
+  if (screenShowsTopic(currentScreen, e.topic)) uiDirtyScreen = true;
+  else busInvalidateStats.ignored++;
+}
+
+// The screen change always applies - a repaint of some other screen in
+// this pass (a tap, say) did not show the alert. Staleness only saves
+// the repaint when the pager is already up and was drawn since
+void uiOnAlertRaised(const BusEvent& e) {
+  if (currentScreen != SCREEN_EMERGENCY_PAGER) {
+    currentScreen = SCREEN_EMERGENCY_PAGER;
+    uiDirtyScreen = true;
+  } else if (!busEventStale(e)) {
+    uiDirtyScreen = true;
   }
+}
 
-  if (!isTouching && touchActive) {
-    // Touch ended - check for swipe
-    touchActive = false;
-    touchEndX = x;
-    touchEndY = y;
+void uiOnAlertCleared(const BusEvent&) {
+  if (currentScreen != SCREEN_EMERGENCY_PAGER) return;
+  currentScreen = SCREEN_HOME;
+  uiDirtyScreen = true;
+}
+
+void uiOnBadge(const BusEvent& e) {
+  if (busEventStale(e)) return;
+  if (currentScreen == SCREEN_HOME && e.arg / APPS_PER_PAGE == currentPage) uiDirtyBadges |= 1ULL << e.arg;
+  else busInvalidateStats.ignored++;
+}
+
+// Overflowed ring: nothing is known about what changed
+void uiOnLost(const BusEvent&) {
+  uiSyncNav();
+  uiDirtyScreen = true;
+}
+
+void initBusSubscribers() {
+  busSubscribe(BUS_LOST, uiOnLost);
+  busSubscribe(BUS_SNAPSHOT, uiOnSnapshot);
+  busSubscribe(BUS_NAV, uiOnData);
+  busSubscribe(BUS_MESH, uiOnData);
+  busSubscribe(BUS_CRM, uiOnData);
+  busSubscribe(BUS_LEADS, uiOnData);
+  busSubscribe(BUS_ALERT_RAISED, uiOnAlertRaised);
+  busSubscribe(BUS_ALERT_CLEARED, uiOnAlertCleared);
+  busSubscribe(BUS_BADGE, uiOnBadge);
+}
 
-    int deltaX = touchStartX - touchEndX;  // Positive = swipe left
-    int deltaY = touchStartY - touchEndY;  // Positive = swipe up
-    unsigned long touchDuration = millis() - touchStartTime;
+// Deliver pending events, then repaint what they touched once
+void uiApplyEvents() {
+  busDispatch();
+
+  if (uiDirtyScreen) {
+    drawCurrentScreen();
+    busInvalidateStats.screens++;
+  } else if (uiDirtyBadges && currentScreen == SCREEN_HOME) {
+    for (int i = 0; i < APP_COUNT; i++) {
+      if (!(uiDirtyBadges & (1ULL << i))) continue;
+      // icon + shadow + badge, the same margin the home cache renders with
+      AnimRect r = {(int16_t)(apps[i].x - 4), (int16_t)(apps[i].y - 4),
+                    (int16_t)(apps[i].size + 8), (int16_t)(apps[i].size + 8)};
+      restoreHomeRegion(r);
+      busInvalidateStats.widgets++;
+    }
+  }
+  uiDirtyScreen = false;
+  uiDirtyBadges = 0;
+}
 
-    // Swipe detection (only on home screen) - faster response
-    if (currentScreen == SCREEN_HOME && touchDuration < 800) {
-      if (abs(deltaX) > SWIPE_THRESHOLD && abs(deltaX) > abs(deltaY)) {
-        if (deltaX > 0 && currentPage < TOTAL_PAGES - 1) {
+// Act on one recognized gesture (taps go through the hit-test index)
+void handleGesture(const Gesture& g) {
+  unsigned long durationMs = (g.us - g.startUs) / 1000;
+
+  switch (g.type) {
+    case GESTURE_DRAG_END:
+    case GESTURE_FLING:
+      // Page swipe on home - a fling always counts, a slow drag only if quick
+      if (currentScreen == SCREEN_HOME && (g.type == GESTURE_FLING || durationMs < 800) &&
+          abs(g.dx) > SWIPE_THRESHOLD && abs(g.dx) > abs(g.dy)) {
+        if (g.dx < 0 && currentPage < TOTAL_PAGES - 1) {
           // Swipe left - next page
-          currentPage++;
           playBeep();
-          drawHomeScreen();
+          showHomePage(currentPage + 1, g.us);
           Serial.printf("Swipe left - Page %d\n", currentPage + 1);
-          return;
-        } else if (deltaX < 0 && currentPage > 0) {
+        } else if (g.dx > 0 && currentPage > 0) {
           // Swipe right - previous page
-          currentPage--;
           playBeep();
-          drawHomeScreen();
+          showHomePage(currentPage - 1, g.us);
           Serial.printf("Swipe right - Page %d\n", currentPage + 1);
-          return;
         }
+        return;
       }
-    }
 
-    // Lock screen - swipe up or tap to unlock
-    if (currentScreen == SCREEN_LOCK) {
-      if (deltaY > SWIPE_THRESHOLD || touchDuration < 500) {
+      // Lock screen - swipe up or a quick stroke unlocks
+      if (currentScreen == SCREEN_LOCK && (g.dy < -SWIPE_THRESHOLD || durationMs < 500)) {
         Serial.println("Unlocking...");
         currentScreen = SCREEN_HOME;
         drawCurrentScreen();
-        return;
-      }
-    }
-
-    // TAP DETECTION - process taps when touch ends (not swipe)
-    if (touchDuration < 500 && abs(deltaX) < SWIPE_THRESHOLD && abs(deltaY) < SWIPE_THRESHOLD) {
-      // This was a tap, not a swipe - use START position
-      x = touchStartX;
-      y = touchStartY;
-
-      // Debounce
-      if (millis() - lastTouchTime < 80) return;
-      lastTouchTime = millis();
-
-      Serial.printf("Tap at x:%d, y:%d on screen:%d\n", x, y, currentScreen);
-
-  // PERSISTENT NAV BAR - Works on ALL screens except LOCK
-  if (currentScreen != SCREEN_LOCK) {
-    int navAction = checkNavBarTouch(x, y);
-    if (navAction > 0) {
-      playBeep();
-      switch (navAction) {
-        case 1:  // Left arrow - go back/previous page
-          if (currentScreen == SCREEN_HOME && currentPage > 0) {
-            currentPage--;
-            drawHomeScreen();
-          } else if (currentScreen != SCREEN_HOME) {
-            currentScreen = SCREEN_HOME;
-            drawCurrentScreen();
-          }
-          break;
-        case 2:  // Home button
-          currentPage = 0;
-          currentScreen = SCREEN_HOME;
-          drawCurrentScreen();
-          break;
-        case 3:  // Right arrow - next page
-          if (currentScreen == SCREEN_HOME && currentPage < TOTAL_PAGES - 1) {
-            currentPage++;
-            drawHomeScreen();
-          }
-          break;
-        case 4:  // Keyboard
-          currentScreen = SCREEN_KEYBOARD;
-          drawCurrentScreen();
-          break;
       }
       return;
-    }
-  }
-
-  switch (currentScreen) {
-    case SCREEN_LOCK:
-      // Handled by swipe detection above
-      break;
 
-    case SCREEN_HOME:
-      // Check app icons for current page only
-      {
-        int startIdx = currentPage * APPS_PER_PAGE;
-        int endIdx = startIdx + APPS_PER_PAGE;
-        for (int i = startIdx; i < endIdx && i < APP_COUNT; i++) {
-          if (x >= apps[i].x && x <= apps[i].x + apps[i].size &&
-              y >= apps[i].y && y <= apps[i].y + apps[i].size) {
-            // Quick visual feedback
-            drawAppIcon(apps[i], true);
-            delay(50);  // Faster response
-
-            currentScreen = apps[i].screen;
-            drawCurrentScreen();
-            break;
-          }
+    case GESTURE_EDGE_BACK:
+      // Swipe in from the left edge = back, decided mid-stroke
+      if (currentScreen == SCREEN_HOME) {
+        if (currentPage > 0) {
+          playBeep();
+          showHomePage(currentPage - 1, g.us);
+          Serial.printf("Edge swipe - Page %d\n", currentPage + 1);
         }
-      }
-      break;
-
-    case SCREEN_CEO_CORE:
-      // Check back button FIRST (larger hitbox for better touch response)
-      if (x >= 5 && x <= 80 && y >= 0 && y <= 45) {
-        Serial.println("Back button tapped - returning to home");
+      } else if (currentScreen == SCREEN_KEYBOARD) {
+        Serial.println("Edge swipe - closing keyboard");
+        playBeep();
+        currentScreen = screenBeforeKeyboard;
+        drawCurrentScreen();
+      } else if (currentScreen != SCREEN_LOCK) {
+        Serial.println("Edge swipe - back to home");
         playBeep();
         currentScreen = SCREEN_HOME;
         drawCurrentScreen();
-        break;
       }
+      return;
 
-      // 3×3 CEO CORE Grid (80×80 buttons, no gaps)
-      {
-        int startX = 40;
-        int startY = 50;
-        int btnSize = 80;
-
-        // Determine which button was tapped
-        int col = (x - startX) / btnSize;
-        int row = (y - startY) / btnSize;
-
-        if (col >= 0 && col < 3 && row >= 0 && row < 3) {
-          lastActionTime = millis();
-
-          // ROW 0 buttons
-          if (row == 0) {
-            if (col == 0) { // REJECT
-              rejectCount++;
-              playCritical();
-              Serial.println("❌ REJECT - Count: " + String(rejectCount));
-            } else if (col == 1) { // HOLD
-              holdCount++;
-              playBeep();
-              Serial.println("💭 HOLD - Count: " + String(holdCount));
-            } else if (col == 2) { // APPROVE
-              approveCount++;
-              playSuccess();
-              Serial.println("✅ APPROVE - Count: " + String(approveCount));
-            }
-          }
-          // ROW 1 buttons
-          else if (row == 1) {
-            if (col == 0) { // BLOCKED
-              blockedCount++;
-              playCritical();
-              Serial.println("🧱 BLOCKED - Count: " + String(blockedCount));
-            } else if (col == 1) { // BRAIN (next decision)
-              playBeep(100);
-              Serial.println("🧠 BRAIN - Loading next decision...");
-            } else if (col == 2) { // NEXT
-              playBeep();
-              Serial.println("🔜 NEXT - Moving to next item");
-            }
-          }
-          // ROW 2 buttons
-          else if (row == 2) {
-            if (col == 0) { // CRITICAL
-              criticalCount++;
-              playCritical();
-              Serial.println("🔥 CRITICAL - Count: " + String(criticalCount));
-            } else if (col == 1) { // ESCALATE
-              escalateCount++;
-              playSuccess();
-              Serial.println("🪜 ESCALATE - Count: " + String(escalateCount));
-            } else if (col == 2) { // SHIP
-              shipCount++;
-              playSuccess();
-              Serial.println("🚀 SHIP - Count: " + String(shipCount));
-            }
-          }
-
-          // Flash the button (visual feedback)
-          delay(100);
-          drawCEOCore();
-        }
-      }
+    case GESTURE_LONG_PRESS:
+      Serial.printf("Long press at x:%d, y:%d on screen:%d\n", g.x, g.y, currentScreen);
+      return;
+
+    case GESTURE_DOUBLE_TAP:
+      // Its second TAP was already dispatched below
+      Serial.printf("Double tap at x:%d, y:%d on screen:%d\n", g.x, g.y, currentScreen);
+      return;
+
+    case GESTURE_TAP:
       break;
 
-    case SCREEN_EXEC_GRID:
-      // Check back button FIRST (larger hitbox for better touch response)
-      if (x >= 5 && x <= 80 && y >= 0 && y <= 45) {
-        Serial.println("Back button tapped - returning to home");
-        playBeep();
+    default:
+      return;  // DRAG_START / DRAG - nothing follows the finger yet
+  }
+
+  // Lock screen - tap to unlock
+  if (currentScreen == SCREEN_LOCK) {
+    Serial.println("Unlocking...");
+    currentScreen = SCREEN_HOME;
+    drawCurrentScreen();
+    return;
+  }
+
+  // TAP - use the position where the finger landed
+  int x = g.x;
+  int y = g.y;
+
+  // Debounce
+  if (millis() - lastTouchTime < 80) return;
+  lastTouchTime = millis();
+
+  Serial.printf("Tap at x:%d, y:%d on screen:%d\n", x, y, currentScreen);
+
+  // Resolve through the hit-test index built when the screen was drawn
+  if (!hitIndexFor(currentScreen)) {
+    // Screen switched without a redraw - show it first
+    hitStats.stale++;
+    drawCurrentScreen();
+    return;
+  }
+  const HitRegion* hit = hitTest(x, y);
+  uint8_t arg = hit ? hit->arg : 0;
+
+  switch (hit ? hit->action : (uint8_t)ACT_NONE) {
+    // PERSISTENT NAV BAR - Works on ALL screens except LOCK
+    case ACT_NAV_LEFT:  // go back/previous page
+      playBeep();
+      if (currentScreen == SCREEN_HOME && currentPage > 0) {
+        showHomePage(currentPage - 1, micros());
+      } else if (currentScreen != SCREEN_HOME) {
         currentScreen = SCREEN_HOME;
         drawCurrentScreen();
-        break;
       }
+      break;
 
-      // 4×4 EXEC Grid (60×60 buttons, 2px gaps)
-      {
-        int startX = 50;
-        int startY = 50;
-        int btnSize = 60;
-        int gap = 2;
+    case ACT_NAV_HOME:
+      playBeep();
+      currentPage = 0;
+      currentScreen = SCREEN_HOME;
+      drawCurrentScreen();
+      break;
 
-        int col = (x - startX) / (btnSize + gap);
-        int row = (y - startY) / (btnSize + gap);
+    case ACT_NAV_RIGHT:  // next page
+      playBeep();
+      if (currentScreen == SCREEN_HOME && currentPage < TOTAL_PAGES - 1) {
+        showHomePage(currentPage + 1, micros());
+      }
+      break;
 
-        if (col >= 0 && col < 4 && row >= 0 && row < 4) {
-          lastActionTime = millis();
-          playBeep();
+    case ACT_NAV_KEYBOARD:
+      playBeep();
+      currentScreen = SCREEN_KEYBOARD;
+      drawCurrentScreen();
+      break;
 
-          // Map grid position to action
-          String actions[4][4] = {
-            {"REJECT", "HOLD", "BRAIN", "APPROVE"},
-            {"BLOCKED", "RISK", "CRITICAL", "NEXT"},
-            {"USER", "TEAM", "ESCALATE", "DIRECTION"},
-            {"VOICE", "DATA", "LOOP", "SHIP"}
-          };
-
-          String action = actions[row][col];
-          Serial.println("EXEC 4×4 - " + action + " activated");
-
-          // Update counts for matching actions
-          if (action == "APPROVE") {approveCount++; playSuccess();}
-          else if (action == "REJECT") {rejectCount++; playCritical();}
-          else if (action == "HOLD") {holdCount++;}
-          else if (action == "SHIP") {shipCount++; playSuccess();}
-          else if (action == "ESCALATE") {escalateCount++;}
-          else if (action == "CRITICAL") {criticalCount++; playCritical();}
-          else if (action == "BLOCKED") {blockedCount++;}
-
-          delay(100);
-          drawExecGrid();
-        }
+    case ACT_BACK_HOME:
+      if (currentScreen == SCREEN_EMERGENCY_PAGER) {
+        Serial.println("Pager: Back to home");
+      } else if (currentScreen == SCREEN_ALERT_HISTORY) {
+        Serial.println("Alert History: Back to home");
+      } else {
+        Serial.println("Back button tapped - returning to home");
       }
+      playBeep();
+      currentScreen = SCREEN_HOME;
+      drawCurrentScreen();
       break;
 
-    case SCREEN_HOT_LEADS:
-      // SYNC CRM button (bottom right: x=250-312, y=278-310)
-      if (x >= 250 && x <= 312 && y >= 278 && y <= 310) {
-        Serial.println("🔄 SYNC CRM button tapped - fetching live hot leads...");
-        playBeep();
+    case ACT_PAGER_ACK:
+      Serial.println("Pager: ACK pressed");
+      playBeep();
+      acknowledgeAlert();
+      currentScreen = SCREEN_HOME;
+      drawCurrentScreen();
+      break;
 
-        // Show loading indicator
-        tft.fillRoundRect(250, 278, 62, 32, 4, COLOR_SUNRISE);
-        tft.setTextColor(COLOR_BLACK);
-        tft.setTextDatum(TC_DATUM);
-        brFont.drawMonoText("...", 281, 288, 1, COLOR_BLACK);
+    case ACT_PAGER_DISMISS:
+      Serial.println("Pager: DISMISS pressed");
+      playBeep();
+      clearAlert();
+      currentScreen = SCREEN_HOME;
+      drawCurrentScreen();
+      break;
+
+    case ACT_OPEN_APP:
+      // Quick visual feedback
+      drawAppIcon(apps[arg], true);
+      delay(50);  // Faster response
 
-        // Fetch live CRM data
-        bool success = fetchHotLeads();
+      currentScreen = apps[arg].screen;
+      drawCurrentScreen();
+      break;
 
-        // Visual feedback
-        if (success) {
-          // Green flash for success
-          tft.fillRoundRect(250, 278, 62, 32, 4, COLOR_VIVID_PUR);
+    case ACT_CEO_CORE_CELL:
+      // 3×3 CEO CORE Grid, arg = row * 3 + col
+      lastActionTime = millis();
+      switch (arg) {
+        case 0:  // REJECT
+          rejectCount++;
+          playCritical();
+          Serial.println("❌ REJECT - Count: " + String(rejectCount));
+          break;
+        case 1:  // HOLD
+          holdCount++;
+          playBeep();
+          Serial.println("💭 HOLD - Count: " + String(holdCount));
+          break;
+        case 2:  // APPROVE
+          approveCount++;
           playSuccess();
-        } else {
-          // Orange flash for fallback to static data
-          tft.fillRoundRect(250, 278, 62, 32, 4, COLOR_HOT_PINK);
+          Serial.println("✅ APPROVE - Count: " + String(approveCount));
+          break;
+        case 3:  // BLOCKED
+          blockedCount++;
+          playCritical();
+          Serial.println("🧱 BLOCKED - Count: " + String(blockedCount));
+          break;
+        case 4:  // BRAIN (next decision)
+          playBeep(100);
+          Serial.println("🧠 BRAIN - Loading next decision...");
+          break;
+        case 5:  // NEXT
           playBeep();
-        }
-
-        delay(200);
-
-        // Redraw entire screen with updated data
-        drawHotLeads();
-        break;
+          Serial.println("🔜 NEXT - Moving to next item");
+          break;
+        case 6:  // CRITICAL
+          criticalCount++;
+          playCritical();
+          Serial.println("🔥 CRITICAL - Count: " + String(criticalCount));
+          break;
+        case 7:  // ESCALATE
+          escalateCount++;
+          playSuccess();
+          Serial.println("🪜 ESCALATE - Count: " + String(escalateCount));
+          break;
+        case 8:  // SHIP
+          shipCount++;
+          playSuccess();
+          Serial.println("🚀 SHIP - Count: " + String(shipCount));
+          break;
       }
+
+      // Flash the button (visual feedback)
+      delay(100);
+      drawCEOCore();
       break;
 
-    case SCREEN_BLACKROAD_CHAT:
-      // Check back button FIRST (larger hitbox for better touch response)
-      if (x >= 5 && x <= 80 && y >= 0 && y <= 45) {
-        Serial.println("Back button tapped - returning to home");
+    case ACT_EXEC_GRID_CELL:
+      // 4×4 EXEC Grid, arg = row * 4 + col
+      {
+        static const char* const actions[16] = {
+          "REJECT", "HOLD", "BRAIN", "APPROVE",
+          "BLOCKED", "RISK", "CRITICAL", "NEXT",
+          "USER", "TEAM", "ESCALATE", "DIRECTION",
+          "VOICE", "DATA", "LOOP", "SHIP"
+        };
+        lastActionTime = millis();
         playBeep();
-        currentScreen = SCREEN_HOME;
-        drawCurrentScreen();
-        break;
-      }
 
-      // RECURSIVE AI MODEL SELECTION - Tap any model to switch! (BETTER THAN iPHONE!)
-      // 6 AI models in 2×3 grid (148×22px each)
-      // Row 1 (y=56-78): LUCIDIA (x=8-156), ARIA (x=164-312)
-      // Row 2 (y=82-104): CADENCE (x=8-156), CECILIA (x=164-312)
-      // Row 3 (y=108-130): OCTAVIA (x=8-156), ALICE (x=164-312)
-
-      {
-        const char* names[] = {"LUCIDIA", "ARIA", "CADENCE", "CECILIA", "OCTAVIA", "ALICE"};
-        int tappedAI = -1;
+        String action = actions[arg];
+        Serial.println("EXEC 4×4 - " + action + " activated");
 
-        // Row 1 (y=56-78)
-        if (y >= 56 && y <= 78) {
-          if (x >= 8 && x <= 156) tappedAI = 0; // LUCIDIA
-          else if (x >= 164 && x <= 312) tappedAI = 1; // ARIA
-        }
-        // Row 2 (y=82-104)
-        else if (y >= 82 && y <= 104) {
-          if (x >= 8 && x <= 156) tappedAI = 2; // CADENCE
-          else if (x >= 164 && x <= 312) tappedAI = 3; // CECILIA
-        }
-        // Row 3 (y=108-130)
-        else if (y >= 108 && y <= 130) {
-          if (x >= 8 && x <= 156) tappedAI = 4; // OCTAVIA
-          else if (x >= 164 && x <= 312) tappedAI = 5; // ALICE
-        }
+        // Update counts for matching actions
+        if (action == "APPROVE") {approveCount++; playSuccess();}
+        else if (action == "REJECT") {rejectCount++; playCritical();}
+        else if (action == "HOLD") {holdCount++;}
+        else if (action == "SHIP") {shipCount++; playSuccess();}
+        else if (action == "ESCALATE") {escalateCount++;}
+        else if (action == "CRITICAL") {criticalCount++; playCritical();}
+        else if (action == "BLOCKED") {blockedCount++;}
 
-        if (tappedAI != -1) {
-          activeAI = tappedAI;
-          playBeep();
-          Serial.printf("🔄 RECURSION! Switched to %s (AI #%d)\n", names[tappedAI], tappedAI);
-          Serial.println("💡 AI now references different apps!");
-          drawCurrentScreen(); // Redraw with new AI conversation
-        }
+        delay(100);
+        drawExecGrid();
       }
       break;
 
-    case SCREEN_TERMINAL:
-      // Check back button FIRST (larger hitbox for better touch response)
-      if (x >= 5 && x <= 80 && y >= 0 && y <= 45) {
-        Serial.println("Back button tapped - returning to home");
+    case ACT_HOT_LEADS_SYNC:
+      {
+        Serial.println("🔄 SYNC CRM button tapped - fetching live hot leads...");
         playBeep();
-        currentScreen = SCREEN_HOME;
-        drawCurrentScreen();
-        break;
-      }
 
-      // KEYBOARD button (tappable area: x=200-310, y=215-235)
-      if (x >= 200 && x <= 310 && y >= 215 && y <= 235) {
-        Serial.println("⌨ Opening keyboard...");
-        playBeep();
-        screenBeforeKeyboard = SCREEN_TERMINAL;
-        currentScreen = SCREEN_KEYBOARD;
-        drawCurrentScreen();
-        break;
+        // Show loading indicator
+        tft.fillRoundRect(250, 278, 62, 32, 4, COLOR_SUNRISE);
+        tft.setTextColor(COLOR_BLACK);
+        tft.setTextDatum(TC_DATUM);
+        brFont.drawMonoText("...", 281, 288, 1, COLOR_BLACK);
+
+        // Fetch live CRM data on the net task; loop() finishes on the snapshot
+        if (netRequest(NET_HOT_LEADS)) hotLeadsSyncPending = true;
+        else finishHotLeadsSync(false);
       }
       break;
 
-    case SCREEN_KEYBOARD:
+    case ACT_CHAT_SELECT_AI:
+      // RECURSIVE AI MODEL SELECTION - Tap any model to switch! (BETTER THAN iPHONE!)
       {
-        // QWERTY keyboard touch handling (BETTER THAN iPHONE!)
-        const char* row1 = "QWERTYUIOP";
-        const char* row2 = "ASDFGHJKL";
-        const char* row3 = "ZXCVBNM";
-
-        int keyWidth = 28;
-        int keyHeight = 24;
-        int keySpacing = 2;
-
-        bool keyPressed = false;
-
-        // Row 1 (10 keys, y=123-147)
-        if (y >= 123 && y <= 147) {
-          int startX = 10;
-          for (int i = 0; i < 10; i++) {
-            int keyX = startX + i * (keyWidth + keySpacing);
-            if (x >= keyX && x <= keyX + keyWidth) {
-              terminalBuffer += row1[i];
-              playBeep();
-              Serial.printf("⌨ Key pressed: %c\n", row1[i]);
-              keyPressed = true;
-              break;
-            }
-          }
-        }
-
-        // Row 2 (9 keys, y=151-175, centered at x=25)
-        if (!keyPressed && y >= 151 && y <= 175) {
-          int startX = 25;
-          for (int i = 0; i < 9; i++) {
-            int keyX = startX + i * (keyWidth + keySpacing);
-            if (x >= keyX && x <= keyX + keyWidth) {
-              terminalBuffer += row2[i];
-              playBeep();
-              Serial.printf("⌨ Key pressed: %c\n", row2[i]);
-              keyPressed = true;
-              break;
-            }
-          }
-        }
+        const char* names[] = {"LUCIDIA", "ARIA", "CADENCE", "CECILIA", "OCTAVIA", "ALICE"};
+        activeAI = arg;
+        playBeep();
+        Serial.printf("🔄 RECURSION! Switched to %s (AI #%d)\n", names[arg], arg);
+        Serial.println("💡 AI now references different apps!");
+        drawCurrentScreen(); // Redraw with new AI conversation
+      }
+      break;
 
-        // Row 3 (7 keys, y=179-203, centered at x=55)
-        if (!keyPressed && y >= 179 && y <= 203) {
-          int startX = 55;
-          for (int i = 0; i < 7; i++) {
-            int keyX = startX + i * (keyWidth + keySpacing);
-            if (x >= keyX && x <= keyX + keyWidth) {
-              terminalBuffer += row3[i];
-              playBeep();
-              Serial.printf("⌨ Key pressed: %c\n", row3[i]);
-              keyPressed = true;
-              break;
-            }
-          }
-        }
+    case ACT_OPEN_KEYBOARD:
+      Serial.println("⌨ Opening keyboard...");
+      playBeep();
+      screenBeforeKeyboard = SCREEN_TERMINAL;
+      currentScreen = SCREEN_KEYBOARD;
+      drawCurrentScreen();
+      break;
 
-        // Bottom row (y=207-231)
-        if (!keyPressed && y >= 207 && y <= 231) {
-          // SPACE (x=10-110)
-          if (x >= 10 && x <= 110) {
-            terminalBuffer += ' ';
-            playBeep();
-            Serial.println("⌨ SPACE pressed");
-            keyPressed = true;
-          }
-          // BACKSPACE (x=115-175)
-          else if (x >= 115 && x <= 175) {
-            if (terminalBuffer.length() > 0) {
-              terminalBuffer.remove(terminalBuffer.length() - 1);
-              playBeep();
-              Serial.println("⌨ BACKSPACE pressed");
-              keyPressed = true;
-            }
-          }
-          // ENTER (x=180-230)
-          else if (x >= 180 && x <= 230) {
-            playSuccess();
-            Serial.printf("⌨ ENTER pressed - Command: %s\n", terminalBuffer.c_str());
-
-            // Add command to history
-            if (terminalBuffer.length() > 0) {
-              // Shift history up
-              for (int i = 0; i < 7; i++) {
-                terminalHistory[i] = terminalHistory[i+1];
-              }
-              // Add new command and placeholder output
-              terminalHistory[6] = "$ " + terminalBuffer;
-              terminalHistory[7] = "> [Command executed]";
-              historyCount = 8;
-
-              // Clear buffer
-              terminalBuffer = "";
-            }
-
-            // Close keyboard and return to terminal
-            currentScreen = screenBeforeKeyboard;
-            drawCurrentScreen();
-            keyPressed = true;
-          }
-          // DONE (x=235-310)
-          else if (x >= 235 && x <= 310) {
-            playBeep();
-            Serial.println("⌨ DONE pressed - closing keyboard");
-            currentScreen = screenBeforeKeyboard;
-            drawCurrentScreen();
-            keyPressed = true;
-          }
-        }
+    // QWERTY keyboard (BETTER THAN iPHONE!) - redraw to show the buffer
+    case ACT_KEY_CHAR:
+      terminalBuffer += (char)arg;
+      playBeep();
+      Serial.printf("⌨ Key pressed: %c\n", (char)arg);
+      drawCurrentScreen();
+      break;
 
-        // Redraw keyboard to show updated buffer
-        if (keyPressed) {
-          drawCurrentScreen();
-        }
-      }
+    case ACT_KEY_SPACE:
+      terminalBuffer += ' ';
+      playBeep();
+      Serial.println("⌨ SPACE pressed");
+      drawCurrentScreen();
       break;
 
-    case SCREEN_EMERGENCY_PAGER:
-      // Back button
-      if (x >= 10 && x <= 60 && y >= 25 && y <= 45) {
-        Serial.println("Pager: Back to home");
+    case ACT_KEY_BACKSPACE:
+      if (terminalBuffer.length() > 0) {
+        terminalBuffer.remove(terminalBuffer.length() - 1);
         playBeep();
-        currentScreen = SCREEN_HOME;
+        Serial.println("⌨ BACKSPACE pressed");
         drawCurrentScreen();
-        break;
       }
+      break;
 
-      // ACK button (30, 200, 120, 35)
-      if (x >= 30 && x <= 150 && y >= 200 && y <= 235) {
-        Serial.println("Pager: ACK pressed");
-        playBeep();
-        acknowledgeAlert();
-        currentScreen = SCREEN_HOME;
-        drawCurrentScreen();
-        break;
-      }
+    case ACT_KEY_ENTER:
+      playSuccess();
+      Serial.printf("⌨ ENTER pressed - Command: %s\n", terminalBuffer.c_str());
 
-      // DISMISS button (170, 200, 120, 35)
-      if (x >= 170 && x <= 290 && y >= 200 && y <= 235) {
-        Serial.println("Pager: DISMISS pressed");
-        playBeep();
-        hasActiveAlert = false;
-        apps[16].badge = 0;
-        currentScreen = SCREEN_HOME;
-        drawCurrentScreen();
-        break;
+      // Add command to history
+      if (terminalBuffer.length() > 0) {
+        // Shift history up
+        for (int i = 0; i < 7; i++) {
+          terminalHistory[i] = terminalHistory[i+1];
+        }
+        // Add new command and placeholder output
+        terminalHistory[6] = "$ " + terminalBuffer;
+        terminalHistory[7] = "> [Command executed]";
+        historyCount = 8;
+
+        // Clear buffer
+        terminalBuffer = "";
       }
+
+      // Close keyboard and return to terminal
+      currentScreen = screenBeforeKeyboard;
+      drawCurrentScreen();
       break;
 
-    case SCREEN_ALERT_HISTORY:
-      // Back button
-      if (x >= 10 && x <= 60 && y >= 25 && y <= 45) {
-        Serial.println("Alert History: Back to home");
-        playBeep();
-        currentScreen = SCREEN_HOME;
-        drawCurrentScreen();
-        break;
-      }
+    case ACT_KEY_DONE:
+      playBeep();
+      Serial.println("⌨ DONE pressed - closing keyboard");
+      currentScreen = screenBeforeKeyboard;
+      drawCurrentScreen();
       break;
 
     default:
-      // Back button (universal) - larger hit area for better touch response
-      if (x >= 5 && x <= 80 && y >= 0 && y <= 45) {
-        Serial.println("Back button tapped - returning to home");
-        playBeep();
-        currentScreen = SCREEN_HOME;
-        drawCurrentScreen();
+      // Empty home space - ripple so the tap still feels acknowledged
+      if (currentScreen == SCREEN_HOME) {
+        animStartRipple(SCREEN_HOME, x, y, COLOR_VIVID_PUR, restoreHomeRegion);
       }
-    }  // end switch
-   }  // end tap detection
-  }  // end touch ended
-
-  // Wait for touch release (with timeout to prevent blocking)
-  unsigned long releaseWait = millis();
-  while (digitalRead(XPT2046_IRQ) == LOW && (millis() - releaseWait < 100)) {
-    delay(5);
+      break;
+  }
+}
+
+// Handle one gesture, traced from its PENIRQ edge to the last pixel it
+// changed (drag updates only feed the recognizer, nothing to trace)
+void dispatchGesture(const Gesture& g) {
+  bool traced = g.type != GESTURE_DRAG && g.type != GESTURE_DRAG_START;
+  if (traced) latencyBegin(g.irqUs, g.us);
+  handleGesture(g);
+  if (traced) latencyEnd(currentScreen);
+}
+
+// Drain the touch queue through the gesture recognizer - never waits on
+// the controller
+void handleTouch() {
+  touchService();
+  Gesture g;
+  TouchEvent e;
+  while (touchNextEvent(e)) {
+    gestureFeed(e);
+    while (gestureNext(g)) dispatchGesture(g);
   }
+  gestureTick(micros());   // long press fires with the finger still down
+  while (gestureNext(g)) dispatchGesture(g);
 }
 
 void connectWiFi() {
@@ -4538,179 +4418,63 @@ void setupAIAPI() {
 // EMERGENCY PAGER - LED PATTERN FUNCTIONS
 // ═══════════════════════════════════════════════════════════════════
 
-void ledHeartbeat() {
-  // Gentle breathing pattern (standby mode)
-  for(int brightness = 0; brightness <= 255; brightness += 5) {
-    analogWrite(LED_PIN, brightness);
-    delay(20);
-  }
-  for(int brightness = 255; brightness >= 0; brightness -= 5) {
-    analogWrite(LED_PIN, brightness);
-    delay(20);
-  }
-}
-
-void ledFastStrobe() {
-  // Ultra-fast strobe for P1/CRITICAL (50ms on/off, 10 seconds)
-  unsigned long start = millis();
-  while(millis() - start < 10000 && hasActiveAlert) {
-    digitalWrite(LED_PIN, HIGH);
-    delay(50);
-    digitalWrite(LED_PIN, LOW);
-    delay(50);
-  }
-}
-
-void ledMediumBlink() {
-  // Fast blink for P2/URGENT (200ms on/off, 8 seconds)
-  unsigned long start = millis();
-  while(millis() - start < 8000 && hasActiveAlert) {
-    digitalWrite(LED_PIN, HIGH);
-    delay(200);
-    digitalWrite(LED_PIN, LOW);
-    delay(200);
-  }
-}
-
-void ledSlowBlink() {
-  // Slow blink for normal priority (500ms on/off, 5 seconds)
-  unsigned long start = millis();
-  while(millis() - start < 5000 && hasActiveAlert) {
-    digitalWrite(LED_PIN, HIGH);
-    delay(500);
-    digitalWrite(LED_PIN, LOW);
-    delay(500);
-  }
-}
-
-void ledDoubleFlash() {
-  // Double flash pattern (100ms-100ms-100ms-200ms, repeat)
-  unsigned long start = millis();
-  while(millis() - start < 8000 && hasActiveAlert) {
-    digitalWrite(LED_PIN, HIGH);
-    delay(100);
-    digitalWrite(LED_PIN, LOW);
-    delay(100);
-    digitalWrite(LED_PIN, HIGH);
-    delay(100);
-    digitalWrite(LED_PIN, LOW);
-    delay(200);
-  }
-}
-
-void ledMorseSOS() {
-  // Morse code SOS (... --- ...) - Emergency pattern
-  while(hasActiveAlert) {
-    // S (...)
-    for(int i = 0; i < 3; i++) {
-      digitalWrite(LED_PIN, HIGH);
-      delay(200);
-      digitalWrite(LED_PIN, LOW);
-      delay(200);
-    }
-    delay(400);
-
-    // O (---)
-    for(int i = 0; i < 3; i++) {
-      digitalWrite(LED_PIN, HIGH);
-      delay(600);
-      digitalWrite(LED_PIN, LOW);
-      delay(200);
-    }
-    delay(400);
-
-    // S (...)
-    for(int i = 0; i < 3; i++) {
-      digitalWrite(LED_PIN, HIGH);
-      delay(200);
-      digitalWrite(LED_PIN, LOW);
-      delay(200);
-    }
-
-    delay(2000); // Pause between SOS repeats
-  }
-}
-
+// Step tables in feedback.h; the sequencer plays them off a hardware timer
 void triggerLEDPattern(int patternId) {
-  // Trigger LED pattern in non-blocking way (simplified version)
   switch(patternId) {
-    case PATTERN_HEARTBEAT:
-      ledHeartbeat();
-      break;
-    case PATTERN_FAST_STROBE:
-      ledFastStrobe();
-      break;
-    case PATTERN_MEDIUM_BLINK:
-      ledMediumBlink();
-      break;
-    case PATTERN_SLOW_BLINK:
-      ledSlowBlink();
-      break;
-    case PATTERN_DOUBLE_FLASH:
-      ledDoubleFlash();
-      break;
-    case PATTERN_MORSE_SOS:
-      ledMorseSOS();
-      break;
+    case PATTERN_HEARTBEAT:    feedbackPlay(FB_HEARTBEAT); break;
+    case PATTERN_FAST_STROBE:  feedbackPlay(FB_FAST_STROBE); break;
+    case PATTERN_MEDIUM_BLINK: feedbackPlay(FB_MEDIUM_BLINK); break;
+    case PATTERN_SLOW_BLINK:   feedbackPlay(FB_SLOW_BLINK); break;
+    case PATTERN_DOUBLE_FLASH: feedbackPlay(FB_DOUBLE_FLASH); break;
+    case PATTERN_MORSE_SOS:    feedbackPlay(FB_MORSE_SOS); break;
   }
-  digitalWrite(LED_PIN, LOW); // Ensure LED is off after pattern
 }
 
 // ═══════════════════════════════════════════════════════════════════
 // EMERGENCY PAGER - SERIAL COMMAND HANDLER
 // ═══════════════════════════════════════════════════════════════════
 
-bool isDuplicateAlert(String alertId) {
-  for(int i = 0; i < 20; i++) {
-    if(alertCache[i] == alertId) {
-      return true;
-    }
-  }
-  alertCache[cacheIndex] = alertId;
-  cacheIndex = (cacheIndex + 1) % 20;
-  return false;
-}
-
-void parseAlert(String command) {
-  // Parse: "ALERT LINEAR P1" or "ALERT SLACK CRITICAL"
-  command.trim();
-
-  int firstSpace = command.indexOf(' ');
-  int secondSpace = command.indexOf(' ', firstSpace + 1);
+void parseAlert(StrView args) {
+  // Parse the arguments of "ALERT LINEAR P1" or "ALERT SLACK CRITICAL"
+  args = args.trim();
+  if(args.isEmpty()) return;
 
-  if(firstSpace == -1) return;
+  int space = args.indexOf(' ');
+  StrView source = args.substring(0, space == -1 ? args.length() : space);
+  StrView priority = space == -1 ? StrView() : args.substring(space + 1);
 
-  String source = command.substring(firstSpace + 1, secondSpace == -1 ? command.length() : secondSpace);
-  String priority = secondSpace == -1 ? "" : command.substring(secondSpace + 1);
-
-  // Create unique alert ID for deduplication
-  String alertId = source + "-" + priority + "-" + String(millis() / 60000);
+  Serial.println(raiseAlert(source, priority, StrView()) ? "OK" : "DUPLICATE");
+}
 
-  if(isDuplicateAlert(alertId)) {
-    Serial.println("DUPLICATE");
-    return;
+// Text ALERT and PF_ALERT frames. Empty message = "Alert from ..."; false
+// if the same source + priority is still inside its dedupe window
+bool raiseAlert(StrView source, StrView priority, StrView message) {
+  if(isDuplicateAlert(source, priority)) {
+    return false;
   }
 
   // Store alert
-  strncpy(currentAlert.source, source.c_str(), 15);
-  currentAlert.source[15] = '\0';
-  strncpy(currentAlert.priority, priority.c_str(), 15);
-  currentAlert.priority[15] = '\0';
+  source.copyTo(currentAlert.source, sizeof(currentAlert.source));
+  priority.copyTo(currentAlert.priority, sizeof(currentAlert.priority));
 
-  // Set default message
-  snprintf(currentAlert.message, 127, "Alert from %s with priority %s",
-           currentAlert.source, currentAlert.priority);
+  // Message from the frame, or the default one
+  if(!message.isEmpty()) {
+    message.copyTo(currentAlert.message, sizeof(currentAlert.message));
+  } else {
+    snprintf(currentAlert.message, 127, "Alert from %s with priority %s",
+             currentAlert.source, currentAlert.priority);
+  }
 
   currentAlert.timestamp = millis();
   currentAlert.acknowledged = false;
   hasActiveAlert = true;
 
   // Determine LED pattern
-  if(strcmp(priority.c_str(), "P1") == 0 || strcmp(priority.c_str(), "CRITICAL") == 0) {
+  if(priority == "P1" || priority == "CRITICAL") {
     currentAlert.patternId = PATTERN_FAST_STROBE;
-  } else if(strcmp(priority.c_str(), "P2") == 0 || strcmp(priority.c_str(), "URGENT") == 0) {
+  } else if(priority == "P2" || priority == "URGENT") {
     currentAlert.patternId = PATTERN_MEDIUM_BLINK;
-  } else if(strcmp(priority.c_str(), "SOS") == 0) {
+  } else if(priority == "SOS") {
     currentAlert.patternId = PATTERN_MORSE_SOS;
   } else {
     currentAlert.patternId = PATTERN_SLOW_BLINK;
@@ -4730,120 +4494,516 @@ void parseAlert(String command) {
   // Update PAGER app badge
   apps[16].badge = hasActiveAlert ? 1 : 0;
 
-  // Switch to pager screen
-  currentScreen = SCREEN_EMERGENCY_PAGER;
+  // The UI switches to the pager screen when it takes the event
+  busPublish(BUS_FROM_UI, BUS_ALERT_RAISED, 0, currentAlert.patternId);
+  busPublish(BUS_FROM_UI, BUS_BADGE, 16, apps[16].badge);
 
-  Serial.println("OK");
+  pagerRaise();  // LED pattern plays off the feedback timer
+  return true;
 }
 
-void acknowledgeAlert() {
-  currentAlert.acknowledged = true;
+// ACK, DISMISS, STANDBY
+void clearAlert() {
   hasActiveAlert = false;
   apps[16].badge = 0;  // Clear PAGER badge
+  pagerAck();
+  busPublish(BUS_FROM_UI, BUS_ALERT_CLEARED);
+  busPublish(BUS_FROM_UI, BUS_BADGE, 16, 0);
+}
+
+void acknowledgeAlert() {
+  currentAlert.acknowledged = true;
+  clearAlert();
   Serial.println("ACK");
 }
 
 void sendStatus() {
-  String status = "STATE ";
-  if(hasActiveAlert) {
-    status += "ALERT";
+  Serial.print("STATE ");
+  Serial.println(hasActiveAlert ? "ALERT" : "STANDBY");
+}
+
+// ─────────────────────────────────────────────────────────────────────
+// COMMAND HANDLERS - args is the rest of the line after the token
+// ─────────────────────────────────────────────────────────────────────
+
+bool cmdAlert(StrView args) {
+  parseAlert(args);
+  return true;
+}
+
+bool cmdAck(StrView args) {
+  if (!args.isEmpty()) return false;
+  acknowledgeAlert();
+  return true;
+}
+
+bool cmdPing(StrView args) {
+  if (!args.isEmpty()) return false;
+  Serial.println("READY");
+  return true;
+}
+
+bool cmdStatus(StrView args) {
+  if (!args.isEmpty()) return false;
+  sendStatus();
+  return true;
+}
+
+bool cmdStandby(StrView args) {
+  if (!args.isEmpty()) return false;
+  clearAlert();  // leaves the pager screen when the UI takes the event
+  Serial.println("OK");
+  return true;
+}
+
+bool cmdReset(StrView args) {
+  if (!args.isEmpty()) return false;
+  ESP.restart();
+  return true;
+}
+
+bool cmdPerf(StrView args) {
+  if (!args.isEmpty()) return false;
+  // Print full diagnostic report
+  printDiagnosticReport();
+  return true;
+}
+
+bool cmdHeap(StrView args) {
+  if (args == "RESET") {
+    resetHeapTrace();
+    Serial.println("OK");
+    return true;
+  }
+  if (!args.isEmpty()) return false;
+  // Quick heap stats
+  Serial.println("\n━━━━━━━━━━━━━━━━━━━━━━━━━━━━");
+  Serial.println("   HEAP MEMORY SNAPSHOT");
+  Serial.println("━━━━━━━━━━━━━━━━━━━━━━━━━━━━");
+  Serial.printf("   Free:       %d bytes (%d KB)\n", perfMetrics.freeHeap, perfMetrics.freeHeap / 1024);
+  Serial.printf("   Min Free:   %d bytes (%d KB)\n", perfMetrics.minFreeHeap, perfMetrics.minFreeHeap / 1024);
+  Serial.printf("   Total:      %d bytes (%d KB)\n", perfMetrics.heapSize, perfMetrics.heapSize / 1024);
+  Serial.printf("   Usage:      %d%%\n", getHeapUsagePercent());
+  Serial.printf("   Fragment:   %d%%\n", perfMetrics.heapFragmentation);
+  printHeapTraceReport();   // per-tag live/peak/rate + largest blocks
+  Serial.println("━━━━━━━━━━━━━━━━━━━━━━━━━━━━\n");
+  return true;
+}
+
+bool cmdWifi(StrView args) {
+  if (!args.isEmpty()) return false;
+  // Quick WiFi stats
+  Serial.println("\n━━━━━━━━━━━━━━━━━━━━━━━━━━━━");
+  Serial.println("   WIFI STATUS");
+  Serial.println("━━━━━━━━━━━━━━━━━━━━━━━━━━━━");
+  if (WiFi.status() == WL_CONNECTED) {
+    Serial.printf("   Status:     Connected\n");
+    Serial.printf("   SSID:       %s\n", WiFi.SSID().c_str());
+    Serial.printf("   IP:         %s\n", WiFi.localIP().toString().c_str());
+    Serial.printf("   RSSI:       %d dBm\n", perfMetrics.rssi);
+    Serial.printf("   Quality:    %d%% (%s)\n", perfMetrics.wifiQuality, getWiFiQualityString());
   } else {
-    status += "STANDBY";
+    Serial.println("   Status:     Disconnected");
   }
-  Serial.println(status);
+  Serial.println("━━━━━━━━━━━━━━━━━━━━━━━━━━━━\n");
+  return true;
 }
 
-void handleSerialCommand() {
-  if (Serial.available()) {
-    String cmd = Serial.readStringUntil('\n');
-    cmd.trim();
+bool cmdUptime(StrView args) {
+  if (!args.isEmpty()) return false;
+  // Quick uptime
+  char uptime[16];
+  Serial.printf("\nUptime: %s\n", formatUptime(uptime, sizeof(uptime)));
+  Serial.printf("Boot Reason: %s\n\n", getRebootReasonString());
+  return true;
+}
 
-    if (cmd.startsWith("ALERT")) {
-      parseAlert(cmd);
-    }
-    else if (cmd == "ACK") {
-      acknowledgeAlert();
-    }
-    else if (cmd == "PING") {
-      Serial.println("READY");
-    }
-    else if (cmd == "STATUS") {
-      sendStatus();
-    }
-    else if (cmd == "STANDBY") {
-      hasActiveAlert = false;
-      apps[16].badge = 0;
-      if(currentScreen == SCREEN_EMERGENCY_PAGER) {
-        currentScreen = SCREEN_HOME;
-      }
-      Serial.println("OK");
-    }
-    else if (cmd == "RESET") {
-      ESP.restart();
-    }
-    else if (cmd == "PERF" || cmd == "DIAG") {
-      // Print full diagnostic report
-      printDiagnosticReport();
-    }
-    else if (cmd == "HEAP") {
-      // Quick heap stats
-      Serial.println("\n━━━━━━━━━━━━━━━━━━━━━━━━━━━━");
-      Serial.println("   HEAP MEMORY SNAPSHOT");
-      Serial.println("━━━━━━━━━━━━━━━━━━━━━━━━━━━━");
-      Serial.printf("   Free:       %d bytes (%d KB)\n", perfMetrics.freeHeap, perfMetrics.freeHeap / 1024);
-      Serial.printf("   Min Free:   %d bytes (%d KB)\n", perfMetrics.minFreeHeap, perfMetrics.minFreeHeap / 1024);
-      Serial.printf("   Total:      %d bytes (%d KB)\n", perfMetrics.heapSize, perfMetrics.heapSize / 1024);
-      Serial.printf("   Usage:      %d%%\n", getHeapUsagePercent());
-      Serial.printf("   Fragment:   %d%%\n", perfMetrics.heapFragmentation);
-      Serial.println("━━━━━━━━━━━━━━━━━━━━━━━━━━━━\n");
-    }
-    else if (cmd == "WIFI") {
-      // Quick WiFi stats
-      Serial.println("\n━━━━━━━━━━━━━━━━━━━━━━━━━━━━");
-      Serial.println("   WIFI STATUS");
-      Serial.println("━━━━━━━━━━━━━━━━━━━━━━━━━━━━");
-      if (WiFi.status() == WL_CONNECTED) {
-        Serial.printf("   Status:     Connected\n");
-        Serial.printf("   SSID:       %s\n", WiFi.SSID().c_str());
-        Serial.printf("   IP:         %s\n", WiFi.localIP().toString().c_str());
-        Serial.printf("   RSSI:       %d dBm\n", perfMetrics.rssi);
-        Serial.printf("   Quality:    %d%% (%s)\n", perfMetrics.wifiQuality, getWiFiQualityString().c_str());
-      } else {
-        Serial.println("   Status:     Disconnected");
-      }
-      Serial.println("━━━━━━━━━━━━━━━━━━━━━━━━━━━━\n");
-    }
-    else if (cmd == "UPTIME") {
-      // Quick uptime
-      Serial.printf("\nUptime: %s\n", getUptimeString().c_str());
-      Serial.printf("Boot Reason: %s\n\n", getRebootReasonString().c_str());
-    }
-    else if (cmd == "HELP") {
-      // Show available commands
-      Serial.println("\n━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━");
-      Serial.println("   BLACKROAD ESP32 SERIAL COMMANDS");
-      Serial.println("━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━");
-      Serial.println("   ALERT <msg>  - Send emergency pager alert");
-      Serial.println("   ACK          - Acknowledge current alert");
-      Serial.println("   STANDBY      - Clear alerts and return to standby");
-      Serial.println("   PING         - Check if device is responsive");
-      Serial.println("   STATUS       - Show pager status");
-      Serial.println("   PERF         - Full performance diagnostic report");
-      Serial.println("   DIAG         - Alias for PERF");
-      Serial.println("   HEAP         - Quick heap memory snapshot");
-      Serial.println("   WIFI         - Quick WiFi status");
-      Serial.println("   UPTIME       - Show uptime and boot reason");
-      Serial.println("   RESET        - Reboot device");
-      Serial.println("   HELP         - Show this help message");
-      Serial.println("━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━\n");
-    }
+bool cmdRender(StrView args) {
+  if (args == "RESET") {
+    resetRenderProfiler();
+    Serial.println("OK");
+    return true;
+  }
+  if (!args.isEmpty()) return false;
+  // Ranked per-screen render cost + hottest draw call sites
+  printRenderReport(SCREEN_NAMES, SCREEN_COUNT);
+  return true;
+}
+
+bool cmdAnim(StrView args) {
+  if (!args.isEmpty()) return false;
+  // Animation scheduler stats since the last ANIM
+  printAnimationReport();
+  return true;
+}
+
+bool cmdLayout(StrView args) {
+  if (!args.isEmpty()) return false;
+  // Layout engine benchmark (renders each layout, then restores the screen)
+  printLayoutBenchmark();
+  drawCurrentScreen();
+  return true;
+}
+
+bool cmdTouch(StrView args) {
+  if (args == "RESET") {
+    resetTouchStats();
+    Serial.println("OK");
+    return true;
+  }
+  if (!args.isEmpty()) return false;
+  // Sampler jitter, false touches, queue + handler latency
+  printTouchReport();
+  return true;
+}
+
+// Walk every page transition live, then from the cache
+void swipeBench() {
+  Screen savedScreen = currentScreen;
+  int savedPage = currentPage;
+  bool savedEnabled = homeCacheEnabled;
+  currentScreen = SCREEN_HOME;
+  currentPage = 0;
+  resetSwipeStats();
+  for (int pass = 0; pass < 2; pass++) {
+    homeCacheEnabled = (pass == 1);
+    for (int p = 1; p < TOTAL_PAGES; p++) showHomePage(p, micros());
+    for (int p = TOTAL_PAGES - 2; p >= 0; p--) showHomePage(p, micros());
+  }
+  homeCacheEnabled = savedEnabled;
+  currentScreen = savedScreen;
+  currentPage = savedPage;
+  drawCurrentScreen();
+  printHomeCacheReport();
+}
+
+bool cmdSwipe(StrView args) {
+  if (args.isEmpty()) {
+    // Home page cache size and swipe-to-page latency
+    printHomeCacheReport();
+  } else if (args == "RESET") {
+    resetSwipeStats();
+    Serial.println("OK");
+  } else if (args == "BENCH") {
+    swipeBench();
+  } else if (args == "CACHE ON" || args == "CACHE OFF") {
+    homeCacheEnabled = args.endsWith("ON");
+    Serial.printf("Home page cache %s\n", homeCacheEnabled ? "ON" : "OFF");
+  } else if (args == "SLIDE ON" || args == "SLIDE OFF") {
+    homeCacheSlide = args.endsWith("ON");
+    Serial.printf("Home slide transition %s\n", homeCacheSlide ? "ON" : "OFF");
+  } else {
+    return false;
+  }
+  return true;
+}
+
+bool cmdLatency(StrView args) {
+  if (args == "RESET") {
+    resetLatencyStats();
+    Serial.println("OK");
+    return true;
+  }
+  if (!args.isEmpty()) return false;
+  // Touch-to-photon histogram + stage breakdown per screen
+  printLatencyReport(SCREEN_NAMES, SCREEN_COUNT);
+  return true;
+}
+
+bool cmdGestures(StrView args) {
+  if (args == "RESET") {
+    resetGestureStats();
+    Serial.println("OK");
+    return true;
+  }
+  if (!args.isEmpty()) return false;
+  // Recognized gestures + first-sample-to-decision latency
+  printGestureReport();
+  return true;
+}
+
+bool cmdHits(StrView args) {
+  if (args == "RESET") {
+    resetHitStats();
+    Serial.println("OK");
+    return true;
+  }
+  if (!args.isEmpty()) return false;
+  // Tap target index for the current screen + lookup cost
+  printHitReport(SCREEN_NAMES);
+  return true;
+}
+
+bool cmdTasks(StrView args) {
+  if (args == "RESET") {
+    resetTaskStats();
+    Serial.println("OK");
+    return true;
+  }
+  if (!args.isEmpty()) return false;
+  // Worst UI frame, pager ACK latency, net task load + snapshots
+  printTaskReport();
+  return true;
+}
+
+bool cmdTimers(StrView args) {
+  if (args == "RESET") {
+    resetTimerStats();
+    resetLoopIdleStats();
+    Serial.println("OK");
+    return true;
+  }
+  if (!args.isEmpty()) return false;
+  // Timer wheel, firing jitter and loop() idle time
+  printSchedReport();
+  return true;
+}
+
+bool cmdFeedback(StrView args) {
+  if (args.isEmpty()) {
+    // LED/buzzer sequencer and the worst loop() pass while it played
+    printFeedbackReport();
+  } else if (args == "RESET") {
+    resetFeedbackStats();
+    Serial.println("OK");
+  } else if (args == "STOP") {
+    feedbackStop(FB_LED);
+    feedbackStop(FB_BUZZER);
+    Serial.println("OK");
+  } else {
+    // Play a pattern by name (see FEEDBACK for the list)
+    char name[24];
+    int pattern = feedbackFind(args.copyTo(name, sizeof(name)));
+    if (pattern < 0) Serial.println("ERROR: unknown pattern");
+    else Serial.println(feedbackPlay(pattern) ? "OK" : "DROPPED: higher priority pattern playing");
+  }
+  return true;
+}
+
+bool cmdIdle(StrView args) {
+  if (args.isEmpty()) {
+    // Clock/sleep residency, modeled current, wake -> ready per source
+    printPowerReport();
+  } else if (args == "RESET") {
+    resetPowerStats();
+    Serial.println("OK");
+  } else if (args == "OFF" || args == "DFS" || args == "SLEEP") {
+    setPowerPolicy(args == "OFF" ? POWER_OFF : args == "DFS" ? POWER_DFS : POWER_SLEEP);
+    Serial.println("OK");
+  } else {
+    return false;
+  }
+  return true;
+}
+
+bool cmdBus(StrView args) {
+  if (args.isEmpty()) {
+    // Event counts, delivery latency, what the UI repainted for them
+    printBusReport();
+  } else if (args == "RESET") {
+    resetBusStats();
+    Serial.println("OK");
+  } else if (args.startsWith("BENCH")) {
+    int events = args.substring(5).trim().toInt();
+    if (events <= 0) events = BUS_BENCH_DEFAULT;
+    runBusBench(events);
+    printBusReport();
+  } else {
+    return false;
+  }
+  return true;
+}
+
+bool cmdStalls(StrView args) {
+  if (args == "RESET") {
+    resetStallStats();
+    Serial.println("OK");
+    return true;
+  }
+  if (!args.isEmpty()) return false;
+  // loop() passes over budget, newest first, with backtraces
+  printStallReport();
+  return true;
+}
+
+bool cmdArena(StrView args) {
+  if (args == "RESET") {
+    resetJsonArenaStats();
+    Serial.println("OK");
+    return true;
   }
+  if (!args.isEmpty()) return false;
+  // JSON slot use, per-caller peak bytes and heap spills
+  printJsonArenaReport();
+  return true;
+}
+
+bool cmdMem(StrView args) {
+  if (args == "BENCH") {
+    // Sequential read/write cycles per KB in each pool
+    memPlacementBench();
+    return true;
+  }
+  if (!args.isEmpty()) return false;
+  // Internal vs PSRAM placement per owner, internal headroom
+  printMemPlacementReport();
+  return true;
+}
+
+bool cmdNetStress(StrView args) {
+  // Saturate the network, then read TASKS for the worst case
+  int seconds = args.toInt();
+  if (seconds <= 0) seconds = NETSTRESS_DEFAULT_S;
+  startNetStress(seconds);
+  Serial.printf("NETSTRESS: back-to-back refreshes for %d s, stats reset - send TASKS\n", seconds);
+  return true;
+}
+
+bool cmdSerial(StrView args) {
+  if (args == "RESET") {
+    resetSerialStats();
+    Serial.println("OK");
+    return true;
+  }
+  if (!args.isEmpty()) return false;
+  // Lines, lookup cost, slowest command and pass
+  printSerialReport();
+  return true;
+}
+
+bool cmdFrames(StrView args) {
+  if (args == "RESET") {
+    resetPagerFrameStats();
+    Serial.println("OK");
+    return true;
+  }
+  if (!args.isEmpty()) return false;
+  // Binary pager frames: CRC errors, resends, SACKs, results
+  printPagerFrameReport();
+  return true;
+}
+
+bool cmdDedupe(StrView args) {
+  if (args.isEmpty()) {
+    // Window, live IDs, suppressed and evicted alerts, lookup cost
+    printAlertDedupeReport();
+  } else if (args == "RESET") {
+    resetAlertDedupeStats();
+    Serial.println("OK");
+  } else if (args == "CLEAR") {
+    alertDedupeClear();
+    Serial.println("OK");
+  } else if (args.startsWith("TTL ")) {
+    // DEDUPE TTL 300 EXTEND - seconds, mode defaults to FIXED
+    StrView rest = args.substring(4).trim();
+    int space = rest.indexOf(' ');
+    long secs = rest.toInt();
+    StrView mode = space == -1 ? StrView() : rest.substring(space + 1).trim();
+    if (secs <= 0 || (uint32_t)secs > DEDUPE_TTL_MAX_MS / 1000) return false;
+    if (!mode.isEmpty() && mode != "EXTEND" && mode != "FIXED") return false;
+    alertDedupeSetTtl((uint32_t)secs * 1000, mode == "EXTEND");
+    Serial.println("OK");
+  } else {
+    return false;
+  }
+  return true;
+}
+
+bool cmdHelp(StrView args) {
+  if (!args.isEmpty()) return false;
+  // Show available commands
+  Serial.println("\n━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━");
+  Serial.println("   BLACKROAD ESP32 SERIAL COMMANDS");
+  Serial.println("━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━");
+  Serial.println("   ALERT <msg>  - Send emergency pager alert");
+  Serial.println("   ACK          - Acknowledge current alert");
+  Serial.println("   STANDBY      - Clear alerts and return to standby");
+  Serial.println("   PING         - Check if device is responsive");
+  Serial.println("   STATUS       - Show pager status");
+  Serial.println("   PERF         - Full performance diagnostic report");
+  Serial.println("   DIAG         - Alias for PERF");
+  Serial.println("   HEAP         - Heap snapshot + per-subsystem use (HEAP RESET)");
+  Serial.println("   WIFI         - Quick WiFi status");
+  Serial.println("   UPTIME       - Show uptime and boot reason");
+  Serial.println("   LAYOUT       - Benchmark declarative screen layouts");
+  Serial.println("   ANIM         - Animation FPS, jitter and CPU share");
+  Serial.println("   RENDER       - Ranked per-screen render/SPI cost (RENDER RESET)");
+  Serial.println("   SWIPE        - Home page cache + swipe latency (RESET/BENCH)");
+  Serial.println("   TOUCH        - Touch jitter, false touches, latency (TOUCH RESET)");
+  Serial.println("   SWIPE CACHE|SLIDE ON|OFF - Toggle page cache / slide");
+  Serial.println("   GESTURES     - Gesture counts + decision latency (GESTURES RESET)");
+  Serial.println("   LATENCY      - Touch-to-photon latency per screen (LATENCY RESET)");
+  Serial.println("   HITS         - Tap target index + lookup cost (HITS RESET)");
+  Serial.println("   TASKS        - UI frame, pager ACK, net task stats (TASKS RESET)");
+  Serial.println("   NETSTRESS [s]- Refresh back-to-back for s seconds (default 30)");
+  Serial.println("   TIMERS       - Timer wheel jitter + loop() idle time (TIMERS RESET)");
+  Serial.println("   FEEDBACK [p] - LED/buzzer patterns, play p (FEEDBACK RESET/STOP)");
+  Serial.println("   IDLE [mode]  - Power idle report, mode OFF/DFS/SLEEP (IDLE RESET)");
+  Serial.println("   BUS          - Event bus latency + invalidations (BUS RESET/BENCH [n])");
+  Serial.println("   STALLS       - Slow loop() passes with backtraces (STALLS RESET)");
+  Serial.println("   ARENA        - JSON parse slots, per-caller peaks (ARENA RESET)");
+  Serial.println("   MEM          - Internal/PSRAM placement, headroom (MEM BENCH)");
+  Serial.println("   SERIAL       - Command lines, lookup cost, slowest pass (SERIAL RESET)");
+  Serial.println("   FRAMES       - Binary pager frames, CRC errors, SACKs (FRAMES RESET)");
+  Serial.println("   DEDUPE       - Alert dedupe window, suppressed (DEDUPE RESET/CLEAR/TTL s)");
+  Serial.println("   RESET        - Reboot device");
+  Serial.println("   HELP         - Show this help message");
+  Serial.println("━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━\n");
+  return true;
+}
+
+// First token -> handler; serialCmdInit() indexes it by perfect hash
+constexpr SerialCommand SERIAL_COMMANDS[] = {
+  { "ALERT",     cmdAlert },
+  { "ACK",       cmdAck },
+  { "PING",      cmdPing },
+  { "STATUS",    cmdStatus },
+  { "STANDBY",   cmdStandby },
+  { "RESET",     cmdReset },
+  { "PERF",      cmdPerf },
+  { "DIAG",      cmdPerf },
+  { "HEAP",      cmdHeap },
+  { "WIFI",      cmdWifi },
+  { "UPTIME",    cmdUptime },
+  { "RENDER",    cmdRender },
+  { "ANIM",      cmdAnim },
+  { "LAYOUT",    cmdLayout },
+  { "TOUCH",     cmdTouch },
+  { "SWIPE",     cmdSwipe },
+  { "LATENCY",   cmdLatency },
+  { "GESTURES",  cmdGestures },
+  { "HITS",      cmdHits },
+  { "TASKS",     cmdTasks },
+  { "TIMERS",    cmdTimers },
+  { "FEEDBACK",  cmdFeedback },
+  { "IDLE",      cmdIdle },
+  { "BUS",       cmdBus },
+  { "STALLS",    cmdStalls },
+  { "ARENA",     cmdArena },
+  { "MEM",       cmdMem },
+  { "NETSTRESS", cmdNetStress },
+  { "SERIAL",    cmdSerial },
+  { "FRAMES",    cmdFrames },
+  { "DEDUPE",    cmdDedupe },
+  { "HELP",      cmdHelp },
+};
+
+constexpr int SERIAL_COMMAND_COUNT = sizeof(SERIAL_COMMANDS) / sizeof(SERIAL_COMMANDS[0]);
+
+static_assert(serialCmdPerfect(SERIAL_COMMANDS, SERIAL_COMMAND_COUNT),
+              "two commands share a hash slot - pick a new SERIAL_CMD_SEED (tools/serial_bench.py --find-seed)");
+
+void handleSerialCommand() {
+  serialPoll();   // buffered lines only, never waits for the rest of one
 }
 
 // ═══════════════════════════════════════════════════════════════════
 
 void setup() {
+  Serial.setRxBufferSize(1024);   // a full window of pager frames between loop() passes
   Serial.begin(115200);
+  serialCmdInit(SERIAL_COMMANDS, SERIAL_COMMAND_COUNT);
+  initPagerFrames();
   delay(100);
   Serial.println("\n\n=================================");
   Serial.println("BLACKROAD AI QUANTUM DEVICE");
@@ -4855,14 +5015,15 @@ void setup() {
   pinMode(TFT_BL, OUTPUT);
   digitalWrite(TFT_BL, HIGH);
 
-  // Initialize LED for emergency pager
-  pinMode(LED_PIN, OUTPUT);
-  digitalWrite(LED_PIN, LOW);
-
-  // Initialize haptic/audio feedback (BETTER THAN iPHONE!)
-  pinMode(BUZZER_PIN, OUTPUT);
+  // Pager LED + haptic/audio feedback (BETTER THAN iPHONE!)
+  initFeedback();
   playSuccess();  // Boot sound
 
+  // JSON parse slots - reserved before the home cache and WiFi split the heap
+  initJsonArena();
+  initAlertLog();
+  initAlertDedupe();
+
   // Initialize display
   tft.init();
   tft.setRotation(1); // Landscape mode (320x240) - CLEAN HORIZONTAL LAYOUT
@@ -4870,11 +5031,19 @@ void setup() {
 
   Serial.println("Display initialized");
 
+  // Register data bindings for the declarative screen layouts
+  initScreenLayouts();
+  resetAnimStats();
+
+  // Pre-render the home pages so swipes are a single blit
+  initHomeCache();
+
   // Initialize touch SPI
   touchSPI.begin(XPT2046_CLK, XPT2046_MISO, XPT2046_MOSI, XPT2046_CS);
   pinMode(XPT2046_CS, OUTPUT);
   pinMode(XPT2046_IRQ, INPUT);
   digitalWrite(XPT2046_CS, HIGH);
+  initTouchInput();
 
   Serial.println("Touch initialized");
 
@@ -4915,6 +5084,11 @@ void setup() {
   // Connect to WiFi
   connectWiFi();
 
+  // Publish the boot data, then hand the network to its own task
+  initBusSubscribers();
+  initAppTasks();
+  initPowerIdle();
+
   // Start AI API Server (for Claude/ChatGPT)
   Serial.println("\n🤖 Starting AI API Server...");
   // setupAIAPI();  // Commented out - Emergency Pager doesn't need AI API server
@@ -4924,6 +5098,9 @@ void setup() {
   Serial.println("   Claude/ChatGPT can now call this device!");
   Serial.println("   SSH Target: " + String(OCTAVIA_IP));
 
+  // Stall sampler + task watchdog on loop() - after the slow WiFi connect
+  initStallDetector();
+
   // Show lock screen
   currentScreen = SCREEN_LOCK;
   drawCurrentScreen();
@@ -4933,26 +5110,32 @@ void setup() {
 }
 
 void loop() {
+  stallArm();               // backtrace this pass if it overruns STALL_BUDGET_MS
+
   // Update performance metrics every loop (needed for accurate loop timing)
   updatePerformanceMetrics();
 
+  uint32_t frameStart = micros();
+
+  stallPhase("serial");
   handleSerialCommand();  // Check for emergency pager commands
+  stallPhase("touch");
   handleTouch();
-
-  // Auto-refresh dynamic navigation every 5 minutes
-  static unsigned long lastNavUpdate = 0;
-  const unsigned long NAV_REFRESH_INTERVAL = 300000; // 5 minutes
-
-  if (WiFi.status() == WL_CONNECTED && millis() - lastNavUpdate > NAV_REFRESH_INTERVAL) {
-    updateDynamicNavigation();
-
-    // Check alert conditions after navigation update
-    #if ENABLE_ALERTS
-      checkAllAlerts();
-    #endif
-
-    lastNavUpdate = millis();
-  }
-
-  delay(10);
+  stallPhase("events");
+  uiApplyEvents();          // snapshots, alerts, badges -> repaint what changed
+  stallPhase("anim");
+  animTick(currentScreen);  // after input, so frames never delay a tap
+  stallPhase("net");
+  netService();             // APP_TASKS=0 only; the net task does this otherwise
+  stallPhase("timers");
+  feedbackService();        // FEEDBACK_HW_TIMER=0 only; esp_timer does this otherwise
+  timerService();           // nav refresh, alert cooldowns, ...
+
+  uiFrameDone(frameStart);
+  stallDisarm();
+  loopIdle();               // sleep to the next deadline or input event
 }
+
+#ifdef HOST_BUILD
+#include <host_runner.h>  // native build: main() drives setup()/loop() headlessly
+#endif
@@ -0,0 +1,203 @@
+#ifndef MEM_PLACEMENT_H
+#define MEM_PLACEMENT_H
+
+/*
+ * ═══════════════════════════════════════════════════════════════════════
+ * BLACKROAD MEMORY PLACEMENT - internal DRAM for hot, PSRAM for cold
+ * ═══════════════════════════════════════════════════════════════════════
+ *
+ * Internal DRAM is ~300 KB shared with WiFi, lwIP and every task stack;
+ * WROVER-class boards add 4-8 MB of PSRAM behind the flash cache, slower
+ * on a miss but plentiful. Large buffers that are filled once and read
+ * rarely should not compete with the small structures touched every
+ * frame. Long-lived buffers say which they are:
+ *
+ *   class      placed in                          used for
+ *   MEM_HOT    internal; PSRAM only if internal   JSON small slot, anything
+ *              is exhausted                       read per frame / per parse
+ *   MEM_COLD   PSRAM when fitted and it has       JSON large slot, home page
+ *              room; else internal                bands, alert log, CRM table,
+ *                                                 alert dedupe table
+ *
+ * Boards without PSRAM get internal RAM for everything, same as before.
+ * Per owner MEM tracks live blocks and bytes in each pool plus cold
+ * requests that had to fall back to internal; MEM BENCH times sequential
+ * reads and writes in both pools so the hot-path cost is a measured
+ * number rather than a guess.
+ *
+ * Per-frame state (nav snapshots, render stats, touch queue, alert
+ * screen rows) stays in static arrays - always internal, never here.
+ */
+
+#include <esp_heap_caps.h>
+#ifndef HOST_BUILD
+#include <soc/soc_memory_layout.h>
+#endif
+
+// ─────────────────────────────────────────────────────────────────────
+// CONFIGURATION
+// ─────────────────────────────────────────────────────────────────────
+
+#define MEM_BENCH_INTERNAL     16384   // bytes timed per pool by MEM BENCH
+#define MEM_BENCH_PSRAM        65536   // > the 32 KB flash/PSRAM cache, so misses count
+
+enum MemClass : uint8_t {
+  MEM_HOT,
+  MEM_COLD
+};
+
+enum MemOwner : uint8_t {
+  MEM_JSON_ARENA,      // json_arena.h
+  MEM_HOME_CACHE,      // home_cache.h
+  MEM_ALERT_LOG,       // alerts.h
+  MEM_CRM,             // api_functions.h
+  MEM_ALERT_DEDUPE,    // alert_dedupe.h
+  MEM_OWNER_COUNT
+};
+
+const char* const MEM_OWNER_NAMES[MEM_OWNER_COUNT] = { "json arena", "home cache", "alert log", "crm", "alert dedupe" };
+
+struct MemOwnerStats {
+  uint16_t blocks;
+  uint32_t internalBytes;   // live
+  uint32_t psramBytes;      // live
+  uint16_t fallbacks;       // cold blocks that landed in internal RAM
+  uint16_t failed;
+};
+
+MemOwnerStats memOwnerStats[MEM_OWNER_COUNT];
+
+// ─────────────────────────────────────────────────────────────────────
+// ALLOCATOR
+// ─────────────────────────────────────────────────────────────────────
+
+#define MEM_CAPS_INTERNAL (MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT)
+#define MEM_CAPS_PSRAM    (MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT)
+
+inline bool memInPsram(const void* p) {
+#ifdef HOST_BUILD
+  (void)p;
+  return false;   // host heap has no PSRAM
+#else
+  return p && esp_ptr_external_ram(p);
+#endif
+}
+
+// Largest block a MEM_COLD request could get from PSRAM, 0 without it
+size_t memPsramLargest() {
+  return psramFound() ? heap_caps_get_largest_free_block(MEM_CAPS_PSRAM) : 0;
+}
+
+void* memAlloc(size_t size, MemClass cls, MemOwner who) {
+  MemOwnerStats& st = memOwnerStats[who];
+  bool cold = cls == MEM_COLD && psramFound();
+  void* p = heap_caps_malloc(size, cold ? MEM_CAPS_PSRAM : MEM_CAPS_INTERNAL);
+  if (!p && psramFound()) p = heap_caps_malloc(size, cold ? MEM_CAPS_INTERNAL : MEM_CAPS_PSRAM);
+  if (!p) {
+    st.failed++;
+    return nullptr;
+  }
+  st.blocks++;
+  if (memInPsram(p)) {
+    st.psramBytes += size;
+  } else {
+    st.internalBytes += size;
+    if (cls == MEM_COLD && psramFound()) st.fallbacks++;
+  }
+  return p;
+}
+
+// `size` as passed to memAlloc (keeps the per-pool byte counts honest)
+void memFree(void* p, size_t size, MemOwner who) {
+  if (!p) return;
+  MemOwnerStats& st = memOwnerStats[who];
+  st.blocks--;
+  if (memInPsram(p)) st.psramBytes -= size;
+  else st.internalBytes -= size;
+  heap_caps_free(p);
+}
+
+// ─────────────────────────────────────────────────────────────────────
+// REPORT + BENCH
+// ─────────────────────────────────────────────────────────────────────
+
+void printMemPlacementReport() {
+  Serial.println("\n━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━");
+  Serial.println("   MEMORY PLACEMENT");
+  Serial.println("━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━");
+  Serial.printf("   %-14s%u KB free, largest block %u KB, low-water %u KB\n", "Internal:",
+                (unsigned)(heap_caps_get_free_size(MEM_CAPS_INTERNAL) / 1024),
+                (unsigned)(heap_caps_get_largest_free_block(MEM_CAPS_INTERNAL) / 1024),
+                (unsigned)(ESP.getMinFreeHeap() / 1024));
+  if (psramFound()) {
+    Serial.printf("   %-14s%u KB free of %u KB, largest block %u KB\n", "PSRAM:",
+                  (unsigned)(ESP.getFreePsram() / 1024), (unsigned)(ESP.getPsramSize() / 1024),
+                  (unsigned)(memPsramLargest() / 1024));
+  } else {
+    Serial.printf("   %-14snot fitted - cold buffers share internal RAM\n", "PSRAM:");
+  }
+
+  uint32_t moved = 0;
+  Serial.println("   Owner          Blocks  Internal     PSRAM  Fallback  Failed");
+  for (int i = 0; i < MEM_OWNER_COUNT; i++) {
+    const MemOwnerStats& st = memOwnerStats[i];
+    moved += st.psramBytes;
+    Serial.printf("   %-14s %6u %9u %9u %9u %7u\n", MEM_OWNER_NAMES[i], st.blocks,
+                  st.internalBytes, st.psramBytes, st.fallbacks, st.failed);
+  }
+  Serial.printf("   %-14s+%u KB internal kept free by PSRAM placement\n", "Headroom:",
+                (unsigned)(moved / 1024));
+  Serial.println("━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━\n");
+}
+
+// Cycles per KB for one sequential read pass and one write pass
+struct MemBenchResult {
+  uint32_t readCycles;
+  uint32_t writeCycles;
+};
+
+MemBenchResult memBenchPool(uint32_t* buf, size_t bytes) {
+  size_t words = bytes / 4;
+  uint32_t kb = bytes / 1024;
+  MemBenchResult r;
+  uint32_t c0 = ESP.getCycleCount();
+  for (size_t i = 0; i < words; i++) buf[i] = i;
+  r.writeCycles = (ESP.getCycleCount() - c0) / kb;
+  volatile uint32_t sum = 0;
+  c0 = ESP.getCycleCount();
+  for (size_t i = 0; i < words; i++) sum += buf[i];
+  r.readCycles = (ESP.getCycleCount() - c0) / kb;
+  return r;
+}
+
+// Allocates up to 80 KB for the duration of the call
+void memPlacementBench() {
+  Serial.println("\n━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━");
+  Serial.println("   MEMORY BENCH (cycles per KB, sequential 32-bit)");
+  Serial.println("━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━");
+  MemBenchResult inr = {0, 0};
+  uint32_t* in = (uint32_t*)heap_caps_malloc(MEM_BENCH_INTERNAL, MEM_CAPS_INTERNAL);
+  if (in) {
+    inr = memBenchPool(in, MEM_BENCH_INTERNAL);
+    heap_caps_free(in);
+    Serial.printf("   %-14sread %5u  write %5u\n", "Internal:", inr.readCycles, inr.writeCycles);
+  } else {
+    Serial.printf("   %-14sno %u B block free\n", "Internal:", MEM_BENCH_INTERNAL);
+  }
+
+  uint32_t* ps = psramFound() ? (uint32_t*)heap_caps_malloc(MEM_BENCH_PSRAM, MEM_CAPS_PSRAM) : nullptr;
+  if (ps) {
+    MemBenchResult psr = memBenchPool(ps, MEM_BENCH_PSRAM);
+    heap_caps_free(ps);
+    Serial.printf("   %-14sread %5u  write %5u\n", "PSRAM:", psr.readCycles, psr.writeCycles);
+    if (inr.readCycles && inr.writeCycles) {
+      Serial.printf("   %-14sread %.1fx  write %.1fx slower than internal\n", "Cost:",
+                    (float)psr.readCycles / inr.readCycles, (float)psr.writeCycles / inr.writeCycles);
+    }
+  } else {
+    Serial.printf("   %-14s%s\n", "PSRAM:", psramFound() ? "no block free" : "not fitted");
+  }
+  Serial.println("━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━\n");
+}
+
+#endif // MEM_PLACEMENT_H
@@ -0,0 +1,263 @@
+#ifndef PAGER_FRAME_H
+#define PAGER_FRAME_H
+
+/*
+ * ═══════════════════════════════════════════════════════════════════════
+ * BLACKROAD PAGER FRAMES - binary pager protocol beside the text one
+ * ═══════════════════════════════════════════════════════════════════════
+ *
+ * The text protocol is one command per line and one reply per command,
+ * so a bridge that cannot tell which OK belongs to which ALERT has to
+ * wait for each reply before sending the next. It also only carries
+ * source and priority; the message is made up on the device.
+ *
+ * Frames carry the full alert and can be pipelined. On the wire:
+ *
+ *   0x00  COBS( type | seq | payload | crc16 )  0x00
+ *
+ *   type     PF_HELLO / PF_PING / PF_STATUS / PF_ALERT / PF_ACK / PF_STANDBY
+ *   seq      0-255, chosen by the host, one per request
+ *   payload  PF_ALERT: source \0 priority \0 message (message may be empty)
+ *   crc16    CRC-16/CCITT-FALSE over type..payload, little endian
+ *
+ * The host keeps up to PAGER_WINDOW requests in flight. Every seq that
+ * arrives intact is acknowledged on its own with its result. After each
+ * serialPoll() pass the device sends one PF_SACK frame listing the
+ * (seq, result) pairs handled in it, so only the seqs that are missing
+ * from the SACKs (CRC error, dropped byte) need resending. A resent seq
+ * that already ran gets the stored result again, not a second alert;
+ * PF_HELLO starts a session and forgets those results, so a restarted
+ * bridge can begin again at seq 0. Text output (the ACK line, logs)
+ * still goes out between frames, one line at a time. Both ends split the
+ * stream the same way (serial_cmd.h): every 0x00 ends a frame, and a
+ * 0x00 with nothing before it opens one, so a lost delimiter costs one
+ * or two frames rather than the rest of the session.
+ *
+ * tools/pager_frame.py is the host side. tools/serial_bench.py --alerts
+ * compares it with the text protocol on the host build.
+ */
+
+// ─────────────────────────────────────────────────────────────────────
+// CONFIGURATION
+// ─────────────────────────────────────────────────────────────────────
+
+#define PAGER_WINDOW         8       // requests a host may have unacknowledged
+#define PAGER_SEEN           16      // results kept per seq slot, power of two >= 2 * PAGER_WINDOW
+#define PAGER_SACK_MAX       16      // (seq, result) pairs per SACK frame
+#define PAGER_FRAME_MAX      (SERIAL_FRAME_MAX - 2)   // decoded bytes (COBS adds <= 2 here)
+
+static_assert((PAGER_SEEN & (PAGER_SEEN - 1)) == 0 && PAGER_SEEN >= 2 * PAGER_WINDOW,
+              "a seq must not be reused while it can still be resent");
+
+enum PagerFrameType : uint8_t {
+  PF_PING = 1,
+  PF_STATUS,
+  PF_ALERT,
+  PF_ACK,
+  PF_STANDBY,
+  PF_HELLO,            // new session: forget handled seqs
+  PF_SACK = 0x80       // device -> host
+};
+
+enum PagerResult : uint8_t {
+  PR_OK,               // alert raised, standby done
+  PR_DUPLICATE,        // same source + priority inside the dedupe window
+  PR_READY,            // ping
+  PR_STANDBY,          // status: no active alert
+  PR_ALERT,            // status: alert active
+  PR_ACKED,
+  PR_BAD_REQUEST,      // unknown type or malformed payload
+  PR_COUNT
+};
+
+const char* const PAGER_RESULT_NAMES[PR_COUNT] = {
+  "ok", "duplicate", "ready", "standby", "alert", "acked", "bad request",
+};
+
+struct PagerFrameStats {
+  uint32_t frames;          // decoded with a good CRC
+  uint32_t crcErrors;       // bad CRC, bad COBS or too short
+  uint32_t resent;          // seq already handled - result sent again
+  uint32_t badRequests;
+  uint32_t sacks;
+  uint8_t maxPerSack;
+  uint32_t resultCounts[PR_COUNT];
+};
+
+PagerFrameStats pagerFrameStats;
+
+// Result of the last request in each seq slot (seq & (PAGER_SEEN - 1))
+uint8_t pagerSeenSeq[PAGER_SEEN];
+uint8_t pagerSeenResult[PAGER_SEEN];
+bool pagerSeenValid[PAGER_SEEN];
+
+uint8_t pagerSack[2 * PAGER_SACK_MAX];   // pending (seq, result) pairs
+uint8_t pagerSackCount = 0;
+
+// ─────────────────────────────────────────────────────────────────────
+// CRC + COBS
+// ─────────────────────────────────────────────────────────────────────
+
+// CRC-16/CCITT-FALSE (poly 0x1021, init 0xFFFF), a nibble at a time
+const uint16_t PAGER_CRC_NIBBLE[16] = {
+  0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+  0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF,
+};
+
+uint16_t pagerCrc16(const uint8_t* p, size_t n) {
+  uint16_t crc = 0xFFFF;
+  while (n--) {
+    crc = (crc << 4) ^ PAGER_CRC_NIBBLE[(crc >> 12) ^ (*p >> 4)];
+    crc = (crc << 4) ^ PAGER_CRC_NIBBLE[(crc >> 12) ^ (*p++ & 0x0F)];
+  }
+  return crc;
+}
+
+// In place - the output never runs ahead of the input. Decoded length,
+// or -1 if a code byte points past the end
+int cobsDecode(uint8_t* p, size_t n) {
+  size_t in = 0, out = 0;
+  while (in < n) {
+    uint8_t code = p[in++];
+    if (!code || in + code - 1 > n) return -1;
+    for (uint8_t i = 1; i < code; i++) p[out++] = p[in++];
+    if (code != 0xFF && in < n) p[out++] = 0;
+  }
+  return (int)out;
+}
+
+// dst needs n + n / 254 + 1 bytes
+size_t cobsEncode(const uint8_t* src, size_t n, uint8_t* dst) {
+  size_t code = 0, out = 1;
+  uint8_t run = 1;
+  for (size_t i = 0; i < n; i++) {
+    if (src[i]) {
+      dst[out++] = src[i];
+      run++;
+    }
+    if (!src[i] || run == 0xFF) {
+      dst[code] = run;
+      code = out++;
+      run = 1;
+    }
+  }
+  dst[code] = run;
+  return out;
+}
+
+// ─────────────────────────────────────────────────────────────────────
+// REQUESTS
+// ─────────────────────────────────────────────────────────────────────
+
+// source \0 priority \0 message
+PagerResult pagerRunAlert(const uint8_t* p, size_t n) {
+  const char* s = (const char*)p;
+  const char* sourceEnd = (const char*)memchr(s, 0, n);
+  if (!sourceEnd || sourceEnd == s) return PR_BAD_REQUEST;
+  const char* prio = sourceEnd + 1;
+  const char* prioEnd = (const char*)memchr(prio, 0, s + n - prio);
+  if (!prioEnd) return PR_BAD_REQUEST;
+  StrView message(prioEnd + 1, s + n - prioEnd - 1);
+  return raiseAlert(StrView(s, sourceEnd - s), StrView(prio, prioEnd - prio), message) ? PR_OK : PR_DUPLICATE;
+}
+
+PagerResult pagerRun(uint8_t type, const uint8_t* p, size_t n) {
+  switch (type) {
+    case PF_PING:    return PR_READY;
+    case PF_STATUS:  return hasActiveAlert ? PR_ALERT : PR_STANDBY;
+    case PF_ALERT:   return pagerRunAlert(p, n);
+    case PF_ACK:     acknowledgeAlert(); return PR_ACKED;
+    case PF_STANDBY: clearAlert(); return PR_OK;
+    case PF_HELLO:   return PR_READY;
+    default:         return PR_BAD_REQUEST;
+  }
+}
+
+// ─────────────────────────────────────────────────────────────────────
+// FRAMES IN / SACKS OUT
+// ─────────────────────────────────────────────────────────────────────
+
+void pagerSendSack() {
+  if (!pagerSackCount) return;
+  uint8_t raw[2 + 2 * PAGER_SACK_MAX + 2];
+  uint8_t enc[sizeof(raw) + sizeof(raw) / 254 + 3];
+  size_t n = 0;
+  raw[n++] = PF_SACK;
+  raw[n++] = pagerSackCount;
+  memcpy(raw + n, pagerSack, 2 * pagerSackCount);
+  n += 2 * pagerSackCount;
+  uint16_t crc = pagerCrc16(raw, n);
+  raw[n++] = crc & 0xFF;
+  raw[n++] = crc >> 8;
+  enc[0] = 0;
+  size_t len = 1 + cobsEncode(raw, n, enc + 1);
+  enc[len++] = 0;
+  Serial.write(enc, len);
+
+  pagerFrameStats.sacks++;
+  if (pagerSackCount > pagerFrameStats.maxPerSack) pagerFrameStats.maxPerSack = pagerSackCount;
+  pagerSackCount = 0;
+}
+
+// serial_cmd.h frame handler: `frame` is still COBS-encoded
+void pagerFrameReceive(uint8_t* frame, size_t len) {
+  int n = cobsDecode(frame, len);
+  if (n < 4 || n > PAGER_FRAME_MAX || pagerCrc16(frame, n - 2) != (frame[n - 2] | frame[n - 1] << 8)) {
+    pagerFrameStats.crcErrors++;
+    return;
+  }
+  pagerFrameStats.frames++;
+  uint8_t type = frame[0], seq = frame[1];
+  uint8_t slot = seq & (PAGER_SEEN - 1);
+
+  if (type == PF_HELLO) memset(pagerSeenValid, 0, sizeof(pagerSeenValid));
+
+  uint8_t result;
+  if (pagerSeenValid[slot] && pagerSeenSeq[slot] == seq) {
+    result = pagerSeenResult[slot];      // resent after a lost SACK - don't run twice
+    pagerFrameStats.resent++;
+  } else {
+    result = pagerRun(type, frame + 2, n - 4);
+    pagerSeenSeq[slot] = seq;
+    pagerSeenResult[slot] = result;
+    pagerSeenValid[slot] = true;
+    if (result == PR_BAD_REQUEST) pagerFrameStats.badRequests++;
+    pagerFrameStats.resultCounts[result]++;
+  }
+
+  pagerSack[2 * pagerSackCount] = seq;
+  pagerSack[2 * pagerSackCount + 1] = result;
+  if (++pagerSackCount == PAGER_SACK_MAX) pagerSendSack();
+}
+
+void initPagerFrames() {
+  serialFrameInit(pagerFrameReceive, pagerSendSack);
+}
+
+// ─────────────────────────────────────────────────────────────────────
+// REPORT
+// ─────────────────────────────────────────────────────────────────────
+
+void resetPagerFrameStats() {
+  memset(&pagerFrameStats, 0, sizeof(pagerFrameStats));
+}
+
+void printPagerFrameReport() {
+  const PagerFrameStats& s = pagerFrameStats;
+  Serial.println("\n━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━");
+  Serial.println("   PAGER FRAMES");
+  Serial.println("━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━");
+  Serial.printf("   %-14s%u good, %u bad CRC/COBS, %u resent, %u bad requests\n", "Frames:",
+                s.frames, s.crcErrors, s.resent, s.badRequests);
+  Serial.printf("   %-14s%u sent, up to %u results each (max %u)\n", "SACKs:",
+                s.sacks, s.maxPerSack, PAGER_SACK_MAX);
+  Serial.printf("   %-14s", "Results:");
+  for (int i = 0; i < PR_COUNT; i++) {
+    if (s.resultCounts[i]) Serial.printf("%s %u  ", PAGER_RESULT_NAMES[i], s.resultCounts[i]);
+  }
+  Serial.println();
+  Serial.printf("   %-14swindow %u, %u B max frame\n", "Protocol:", PAGER_WINDOW, PAGER_FRAME_MAX);
+  Serial.println("━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━\n");
+}
+
+#endif // PAGER_FRAME_H
@@ -17,6 +17,7 @@
 
 #include <esp_system.h>
 #include <esp_heap_caps.h>
+#include "fixed_string.h"
 
 // ─────────────────────────────────────────────────────────────────────
 // PERFORMANCE METRICS
@@ -158,9 +159,10 @@ uint8_t getHeapUsagePercent() {
   return ((perfMetrics.heapSize - perfMetrics.freeHeap) * 100) / perfMetrics.heapSize;
 }
 
-String getHeapUsageString() {
+// "137/320KB" into buf (16 bytes is plenty); returns buf
+char* formatHeapUsage(char* buf, size_t size) {
   uint32_t used = perfMetrics.heapSize - perfMetrics.freeHeap;
-  return String(used / 1024) + "/" + String(perfMetrics.heapSize / 1024) + "KB";
+  return strfmt(buf, size, "%u/%uKB", (unsigned)(used / 1024), (unsigned)(perfMetrics.heapSize / 1024));
 }
 
 // ─────────────────────────────────────────────────────────────────────
@@ -171,20 +173,21 @@ float getCPUFrequencyMHz() {
   return getCpuFrequencyMhz();
 }
 
-String getUptimeString() {
+// "2d 3h" / "3h 12m" / "12m 5s" / "5s" into buf (16 bytes); returns buf
+char* formatUptime(char* buf, size_t size) {
   uint32_t seconds = perfMetrics.uptimeSeconds;
   uint32_t minutes = seconds / 60;
   uint32_t hours = minutes / 60;
   uint32_t days = hours / 24;
 
   if (days > 0) {
-    return String(days) + "d " + String(hours % 24) + "h";
+    return strfmt(buf, size, "%ud %uh", (unsigned)days, (unsigned)(hours % 24));
   } else if (hours > 0) {
-    return String(hours) + "h " + String(minutes % 60) + "m";
+    return strfmt(buf, size, "%uh %um", (unsigned)hours, (unsigned)(minutes % 60));
   } else if (minutes > 0) {
-    return String(minutes) + "m " + String(seconds % 60) + "s";
+    return strfmt(buf, size, "%um %us", (unsigned)minutes, (unsigned)(seconds % 60));
   } else {
-    return String(seconds) + "s";
+    return strfmt(buf, size, "%us", (unsigned)seconds);
   }
 }
 
@@ -192,7 +195,7 @@ String getUptimeString() {
 // WIFI HELPERS
 // ─────────────────────────────────────────────────────────────────────
 
-String getWiFiQualityString() {
+const char* getWiFiQualityString() {
   if (perfMetrics.wifiQuality >= 80) return "Excellent";
   if (perfMetrics.wifiQuality >= 60) return "Good";
   if (perfMetrics.wifiQuality >= 40) return "Fair";
@@ -211,7 +214,7 @@ uint16_t getWiFiQualityColor() {
 // REBOOT REASON DECODER
 // ─────────────────────────────────────────────────────────────────────
 
-String getRebootReasonString() {
+const char* getRebootReasonString() {
   switch (perfMetrics.lastRebootReason) {
     case ESP_RST_POWERON: return "Power On";
     case ESP_RST_SW: return "Software Reset";
@@ -276,17 +279,19 @@ void printDiagnosticReport() {
   Serial.printf("║   RSSI:       %6d dBm                ║\n", perfMetrics.rssi);
   Serial.printf("║   Quality:    %6d%% (%s)%*s║\n",
     perfMetrics.wifiQuality,
-    getWiFiQualityString().c_str(),
-    9 - getWiFiQualityString().length(), "");
+    getWiFiQualityString(),
+    9 - (int)strlen(getWiFiQualityString()), "");
 
   // System
+  char uptime[16];
+  formatUptime(uptime, sizeof(uptime));
   Serial.println("║ SYSTEM                                 ║");
   Serial.printf("║   Uptime:     %s%*s║\n",
-    getUptimeString().c_str(),
-    25 - getUptimeString().length(), "");
+    uptime,
+    25 - (int)strlen(uptime), "");
   Serial.printf("║   Last Boot:  %s%*s║\n",
-    getRebootReasonString().c_str(),
-    24 - getRebootReasonString().length(), "");
+    getRebootReasonString(),
+    24 - (int)strlen(getRebootReasonString()), "");
 
   // Warnings
   Serial.println("║ WARNINGS                               ║");
@@ -0,0 +1,309 @@
+#ifndef POWER_IDLE_H
+#define POWER_IDLE_H
+
+/*
+ * ═══════════════════════════════════════════════════════════════════════
+ * BLACKROAD POWER IDLE - clock scaling + light sleep between events
+ * ═══════════════════════════════════════════════════════════════════════
+ *
+ * loopIdle() (app_tasks.h) hands its wait to powerIdleWait(), which
+ * applies one of three policies (IDLE OFF / DFS / SLEEP):
+ *
+ *   OFF    stay at POWER_ACTIVE_MHZ, wait on a task notification
+ *   DFS    after POWER_DFS_DELAY_MS without work drop to POWER_IDLE_MHZ,
+ *          back up on the first event, full redraw or net request
+ *   SLEEP  DFS, and once quiet for POWER_SLEEP_DELAY_MS wait in
+ *          esp_light_sleep_start() instead of a notification
+ *
+ * Light sleep wakes on PENIRQ (GPIO36 low), UART0 RX edges and the next
+ * deadline, and never lasts longer than POWER_MAX_SLEEP_MS: anything that
+ * cannot wake the chip (WiFi traffic buffered at the AP) waits at most
+ * that long, and so does a pager ALERT in the worst case. The UART edges
+ * that wake the chip are not received, so with SLEEP the pager bridge has
+ * to lead with a newline (or resend an ALERT that got no OK). DFS is the
+ * default for that reason.
+ *
+ * The net task holds the clock up while a request (TLS) is in flight,
+ * and nothing light-sleeps with a feedback pattern playing (LEDC stops),
+ * the pen down or a hold taken.
+ *
+ * IDLE prints time per clock/state, modeled average current and
+ * wake -> ready latency (wake until the loop() pass that handled it ends)
+ * per wake source. POWER_LIGHT_SLEEP=0 (host build) models the sleeps
+ * with delay() so the policy and the report still run.
+ */
+
+#include <atomic>
+
+// ─────────────────────────────────────────────────────────────────────
+// CONFIGURATION
+// ─────────────────────────────────────────────────────────────────────
+
+#ifndef POWER_LIGHT_SLEEP
+#ifdef HOST_BUILD
+#define POWER_LIGHT_SLEEP 0
+#else
+#define POWER_LIGHT_SLEEP 1
+#endif
+#endif
+
+#if POWER_LIGHT_SLEEP
+#include <esp_sleep.h>
+#include <driver/gpio.h>
+#include <driver/uart.h>
+#endif
+
+#define POWER_ACTIVE_MHZ        240
+#define POWER_IDLE_MHZ          80       // lowest clock WiFi runs at
+#define POWER_DFS_DELAY_MS      500
+#define POWER_SLEEP_DELAY_MS    2000
+#define POWER_MIN_SLEEP_MS      5        // shorter waits are not worth the wake-up
+#define POWER_MAX_SLEEP_MS      250      // pager / WiFi latency bound
+#define POWER_UART_WAKE_EDGES   3
+
+// Current model: ESP32 datasheet, WiFi modem sleep, CPU running vs idle
+// (waiti). Display and backlight are not included.
+#define POWER_MA_RUN_ACTIVE     68.0f
+#define POWER_MA_WAIT_ACTIVE    30.0f
+#define POWER_MA_RUN_IDLE       31.0f
+#define POWER_MA_WAIT_IDLE      20.0f
+#define POWER_MA_LIGHT_SLEEP    0.8f
+
+// ─────────────────────────────────────────────────────────────────────
+// STATE + STATS
+// ─────────────────────────────────────────────────────────────────────
+
+enum PowerPolicy : uint8_t {
+  POWER_OFF,
+  POWER_DFS,
+  POWER_SLEEP
+};
+
+enum PowerWakeSource : uint8_t {
+  WAKE_TOUCH,
+  WAKE_SERIAL,
+  WAKE_NET,
+  WAKE_DEADLINE,
+  WAKE_SOURCES
+};
+
+const char* const POWER_POLICY_NAMES[] = { "OFF", "DFS", "SLEEP" };
+const char* const POWER_WAKE_NAMES[WAKE_SOURCES] = { "touch", "serial", "net", "deadline" };
+
+// Written by loop()
+struct PowerStats {
+  uint64_t runUs[2];         // [0] active clock, [1] idle clock
+  uint64_t waitUs[2];
+  uint64_t sleepUs;
+  uint32_t sleeps;           // light sleeps
+  uint32_t maxSleepUs;
+  uint32_t switches;         // clock changes
+  uint32_t switchSumUs;
+  uint32_t maxSwitchUs;
+  uint32_t wakes[WAKE_SOURCES];
+  uint32_t wakeSumUs[WAKE_SOURCES];
+  uint32_t wakeMaxUs[WAKE_SOURCES];
+};
+
+PowerPolicy powerPolicy = POWER_DFS;
+PowerStats powerStats;
+std::atomic<uint8_t> powerHolds(0);   // net task: request in flight
+uint32_t powerMhz = POWER_ACTIVE_MHZ;
+uint32_t powerMarkUs = 0;             // end of the last accounted interval
+uint32_t powerLastWorkUs = 0;
+uint32_t powerWakeUs = 0;
+int8_t powerWakeSource = -1;          // wake waiting for its loop() pass to end
+
+// ─────────────────────────────────────────────────────────────────────
+// CLOCK
+// ─────────────────────────────────────────────────────────────────────
+
+inline uint8_t powerClockIndex() {
+  return powerMhz == POWER_ACTIVE_MHZ ? 0 : 1;
+}
+
+// Close the running interval at the current clock
+void powerAccountRun(uint32_t now) {
+  powerStats.runUs[powerClockIndex()] += now - powerMarkUs;
+  powerMarkUs = now;
+}
+
+void powerSetClock(uint32_t mhz) {
+  if (mhz == powerMhz) return;
+  uint32_t t0 = micros();
+  powerAccountRun(t0);
+  setCpuFrequencyMhz(mhz);
+  powerMhz = mhz;
+  uint32_t us = micros() - t0;
+  powerStats.switches++;
+  powerStats.switchSumUs += us;
+  if (us > powerStats.maxSwitchUs) powerStats.maxSwitchUs = us;
+}
+
+// Work is coming (loop() only): input, full redraw, net request
+void powerBoost() {
+  powerLastWorkUs = micros();
+  powerSetClock(POWER_ACTIVE_MHZ);
+}
+
+// Net task, around a request: keeps the clock up and the chip awake
+void powerHold() {
+  powerHolds.fetch_add(1);
+}
+
+void powerRelease() {
+  powerHolds.fetch_sub(1);
+}
+
+bool powerQuietFor(uint32_t ms, uint32_t now) {
+  return powerHolds.load() == 0 && now - powerLastWorkUs >= ms * 1000UL;
+}
+
+// ─────────────────────────────────────────────────────────────────────
+// WAITING
+// ─────────────────────────────────────────────────────────────────────
+
+bool powerCanLightSleep(uint32_t now) {
+  return powerPolicy == POWER_SLEEP && powerQuietFor(POWER_SLEEP_DELAY_MS, now) &&
+         !feedbackPlaying() && !touchDown && !touchPenPeriod;
+}
+
+// Light sleep up to `us`; LOOP_WAKE_* bits for what ended it
+uint32_t powerLightSleep(uint32_t us) {
+#if POWER_LIGHT_SLEEP
+  Serial.flush();   // TX stops in light sleep
+  esp_sleep_enable_timer_wakeup(us);
+  gpio_wakeup_enable((gpio_num_t)XPT2046_IRQ, GPIO_INTR_LOW_LEVEL);
+  esp_light_sleep_start();
+  gpio_wakeup_disable((gpio_num_t)XPT2046_IRQ);
+  gpio_set_intr_type((gpio_num_t)XPT2046_IRQ, GPIO_INTR_NEGEDGE);   // attachInterrupt()'s edge
+
+  switch (esp_sleep_get_wakeup_cause()) {
+    case ESP_SLEEP_WAKEUP_GPIO:
+      touchWakeKick();   // the falling edge happened while asleep
+      return LOOP_WAKE_TOUCH;
+    case ESP_SLEEP_WAKEUP_UART:
+      return LOOP_WAKE_SERIAL;
+    default:
+      return 0;
+  }
+#elif APP_TASKS
+  vTaskDelay(pdMS_TO_TICKS((us + 999) / 1000));
+  return 0;
+#else
+  delay((us + 999) / 1000);
+  return 0;
+#endif
+}
+
+// Task notification / plain delay up to `us`; LOOP_WAKE_* bits
+uint32_t powerNotifyWait(uint32_t us) {
+  uint32_t ms = (us + 999) / 1000;
+#if APP_TASKS
+  uint32_t bits = 0;
+  xTaskNotifyWait(0, 0xFFFFFFFF, &bits, pdMS_TO_TICKS(ms));
+  return bits;
+#else
+  // Virtual time only moves while the firmware waits - always wait a bit
+  delay(ms ? ms : 1);
+  return 0;
+#endif
+}
+
+// loopIdle(): wait up to `us` for the next event; LOOP_WAKE_* bits, 0 at
+// the deadline
+uint32_t powerIdleWait(uint32_t us) {
+  uint32_t now = micros();
+  if (powerPolicy != POWER_OFF && powerQuietFor(POWER_DFS_DELAY_MS, now)) powerSetClock(POWER_IDLE_MHZ);
+
+  now = micros();
+  powerAccountRun(now);
+  bool light = us >= POWER_MIN_SLEEP_MS * 1000UL && powerCanLightSleep(now);
+  if (light && us > POWER_MAX_SLEEP_MS * 1000UL) us = POWER_MAX_SLEEP_MS * 1000UL;
+  uint32_t bits = light ? powerLightSleep(us) : powerNotifyWait(us);
+
+  powerWakeUs = micros();
+  uint32_t slept = powerWakeUs - now;
+  if (light) {
+    powerStats.sleeps++;
+    powerStats.sleepUs += slept;
+    if (slept > powerStats.maxSleepUs) powerStats.maxSleepUs = slept;
+  } else {
+    powerStats.waitUs[powerClockIndex()] += slept;
+  }
+  powerMarkUs = powerWakeUs;
+
+  if (bits & LOOP_WAKE_TOUCH) powerWakeSource = WAKE_TOUCH;
+  else if (bits & LOOP_WAKE_SERIAL) powerWakeSource = WAKE_SERIAL;
+  else if (bits & LOOP_WAKE_NET) powerWakeSource = WAKE_NET;
+  else powerWakeSource = WAKE_DEADLINE;
+  if (bits) powerBoost();
+  return bits;
+}
+
+// End of a loop() pass (uiFrameDone): closes the wake that started it
+void powerFrameDone() {
+  if (powerWakeSource < 0) return;
+  uint32_t us = micros() - powerWakeUs;
+  uint8_t s = powerWakeSource;
+  powerWakeSource = -1;
+  powerStats.wakes[s]++;
+  powerStats.wakeSumUs[s] += us;
+  if (us > powerStats.wakeMaxUs[s]) powerStats.wakeMaxUs[s] = us;
+}
+
+// ─────────────────────────────────────────────────────────────────────
+// SETUP + REPORT
+// ─────────────────────────────────────────────────────────────────────
+
+void resetPowerStats() {
+  memset(&powerStats, 0, sizeof(powerStats));
+  powerMarkUs = micros();
+}
+
+void initPowerIdle() {
+  resetPowerStats();
+  powerLastWorkUs = micros();
+#if POWER_LIGHT_SLEEP
+  esp_sleep_enable_gpio_wakeup();
+  uart_set_wakeup_threshold(UART_NUM_0, POWER_UART_WAKE_EDGES);
+  esp_sleep_enable_uart_wakeup(UART_NUM_0);
+#endif
+}
+
+void setPowerPolicy(PowerPolicy policy) {
+  powerPolicy = policy;
+  if (policy == POWER_OFF) powerBoost();
+}
+
+void printPowerReport() {
+  const PowerStats& p = powerStats;
+  powerAccountRun(micros());
+  float total = (float)(p.runUs[0] + p.runUs[1] + p.waitUs[0] + p.waitUs[1] + p.sleepUs);
+  if (total <= 0) total = 1;
+  float mA = (p.runUs[0] * POWER_MA_RUN_ACTIVE + p.waitUs[0] * POWER_MA_WAIT_ACTIVE +
+              p.runUs[1] * POWER_MA_RUN_IDLE + p.waitUs[1] * POWER_MA_WAIT_IDLE +
+              p.sleepUs * POWER_MA_LIGHT_SLEEP) / total;
+
+  Serial.println("\n━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━");
+  Serial.printf("   POWER IDLE (policy %s)\n", POWER_POLICY_NAMES[powerPolicy]);
+  Serial.println("━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━");
+  Serial.printf("   Clock:        %u MHz now (%d active / %d idle), %u switches, %u us avg, %u us max\n",
+                powerMhz, POWER_ACTIVE_MHZ, POWER_IDLE_MHZ, p.switches,
+                p.switches ? p.switchSumUs / p.switches : 0, p.maxSwitchUs);
+  Serial.printf("   %d MHz:      %.1f%% running, %.1f%% waiting\n", POWER_ACTIVE_MHZ,
+                100.0f * p.runUs[0] / total, 100.0f * p.waitUs[0] / total);
+  Serial.printf("   %d MHz:       %.1f%% running, %.1f%% waiting\n", POWER_IDLE_MHZ,
+                100.0f * p.runUs[1] / total, 100.0f * p.waitUs[1] / total);
+  Serial.printf("   Light sleep:  %.1f%%, %u sleeps, longest %u ms (cap %d ms)\n",
+                100.0f * p.sleepUs / total, p.sleeps, p.maxSleepUs / 1000, POWER_MAX_SLEEP_MS);
+  Serial.printf("   Model:        %.1f mA avg over %.0f s (datasheet, no display)\n", mA, total / 1e6f);
+  Serial.println("   Wake -> ready (wake until that loop() pass ends):");
+  for (int s = 0; s < WAKE_SOURCES; s++) {
+    Serial.printf("     %-10s %6u wakes, %6u us avg, %6u us max\n", POWER_WAKE_NAMES[s], p.wakes[s],
+                  p.wakes[s] ? p.wakeSumUs[s] / p.wakes[s] : 0, p.wakeMaxUs[s]);
+  }
+  Serial.println("━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━\n");
+}
+
+#endif // POWER_IDLE_H
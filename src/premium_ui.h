@@ -16,6 +16,7 @@
  */
 
 #include <TFT_eSPI.h>
+#include "render_profiler.h"   // RenderTFT: calls on the panel are profiled per site
 
 // ─────────────────────────────────────────────────────────────────────
 // COLOR UTILITIES
@@ -64,7 +65,7 @@ uint16_t lightenColor(uint16_t color, uint8_t percent) {
 // ─────────────────────────────────────────────────────────────────────
 
 // Draw vertical gradient (top to bottom)
-void drawVerticalGradient(TFT_eSPI &tft, int x, int y, int w, int h,
+void drawVerticalGradient(RenderTFT& tft, int x, int y, int w, int h,
                           uint16_t colorTop, uint16_t colorBottom) {
   for (int i = 0; i < h; i++) {
     uint16_t color = blendColor(colorBottom, colorTop, (i * 255) / h);
@@ -73,7 +74,7 @@ void drawVerticalGradient(TFT_eSPI &tft, int x, int y, int w, int h,
 }
 
 // Draw radial gradient (center glow)
-void drawRadialGlow(TFT_eSPI &tft, int cx, int cy, int radius, uint16_t color) {
+void drawRadialGlow(RenderTFT& tft, int cx, int cy, int radius, uint16_t color) {
   for (int r = radius; r > 0; r -= 2) {
     uint8_t alpha = (r * 60) / radius;  // Fade from center
     uint16_t glowColor = blendColor(color, COLOR_BLACK, alpha);
@@ -82,7 +83,7 @@ void drawRadialGlow(TFT_eSPI &tft, int cx, int cy, int radius, uint16_t color) {
 }
 
 // Premium screen background with subtle gradient
-void drawPremiumBackground(TFT_eSPI &tft) {
+void drawPremiumBackground(RenderTFT& tft) {
   // Dark gradient from top (slightly lighter) to bottom (pure black)
   uint16_t topColor = 0x0841;  // Very dark gray
   drawVerticalGradient(tft, 0, 0, 240, 320, topColor, COLOR_BLACK);
@@ -93,7 +94,7 @@ void drawPremiumBackground(TFT_eSPI &tft) {
 // ─────────────────────────────────────────────────────────────────────
 
 // Draw soft glow circle (for icons)
-void drawIconGlow(TFT_eSPI &tft, int cx, int cy, int radius, uint16_t color) {
+void drawIconGlow(RenderTFT& tft, int cx, int cy, int radius, uint16_t color) {
   // Outer glow rings (3 layers)
   for (int i = 3; i >= 1; i--) {
     uint16_t glowColor = darkenColor(color, 60 + (i * 10));
@@ -102,7 +103,7 @@ void drawIconGlow(TFT_eSPI &tft, int cx, int cy, int radius, uint16_t color) {
 }
 
 // Draw pulsing glow effect (call with millis() for animation)
-void drawPulsingGlow(TFT_eSPI &tft, int cx, int cy, int baseRadius,
+void drawPulsingGlow(RenderTFT& tft, int cx, int cy, int baseRadius,
                      uint16_t color, unsigned long time) {
   // Pulse between 0.9x and 1.1x radius
   float pulse = 1.0 + 0.1 * sin(time / 300.0);
@@ -121,7 +122,7 @@ void drawPulsingGlow(TFT_eSPI &tft, int cx, int cy, int baseRadius,
 // ─────────────────────────────────────────────────────────────────────
 
 // Draw frosted glass card with border glow
-void drawGlassCard(TFT_eSPI &tft, int x, int y, int w, int h,
+void drawGlassCard(RenderTFT& tft, int x, int y, int w, int h,
                    uint16_t accentColor) {
   // Outer glow (2px)
   uint16_t glowColor = darkenColor(accentColor, 70);
@@ -143,7 +144,7 @@ void drawGlassCard(TFT_eSPI &tft, int x, int y, int w, int h,
 }
 
 // Premium card with gradient fill
-void drawPremiumCard(TFT_eSPI &tft, int x, int y, int w, int h,
+void drawPremiumCard(RenderTFT& tft, int x, int y, int w, int h,
                      uint16_t color, bool selected = false) {
   // Shadow layers (depth effect)
   tft.fillRoundRect(x + 4, y + 4, w, h, 8, 0x0000);  // Deep shadow
@@ -183,7 +184,7 @@ void drawPremiumCard(TFT_eSPI &tft, int x, int y, int w, int h,
 // ─────────────────────────────────────────────────────────────────────
 
 // Draw premium app icon with glow and gradient
-void drawPremiumAppIcon(TFT_eSPI &tft, int cx, int cy, int radius,
+void drawPremiumAppIcon(RenderTFT& tft, int cx, int cy, int radius,
                         uint16_t color, const char* label, int badge = 0,
                         bool pressed = false) {
   // Glow effect (behind icon)
@@ -250,7 +251,7 @@ void drawPremiumAppIcon(TFT_eSPI &tft, int cx, int cy, int radius,
 // ─────────────────────────────────────────────────────────────────────
 
 // Draw animated lock screen with premium effects
-void drawPremiumLockScreen(TFT_eSPI &tft, unsigned long time,
+void drawPremiumLockScreen(RenderTFT& tft, unsigned long time,
                            const char* timeStr, const char* dateStr) {
   // Background gradient (dark blue to black)
   uint16_t topColor = 0x0010;  // Very dark blue
@@ -329,7 +330,7 @@ void drawPremiumLockScreen(TFT_eSPI &tft, unsigned long time,
 // PREMIUM STATUS BAR
 // ─────────────────────────────────────────────────────────────────────
 
-void drawPremiumStatusBar(TFT_eSPI &tft, bool wifiConnected,
+void drawPremiumStatusBar(RenderTFT& tft, bool wifiConnected,
                           const char* timeStr, int batteryPercent) {
   // Gradient background
   drawVerticalGradient(tft, 0, 0, 240, 22, 0x1082, 0x0841);
@@ -375,7 +376,7 @@ void drawPremiumStatusBar(TFT_eSPI &tft, bool wifiConnected,
 // PREMIUM BOTTOM NAV
 // ─────────────────────────────────────────────────────────────────────
 
-void drawPremiumBottomNav(TFT_eSPI &tft, int activeIndex = 0) {
+void drawPremiumBottomNav(RenderTFT& tft, int activeIndex = 0) {
   // Background with gradient
   drawVerticalGradient(tft, 0, 270, 240, 50, 0x0841, 0x1082);
 
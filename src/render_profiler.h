@@ -0,0 +1,389 @@
+#ifndef RENDER_PROFILER_H
+#define RENDER_PROFILER_H
+
+/*
+ * ═══════════════════════════════════════════════════════════════════════
+ * BLACKROAD RENDER PROFILER
+ * ═══════════════════════════════════════════════════════════════════════
+ *
+ * ProfiledTFT is a drop-in TFT_eSPI that accounts for every draw:
+ *   - primitive calls   (one per outermost call - fillRoundRect counts
+ *                        once even though it issues many fillRects)
+ *   - pixels written    (counted at the leaf primitives)
+ *   - SPI bytes         (modeled: 11 bytes of CASET/RASET/RAMWR window
+ *                        setup per leaf write + 2 bytes per RGB565 pixel)
+ *   - wall time         (per full screen draw)
+ *
+ * Counts are kept per screen and per call site (caller PC). Everything
+ * except wall time is a pure function of what was drawn, so a host build
+ * produces identical numbers - the RENDER table is ranked by modeled SPI
+ * cost for that reason.
+ *
+ * Only calls made on a RenderTFT see the wrapper's overloads. Through a
+ * TFT_eSPI& or TFT_eSPI* (BlackRoadFont, BlackRoadUI, layout.h and
+ * home_cache.h, which also draw into sprites) just the virtual leaf
+ * primitives are caught: pixels and SPI bytes are still right, but each
+ * leaf counts as a primitive and its site is a PC inside TFT_eSPI.
+ *
+ * Build with -DRENDER_PROFILER=0 to fall back to a plain TFT_eSPI.
+ */
+
+#include <TFT_eSPI.h>
+#include "input_latency.h"    // pixel stamps for touch-to-photon traces
+
+#ifndef RENDER_PROFILER
+#define RENDER_PROFILER 1
+#endif
+
+#ifndef SPI_FREQUENCY
+#define SPI_FREQUENCY 40000000
+#endif
+
+#define RENDER_PROF_MAX_SCREENS  32
+#ifndef RENDER_PROF_MAX_SITES
+#define RENDER_PROF_MAX_SITES    128  // ~1000 (pc, screen) sites exist; the heavy ones are kept
+#endif
+#define RENDER_PROF_PROBE        8    // slots searched before evicting the lightest
+#define RENDER_PROF_TOP_SITES    15
+#define RENDER_SPI_WINDOW_BYTES  11   // CASET(1+4) + RASET(1+4) + RAMWR(1)
+
+// ─────────────────────────────────────────────────────────────────────
+// COUNTERS
+// ─────────────────────────────────────────────────────────────────────
+
+struct RenderCounters {
+  uint32_t prims;
+  uint32_t pixels;
+  uint32_t spiBytes;
+};
+
+struct ScreenRenderStats {
+  uint32_t draws;         // full screen draws (drawCurrentScreen)
+  uint32_t wallUs;        // summed wall time of full draws
+  uint32_t maxWallUs;
+  RenderCounters total;   // everything drawn while this screen was active
+};
+
+struct RenderSite {
+  uintptr_t pc;           // 0 = empty slot
+  uint8_t screen;
+  RenderCounters c;
+};
+
+ScreenRenderStats screenRenderStats[RENDER_PROF_MAX_SCREENS];
+RenderSite renderSites[RENDER_PROF_MAX_SITES];
+uint32_t renderSiteEvicted = 0;    // calls counted at sites evicted for newer ones
+
+uint8_t renderProfScreen = 0;      // screen currently being drawn
+uint8_t renderProfDepth = 0;       // nesting depth inside ProfiledTFT
+RenderSite* renderProfSite = nullptr;
+unsigned long renderProfStartUs = 0;
+
+void resetRenderProfiler() {
+  memset(screenRenderStats, 0, sizeof(screenRenderStats));
+  memset(renderSites, 0, sizeof(renderSites));
+  renderSiteEvicted = 0;
+}
+
+// Every screen together draws from ~1000 sites, far more than the table.
+// A new site takes an empty slot near its hash, else the slot with the
+// least SPI so far; the heavy sites stay, only the ranking tail is lost
+RenderSite* renderSiteFor(uintptr_t pc, uint8_t screen) {
+  uint32_t h = (uint32_t)((pc >> 2) * 2654435761u) ^ screen;
+  RenderSite* victim = nullptr;
+  for (int probe = 0; probe < RENDER_PROF_PROBE; probe++) {
+    RenderSite& s = renderSites[(h + probe) % RENDER_PROF_MAX_SITES];
+    if (s.pc == pc && s.screen == screen) return &s;
+    if (s.pc == 0) {
+      s.pc = pc;
+      s.screen = screen;
+      return &s;
+    }
+    if (!victim || s.c.spiBytes < victim->c.spiBytes) victim = &s;
+  }
+  renderSiteEvicted += victim->c.prims;
+  memset(&victim->c, 0, sizeof(victim->c));
+  victim->pc = pc;
+  victim->screen = screen;
+  return victim;
+}
+
+// Full-screen draw bracket - wrap drawCurrentScreen()
+void renderProfBeginScreen(int screen) {
+  renderProfScreen = screen < RENDER_PROF_MAX_SCREENS ? screen : RENDER_PROF_MAX_SCREENS - 1;
+  renderProfStartUs = micros();
+  latencyDrawStart();
+}
+
+void renderProfEndScreen() {
+  uint32_t dt = micros() - renderProfStartUs;
+  ScreenRenderStats& s = screenRenderStats[renderProfScreen];
+  s.draws++;
+  s.wallUs += dt;
+  if (dt > s.maxWallUs) s.maxWallUs = dt;
+  latencyPixels();
+}
+
+// Modeled SPI transfer time for a byte count
+uint32_t renderSpiMicros(uint32_t bytes) {
+  return (uint32_t)((uint64_t)bytes * 8 * 1000000 / SPI_FREQUENCY);
+}
+
+#if RENDER_PROFILER
+
+// ─────────────────────────────────────────────────────────────────────
+// CALL SCOPE - outermost call counts the primitive and picks the site
+// ─────────────────────────────────────────────────────────────────────
+
+struct RenderScope {
+  explicit RenderScope(void* caller) {
+    if (renderProfDepth++ == 0) {
+      renderProfSite = renderSiteFor((uintptr_t)caller, renderProfScreen);
+      screenRenderStats[renderProfScreen].total.prims++;
+      if (renderProfSite) renderProfSite->c.prims++;
+    }
+  }
+  ~RenderScope() { renderProfDepth--; }
+};
+
+// Leaf write: one address window plus `pixels` RGB565 pixels
+void renderProfLeaf(uint32_t pixels, uint32_t windows = 1) {
+  uint32_t bytes = windows * RENDER_SPI_WINDOW_BYTES + pixels * 2;
+  RenderCounters& t = screenRenderStats[renderProfScreen].total;
+  t.pixels += pixels;
+  t.spiBytes += bytes;
+  if (renderProfSite) {
+    renderProfSite->c.pixels += pixels;
+    renderProfSite->c.spiBytes += bytes;
+  }
+  latencyPixels();
+}
+
+#define RENDER_CALLER __builtin_return_address(0)
+#define RENDER_NOINLINE __attribute__((noinline))
+
+// ─────────────────────────────────────────────────────────────────────
+// PROFILED DISPLAY
+// ─────────────────────────────────────────────────────────────────────
+
+class ProfiledTFT : public TFT_eSPI {
+public:
+  ProfiledTFT() : TFT_eSPI() {}
+
+  // Clipped area of a rectangle on the panel
+  uint32_t clippedArea(int32_t x, int32_t y, int32_t w, int32_t h) {
+    int32_t x1 = x + w, y1 = y + h;
+    if (x < 0) x = 0;
+    if (y < 0) y = 0;
+    if (x1 > width()) x1 = width();
+    if (y1 > height()) y1 = height();
+    return (x1 > x && y1 > y) ? (uint32_t)(x1 - x) * (y1 - y) : 0;
+  }
+
+  // ── Leaf primitives (virtual in TFT_eSPI, reached from everything) ──
+
+  RENDER_NOINLINE void drawPixel(int32_t x, int32_t y, uint32_t color) override {
+    RenderScope s(RENDER_CALLER);
+    TFT_eSPI::drawPixel(x, y, color);
+    renderProfLeaf(clippedArea(x, y, 1, 1));
+  }
+
+  RENDER_NOINLINE void drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color) override {
+    RenderScope s(RENDER_CALLER);
+    TFT_eSPI::drawFastHLine(x, y, w, color);
+    renderProfLeaf(clippedArea(x, y, w, 1));
+  }
+
+  RENDER_NOINLINE void drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color) override {
+    RenderScope s(RENDER_CALLER);
+    TFT_eSPI::drawFastVLine(x, y, h, color);
+    renderProfLeaf(clippedArea(x, y, 1, h));
+  }
+
+  RENDER_NOINLINE void fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) override {
+    RenderScope s(RENDER_CALLER);
+    TFT_eSPI::fillRect(x, y, w, h, color);
+    renderProfLeaf(clippedArea(x, y, w, h));
+  }
+
+  // Lines are drawn as runs of drawPixel/drawFastHLine/drawFastVLine,
+  // the leaves above count those - only the call site is taken here
+  RENDER_NOINLINE void drawLine(int32_t xs, int32_t ys, int32_t xe, int32_t ye, uint32_t color) override {
+    RenderScope s(RENDER_CALLER);
+    TFT_eSPI::drawLine(xs, ys, xe, ye, color);
+  }
+
+  // ── Glyphs: transparent or scaled text recurses into the leaves,
+  //    opaque text streams the whole cell - count the cell only then ──
+
+  RENDER_NOINLINE void drawChar(int32_t x, int32_t y, uint16_t c, uint32_t color, uint32_t bg, uint8_t size) override {
+    RenderScope s(RENDER_CALLER);
+    TFT_eSPI::drawChar(x, y, c, color, bg, size);
+    if (color != bg && size == 1) {
+      renderProfLeaf(clippedArea(x, y, 6, 8));
+    }
+  }
+
+  RENDER_NOINLINE int16_t drawChar(uint16_t uniCode, int32_t x, int32_t y, uint8_t font) override {
+    RenderScope s(RENDER_CALLER);
+    int16_t w = TFT_eSPI::drawChar(uniCode, x, y, font);
+    if (font != 1 && textcolor != textbgcolor) {   // font 1 goes via the GLCD drawChar
+      renderProfLeaf(clippedArea(x, y, w, fontHeight(font)));
+    }
+    return w;
+  }
+
+  RENDER_NOINLINE int16_t drawChar(uint16_t uniCode, int32_t x, int32_t y) override {
+    return drawChar(uniCode, x, y, textfont);
+  }
+
+  // ── Composite calls used by the screens. Non-virtual in TFT_eSPI, so
+  //    these hide the base versions to get one primitive per call and
+  //    the real call site; the leaves above still count the pixels. ──
+
+  RENDER_NOINLINE void fillScreen(uint32_t color) {
+    RenderScope s(RENDER_CALLER);
+    TFT_eSPI::fillScreen(color);
+  }
+
+  RENDER_NOINLINE void drawRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) {
+    RenderScope s(RENDER_CALLER);
+    TFT_eSPI::drawRect(x, y, w, h, color);
+  }
+
+  RENDER_NOINLINE void fillRoundRect(int32_t x, int32_t y, int32_t w, int32_t h, int32_t r, uint32_t color) {
+    RenderScope s(RENDER_CALLER);
+    TFT_eSPI::fillRoundRect(x, y, w, h, r, color);
+  }
+
+  RENDER_NOINLINE void drawRoundRect(int32_t x, int32_t y, int32_t w, int32_t h, int32_t r, uint32_t color) {
+    RenderScope s(RENDER_CALLER);
+    TFT_eSPI::drawRoundRect(x, y, w, h, r, color);
+  }
+
+  RENDER_NOINLINE void fillCircle(int32_t x, int32_t y, int32_t r, uint32_t color) {
+    RenderScope s(RENDER_CALLER);
+    TFT_eSPI::fillCircle(x, y, r, color);
+  }
+
+  RENDER_NOINLINE void drawCircle(int32_t x, int32_t y, int32_t r, uint32_t color) {
+    RenderScope s(RENDER_CALLER);
+    TFT_eSPI::drawCircle(x, y, r, color);
+  }
+
+  RENDER_NOINLINE int16_t drawString(const char* str, int32_t x, int32_t y, uint8_t font) {
+    RenderScope s(RENDER_CALLER);
+    return TFT_eSPI::drawString(str, x, y, font);
+  }
+
+  RENDER_NOINLINE int16_t drawString(const char* str, int32_t x, int32_t y) {
+    RenderScope s(RENDER_CALLER);
+    return TFT_eSPI::drawString(str, x, y);
+  }
+
+  RENDER_NOINLINE int16_t drawString(const String& str, int32_t x, int32_t y, uint8_t font) {
+    RenderScope s(RENDER_CALLER);
+    return TFT_eSPI::drawString(str, x, y, font);
+  }
+
+  RENDER_NOINLINE int16_t drawString(const String& str, int32_t x, int32_t y) {
+    RenderScope s(RENDER_CALLER);
+    return TFT_eSPI::drawString(str, x, y);
+  }
+
+  // ── Streamed blits (cached pages): the window is the primitive, the
+  //    pixels pushed after it are charged to the same call site ──
+
+  RENDER_NOINLINE void setAddrWindow(int32_t x, int32_t y, int32_t w, int32_t h) {
+    RenderScope s(RENDER_CALLER);
+    TFT_eSPI::setAddrWindow(x, y, w, h);
+    renderProfLeaf(0);
+  }
+
+  void pushColors(uint16_t* data, uint32_t len, bool swap = true) {
+    TFT_eSPI::pushColors(data, len, swap);
+    renderProfLeaf(len, 0);
+  }
+};
+
+typedef ProfiledTFT RenderTFT;
+
+#else
+
+typedef TFT_eSPI RenderTFT;
+
+#endif // RENDER_PROFILER
+
+// ─────────────────────────────────────────────────────────────────────
+// REPORT
+// ─────────────────────────────────────────────────────────────────────
+
+// Average modeled SPI bytes per full draw (ranking key)
+uint32_t screenSpiPerDraw(const ScreenRenderStats& s) {
+  return s.draws ? s.total.spiBytes / s.draws : s.total.spiBytes;
+}
+
+void printRenderReport(const char* const* screenNames, int screenCount) {
+  uint8_t order[RENDER_PROF_MAX_SCREENS];
+  int n = 0;
+  for (int i = 0; i < screenCount && i < RENDER_PROF_MAX_SCREENS; i++) {
+    if (screenRenderStats[i].draws || screenRenderStats[i].total.prims) order[n++] = i;
+  }
+
+  // Insertion sort, most expensive first (ties broken by screen id)
+  for (int i = 1; i < n; i++) {
+    uint8_t key = order[i];
+    int j = i - 1;
+    while (j >= 0 && screenSpiPerDraw(screenRenderStats[order[j]]) < screenSpiPerDraw(screenRenderStats[key])) {
+      order[j + 1] = order[j];
+      j--;
+    }
+    order[j + 1] = key;
+  }
+
+  Serial.println("\n╔═══════════════════════════════════════════════════════════════════════════╗");
+  Serial.println("║                        RENDER PROFILE (per full draw)                     ║");
+  Serial.println("╠══════════════════════╤═══════╤═══════╤════════╤═════════╤════════╤════════╣");
+  Serial.println("║ Screen               │ Draws │ Prims │ Pixels │ SPI (B) │ SPI us │ Wall us║");
+  Serial.println("╟──────────────────────┼───────┼───────┼────────┼─────────┼────────┼────────╢");
+  for (int k = 0; k < n; k++) {
+    const ScreenRenderStats& s = screenRenderStats[order[k]];
+    uint32_t d = s.draws ? s.draws : 1;
+    uint32_t spi = s.total.spiBytes / d;
+    Serial.printf("║ %-20s │ %5u │ %5u │ %6u │ %7u │ %6u │ %6u ║\n",
+                  screenNames[order[k]], s.draws, s.total.prims / d, s.total.pixels / d,
+                  spi, renderSpiMicros(spi), s.wallUs / d);
+  }
+  Serial.println("╚══════════════════════╧═══════╧═══════╧════════╧═════════╧════════╧════════╝");
+
+  // Top call sites by total modeled SPI bytes (selection of the N largest)
+  int top[RENDER_PROF_TOP_SITES];
+  int topCount = 0;
+  bool taken[RENDER_PROF_MAX_SITES] = {false};
+  while (topCount < RENDER_PROF_TOP_SITES) {
+    int best = -1;
+    for (int i = 0; i < RENDER_PROF_MAX_SITES; i++) {
+      if (!renderSites[i].pc || taken[i]) continue;
+      if (best < 0 || renderSites[i].c.spiBytes > renderSites[best].c.spiBytes) best = i;
+    }
+    if (best < 0) break;
+    taken[best] = true;
+    top[topCount++] = best;
+  }
+
+  Serial.println("\n  Top draw call sites (decode PCs with xtensa-esp32-elf-addr2line -pfiaC -e firmware.elf)");
+  Serial.println("  ─────────────────────────────────────────────────────────────────────────");
+  Serial.println("  PC          Screen                 Calls    Pixels    SPI (B)");
+  for (int k = 0; k < topCount; k++) {
+    const RenderSite& s = renderSites[top[k]];
+    Serial.printf("  0x%08lx  %-20s %7u %9u %10u\n", (unsigned long)s.pc,
+                  screenNames[s.screen], s.c.prims, s.c.pixels, s.c.spiBytes);
+  }
+  if (renderSiteEvicted) {
+    Serial.printf("  (%u calls at lighter sites evicted from the %d-entry table)\n", renderSiteEvicted, RENDER_PROF_MAX_SITES);
+  }
+  Serial.printf("  SPI model: %u B/window + 2 B/px @ %lu Hz\n\n",
+                RENDER_SPI_WINDOW_BYTES, (unsigned long)SPI_FREQUENCY);
+}
+
+#endif // RENDER_PROFILER_H
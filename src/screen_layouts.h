@@ -0,0 +1,323 @@
+#ifndef SCREEN_LAYOUTS_H
+#define SCREEN_LAYOUTS_H
+
+/*
+ * ═══════════════════════════════════════════════════════════════════════
+ * BLACKROAD SCREEN LAYOUTS
+ * ═══════════════════════════════════════════════════════════════════════
+ *
+ * Declarative versions of the lock screen, nav bar, Emergency Pager and
+ * Alert History screens (see layout.h for the op format). Each layout is
+ * the single source of truth for both drawing and hit-testing, so the
+ * coordinates no longer have to be repeated in handleTouch().
+ *
+ * Included from main.cpp after the Emergency Pager globals.
+ */
+
+#include "layout.h"
+
+void drawStatusBar();
+
+// ─────────────────────────────────────────────────────────────────────
+// BINDING IDS (order must match the tables below)
+// ─────────────────────────────────────────────────────────────────────
+
+enum LayoutTextBinding : uint8_t {
+  BIND_CLOCK = 0,
+  BIND_ALERT_SOURCE,
+  BIND_ALERT_PRIORITY,
+  BIND_ALERT_PATTERN,
+  BIND_ALERT_TIME,
+  BIND_ALERT_MESSAGE,
+  BIND_HISTORY_TIME,
+  BIND_HISTORY_INFO,
+  BIND_HISTORY_TOTAL,
+  BIND_TEXT_COUNT
+};
+
+enum LayoutCondition : uint8_t {
+  COND_WIFI_CONNECTED = 0,
+  COND_ALERT_ACTIVE,
+  COND_ALERT_HAS_MESSAGE,
+  COND_HISTORY_EMPTY,
+  COND_HISTORY_ACKED,
+  COND_COUNT
+};
+
+enum LayoutCount : uint8_t {
+  COUNT_HISTORY_ROWS = 0,
+  COUNT_COUNT
+};
+
+enum LayoutNative : uint8_t {
+  NATIVE_STATUS_BAR = 0,
+  NATIVE_COUNT
+};
+
+// Touch actions returned by hitTestLayout() and carried by hit-test
+// regions (hit_test.h). Nav values match the old checkNavBarTouch()
+// return codes (1=left, 2=home, 3=right, 4=keyboard).
+enum LayoutAction : uint8_t {
+  ACT_NONE = 0,
+  ACT_NAV_LEFT,
+  ACT_NAV_HOME,
+  ACT_NAV_RIGHT,
+  ACT_NAV_KEYBOARD,
+  ACT_BACK_HOME,
+  ACT_PAGER_ACK,
+  ACT_PAGER_DISMISS,
+  ACT_OPEN_APP,          // arg = apps[] index
+  ACT_CEO_CORE_CELL,     // arg = row * 3 + col
+  ACT_EXEC_GRID_CELL,    // arg = row * 4 + col
+  ACT_HOT_LEADS_SYNC,
+  ACT_CHAT_SELECT_AI,    // arg = AI model index
+  ACT_OPEN_KEYBOARD,     // terminal's keyboard button
+  ACT_KEY_CHAR,          // arg = character
+  ACT_KEY_SPACE,
+  ACT_KEY_BACKSPACE,
+  ACT_KEY_ENTER,
+  ACT_KEY_DONE
+};
+
+// ─────────────────────────────────────────────────────────────────────
+// BINDINGS
+// ─────────────────────────────────────────────────────────────────────
+
+// History rows are newest first
+Alert& historyRow(uint8_t row) {
+  return alertHistory[alertHistoryCount - 1 - row];
+}
+
+void bindClock(char* out, size_t len, uint8_t) {
+  unsigned long mins = (millis() / 60000) % 60;
+  unsigned long hrs = (millis() / 3600000) % 24;
+  snprintf(out, len, "%02lu:%02lu", hrs, mins);
+}
+
+void bindAlertSource(char* out, size_t len, uint8_t)   { strlcpy(out, currentAlert.source, len); }
+void bindAlertPriority(char* out, size_t len, uint8_t) { strlcpy(out, currentAlert.priority, len); }
+void bindAlertMessage(char* out, size_t len, uint8_t)  { strlcpy(out, currentAlert.message, len); }
+
+void bindAlertPattern(char* out, size_t len, uint8_t) {
+  const char* name;
+  switch (currentAlert.patternId) {
+    case PATTERN_FAST_STROBE:  name = "Fast Strobe"; break;
+    case PATTERN_MEDIUM_BLINK: name = "Medium Blink"; break;
+    case PATTERN_SLOW_BLINK:   name = "Slow Blink"; break;
+    case PATTERN_MORSE_SOS:    name = "SOS"; break;
+    default:                   name = "Standard";
+  }
+  strlcpy(out, name, len);
+}
+
+void bindAlertTime(char* out, size_t len, uint8_t) {
+  snprintf(out, len, "%lus ago", currentAlert.timestamp / 1000);
+}
+
+void bindHistoryTime(char* out, size_t len, uint8_t row) {
+  snprintf(out, len, "%lus", historyRow(row).timestamp / 1000);
+}
+
+void bindHistoryInfo(char* out, size_t len, uint8_t row) {
+  snprintf(out, len, "%s %s", historyRow(row).source, historyRow(row).priority);
+}
+
+void bindHistoryTotal(char* out, size_t len, uint8_t) {
+  snprintf(out, len, "%d", alertHistoryCount);
+}
+
+bool condWiFiConnected(uint8_t)    { return WiFi.status() == WL_CONNECTED; }
+bool condAlertActive(uint8_t)      { return hasActiveAlert; }
+bool condAlertHasMessage(uint8_t)  { return currentAlert.message[0] != '\0'; }
+bool condHistoryEmpty(uint8_t)     { return alertHistoryCount == 0; }
+bool condHistoryAcked(uint8_t row) { return historyRow(row).acknowledged; }
+
+uint8_t countHistoryRows() { return alertHistoryCount > 5 ? 5 : alertHistoryCount; }
+
+const LayoutTextFn layoutTextFns[] = {
+  bindClock, bindAlertSource, bindAlertPriority, bindAlertPattern, bindAlertTime,
+  bindAlertMessage, bindHistoryTime, bindHistoryInfo, bindHistoryTotal
+};
+const LayoutCondFn layoutCondFns[] = {
+  condWiFiConnected, condAlertActive, condAlertHasMessage, condHistoryEmpty, condHistoryAcked
+};
+const LayoutCountFn layoutCountFns[] = { countHistoryRows };
+const LayoutNativeFn layoutNativeFns[] = { drawStatusBar };
+
+static_assert(sizeof(layoutTextFns) / sizeof(layoutTextFns[0]) == BIND_TEXT_COUNT, "text binding table out of sync");
+static_assert(sizeof(layoutCondFns) / sizeof(layoutCondFns[0]) == COND_COUNT, "condition table out of sync");
+static_assert(sizeof(layoutCountFns) / sizeof(layoutCountFns[0]) == COUNT_COUNT, "count table out of sync");
+static_assert(sizeof(layoutNativeFns) / sizeof(layoutNativeFns[0]) == NATIVE_COUNT, "native table out of sync");
+
+// ─────────────────────────────────────────────────────────────────────
+// NAV BAR - bottom 30px, shared by every screen except lock/home
+// ─────────────────────────────────────────────────────────────────────
+
+constexpr LayoutOp NAV_BAR_LAYOUT[] = {
+  L_FILL_RECT(0, 210, 320, 30, 0x0841),
+  L_HLINE(0, 210, 320, COLOR_DARK_GRAY),
+  L_BUTTON(10, 212, 70, 26, 4, COLOR_DARK_GRAY, "<", 4, COLOR_CYBER_BLUE, ACT_NAV_LEFT),
+  L_BUTTON(90, 212, 70, 26, 4, COLOR_VIVID_PUR, "HOME", 2, COLOR_WHITE, ACT_NAV_HOME),
+  L_BUTTON(170, 212, 70, 26, 4, COLOR_DARK_GRAY, ">", 4, COLOR_CYBER_BLUE, ACT_NAV_RIGHT),
+  L_BUTTON(250, 212, 60, 26, 4, COLOR_HOT_PINK, "KB", 2, COLOR_WHITE, ACT_NAV_KEYBOARD),
+  L_END()
+};
+static_assert(LAYOUT_VALID(NAV_BAR_LAYOUT), "NAV_BAR_LAYOUT is malformed");
+
+// Back pill used by the pager screens (hit area = pill)
+constexpr LayoutOp PAGER_BACK_LAYOUT[] = {
+  L_FILL_ROUND_RECT(10, 25, 50, 20, 5, COLOR_DARK_GRAY),
+  L_TEXT("< Back", 15, 28, TL_DATUM, 2, COLOR_WHITE),
+  L_HIT(10, 25, 50, 20, ACT_BACK_HOME),
+  L_END()
+};
+static_assert(LAYOUT_VALID(PAGER_BACK_LAYOUT), "PAGER_BACK_LAYOUT is malformed");
+
+// ─────────────────────────────────────────────────────────────────────
+// LOCK SCREEN
+// ─────────────────────────────────────────────────────────────────────
+
+constexpr LayoutOp LOCK_LAYOUT[] = {
+  L_FILL_SCREEN(COLOR_BLACK),
+  L_BIND_TEXT(nullptr, BIND_CLOCK, 160, 70, MC_DATUM, 7, COLOR_WHITE),
+  L_TEXT("Friday, January 10", 160, 115, MC_DATUM, 2, 0x7BEF),
+  L_HLINE(100, 135, 120, COLOR_HOT_PINK),
+  L_TEXT("OPERATOR", 160, 160, MC_DATUM, 4, COLOR_HOT_PINK),
+  L_TEXT("swipe up to unlock", 160, 220, MC_DATUM, 2, 0x4208),
+  L_IF(COND_WIFI_CONNECTED),
+    L_FILL_CIRCLE(15, 12, 4, COLOR_CYBER_BLUE),
+  L_ENDIF(),
+  L_TEXT("100%", 305, 8, TR_DATUM, 2, COLOR_SUNRISE),
+  L_END()
+};
+static_assert(LAYOUT_VALID(LOCK_LAYOUT), "LOCK_LAYOUT is malformed");
+
+// ─────────────────────────────────────────────────────────────────────
+// EMERGENCY PAGER
+// ─────────────────────────────────────────────────────────────────────
+
+constexpr LayoutOp PAGER_LAYOUT[] = {
+  L_FILL_SCREEN(COLOR_BLACK),
+  L_NATIVE(NATIVE_STATUS_BAR),
+  L_INCLUDE(PAGER_BACK_LAYOUT),
+  L_TEXT("EMERGENCY ALERT", 160, 50, TC_DATUM, 4, COLOR_HOT_PINK),
+
+  L_IF_NOT(COND_ALERT_ACTIVE),
+    L_TEXT("No active alerts", 160, 120, MC_DATUM, 2, COLOR_WHITE),
+    L_TEXT("All clear", 160, 145, MC_DATUM, 2, COLOR_WHITE),
+  L_ENDIF(),
+
+  L_IF(COND_ALERT_ACTIVE),
+    L_DRAW_ROUND_RECT(15, 80, 290, 90, 8, COLOR_HOT_PINK),
+    L_BIND_TEXT("SOURCE:   ", BIND_ALERT_SOURCE, 25, 90, TL_DATUM, 2, COLOR_WHITE),
+    L_BIND_TEXT("PRIORITY: ", BIND_ALERT_PRIORITY, 25, 110, TL_DATUM, 2, COLOR_WHITE),
+    L_BIND_TEXT("PATTERN:  ", BIND_ALERT_PATTERN, 25, 130, TL_DATUM, 2, COLOR_WHITE),
+    L_BIND_TEXT("TIME:     ", BIND_ALERT_TIME, 25, 150, TL_DATUM, 2, COLOR_WHITE),
+    L_IF(COND_ALERT_HAS_MESSAGE),
+      L_BIND_TEXT(nullptr, BIND_ALERT_MESSAGE, 160, 180, TC_DATUM, 1, COLOR_SUNRISE),
+    L_ENDIF(),
+    L_BUTTON(30, 200, 120, 35, 8, COLOR_CYBER_BLUE, "ACK", 2, COLOR_WHITE, ACT_PAGER_ACK),
+    L_BUTTON(170, 200, 120, 35, 8, COLOR_DARK_GRAY, "DISMISS", 2, COLOR_WHITE, ACT_PAGER_DISMISS),
+  L_ENDIF(),
+  L_END()
+};
+static_assert(LAYOUT_VALID(PAGER_LAYOUT), "PAGER_LAYOUT is malformed");
+
+// ─────────────────────────────────────────────────────────────────────
+// ALERT HISTORY - last 5 alerts, newest first
+// ─────────────────────────────────────────────────────────────────────
+
+constexpr LayoutOp ALERT_HISTORY_LAYOUT[] = {
+  L_FILL_SCREEN(COLOR_BLACK),
+  L_NATIVE(NATIVE_STATUS_BAR),
+  L_INCLUDE(PAGER_BACK_LAYOUT),
+  L_TEXT("ALERT HISTORY", 160, 50, TC_DATUM, 4, COLOR_HOT_PINK),
+
+  L_IF(COND_HISTORY_EMPTY),
+    L_TEXT("No alerts in history", 160, 120, MC_DATUM, 2, COLOR_WHITE),
+  L_ENDIF(),
+
+  L_IF_NOT(COND_HISTORY_EMPTY),
+    L_REPEAT(COUNT_HISTORY_ROWS, 25),
+      L_BIND_TEXT(nullptr, BIND_HISTORY_TIME, 15, 80, TL_DATUM, 1, COLOR_DARK_GRAY),
+      L_BIND_TEXT(nullptr, BIND_HISTORY_INFO, 70, 80, TL_DATUM, 2, COLOR_WHITE),
+      L_IF(COND_HISTORY_ACKED),
+        L_TEXT("ACK", 270, 80, TL_DATUM, 2, COLOR_CYBER_BLUE),
+      L_ENDIF(),
+    L_ENDREPEAT(),
+    L_BIND_TEXT("Total alerts: ", BIND_HISTORY_TOTAL, 160, 215, TC_DATUM, 1, COLOR_SUNRISE),
+  L_ENDIF(),
+  L_END()
+};
+static_assert(LAYOUT_VALID(ALERT_HISTORY_LAYOUT), "ALERT_HISTORY_LAYOUT is malformed");
+
+// ─────────────────────────────────────────────────────────────────────
+// REGISTRY + BENCHMARK
+// ─────────────────────────────────────────────────────────────────────
+
+struct LayoutScreen {
+  const char* name;
+  const LayoutOp* ops;
+};
+
+const LayoutScreen layoutScreens[] = {
+  {"NavBar",       NAV_BAR_LAYOUT},
+  {"PagerBack",    PAGER_BACK_LAYOUT},
+  {"Lock",         LOCK_LAYOUT},
+  {"Pager",        PAGER_LAYOUT},
+  {"AlertHistory", ALERT_HISTORY_LAYOUT},
+};
+#define LAYOUT_SCREEN_COUNT (sizeof(layoutScreens) / sizeof(layoutScreens[0]))
+
+void initScreenLayouts() {
+  layoutBind(layoutTextFns, layoutCondFns, layoutCountFns, layoutNativeFns);
+}
+
+// Renders every ported layout `iterations` times and reports flash
+// footprint, RAM and render time. Leaves the screen dirty - the caller
+// redraws the current screen afterwards.
+void printLayoutBenchmark(int iterations = 10) {
+  Serial.println("\n╔═══════════════════════════════════════════════════════════╗");
+  Serial.println("║              LAYOUT ENGINE BENCHMARK                      ║");
+  Serial.println("╠═══════════════════════════════════════════════════════════╣");
+  Serial.printf("║ Op record: %u bytes   Interpreter stack: ~%u bytes/level    ║\n",
+                (unsigned)sizeof(LayoutOp), (unsigned)(LAYOUT_TEXT_MAX + 48));
+  Serial.printf("║ Static RAM: %u bytes (binding table pointers)              ║\n",
+                (unsigned)sizeof(layoutBindings));
+  Serial.println("╠══════════════╤═════╤═══════╤═══════╤══════════╤══════════╣");
+  Serial.println("║ Layout       │ Ops │ Flash │  Text │ Avg (us) │ Max (us) ║");
+  Serial.println("╟──────────────┼─────┼───────┼───────┼──────────┼──────────╢");
+
+  size_t totalFlash = 0;
+  for (size_t s = 0; s < LAYOUT_SCREEN_COUNT; s++) {
+    LayoutFootprint fp = layoutFootprint(layoutScreens[s].ops);
+    unsigned long total = 0, worst = 0;
+
+    for (int i = 0; i < iterations; i++) {
+      unsigned long t0 = micros();
+      renderLayout(tft, layoutScreens[s].ops);
+      unsigned long dt = micros() - t0;
+      total += dt;
+      if (dt > worst) worst = dt;
+    }
+
+    totalFlash += fp.opBytes + fp.textBytes;
+    Serial.printf("║ %-12s │ %3d │ %5u │ %5u │ %8lu │ %8lu ║\n",
+                  layoutScreens[s].name, fp.ops, (unsigned)fp.opBytes, (unsigned)fp.textBytes,
+                  total / iterations, worst);
+  }
+
+  // Hit-test cost: worst case is a miss, which walks the whole list
+  unsigned long t0 = micros();
+  for (int i = 0; i < iterations; i++) {
+    hitTestLayout(PAGER_LAYOUT, 0, 0);
+  }
+  unsigned long hitUs = (micros() - t0) / iterations;
+
+  Serial.println("╟──────────────┴─────┴───────┴───────┴──────────┴──────────╢");
+  Serial.printf("║ Total layout flash: %5u bytes   Pager hit-test: %4lu us  ║\n",
+                (unsigned)totalFlash, hitUs);
+  Serial.println("╚═══════════════════════════════════════════════════════════╝\n");
+}
+
+#endif // SCREEN_LAYOUTS_H
@@ -0,0 +1,320 @@
+#ifndef SERIAL_CMD_H
+#define SERIAL_CMD_H
+
+/*
+ * ═══════════════════════════════════════════════════════════════════════
+ * BLACKROAD SERIAL COMMANDS - non-blocking line assembly + hashed dispatch
+ * ═══════════════════════════════════════════════════════════════════════
+ *
+ * Serial.readBytesUntil() waits out the Stream timeout (1 s) whenever half
+ * a line is in the UART, and the old if/else chain compared each line
+ * against up to 60 strings. Instead:
+ *
+ * - serialPoll() copies whatever the UART already holds into a fixed
+ *   ring (SERIAL_RX_RING) and never waits for more
+ * - each complete line is trimmed and split into token + arguments in
+ *   place, as views into the ring. Only a line that wraps around the end
+ *   of the ring is copied out once
+ * - the token is hashed (FNV-1a, SERIAL_CMD_SEED) straight to its slot in
+ *   a SERIAL_CMD_SLOTS table. serialCmdPerfect() static_asserts that the
+ *   table has no collisions, so a lookup is one hash plus one compare
+ * - the ring is refilled as lines free it, up to SERIAL_LINES_PER_PASS
+ *   lines per loop() pass; the rest of a burst waits in the ring (then
+ *   the UART driver) rather than stalling a frame
+ * - every 0x00 ends a binary frame: the bytes since the last '\n' or
+ *   0x00, if any, go to the handler pager_frame.h registers, so text and
+ *   frames share the port. A 0x00 with nothing before it opens a frame,
+ *   and until the next 0x00 '\n' is data (COBS removes only zeros).
+ *   Nothing counts delimiters, so a lost 0x00 costs the frame or two
+ *   around it (their CRC fails) and the stream is back in step after
+ *   the next one
+ *
+ * Handlers get the arguments as a view and return false for arguments
+ * they do not understand. A line longer than SERIAL_LINE_MAX is dropped
+ * with "ERROR: line too long" instead of running a truncated command.
+ * SERIAL reports lines, lookup cost and the slowest handler and pass;
+ * tools/serial_bench.py streams pager traffic through a pty at the host
+ * build to measure throughput and worst-case stall.
+ */
+
+#include "fixed_string.h"
+#include "heap_trace.h"
+
+// ─────────────────────────────────────────────────────────────────────
+// CONFIGURATION
+// ─────────────────────────────────────────────────────────────────────
+
+#define SERIAL_LINE_MAX          96      // longest command line, without the newline
+#define SERIAL_FRAME_MAX         192     // longest binary frame, without its 0x00 delimiters
+#define SERIAL_RX_RING           512     // power of two, > SERIAL_FRAME_MAX
+#define SERIAL_LINES_PER_PASS    32      // lines run per loop() pass, refilling between
+#define SERIAL_CMD_SLOTS         64      // power of two, > command count
+#ifndef SERIAL_CMD_SEED
+#define SERIAL_CMD_SEED          0x00002422u   // tools/serial_bench.py --find-seed
+#endif
+
+static_assert((SERIAL_RX_RING & (SERIAL_RX_RING - 1)) == 0, "SERIAL_RX_RING must be a power of two");
+static_assert(SERIAL_RX_RING > SERIAL_LINE_MAX && SERIAL_RX_RING > SERIAL_FRAME_MAX,
+              "the ring must hold a full line and a full frame");
+
+struct SerialCommand {
+  const char* name;                 // first token, case-sensitive
+  bool (*run)(StrView args);        // false = arguments not understood
+};
+
+// Binary frames (pager_frame.h): the bytes before a 0x00, still encoded
+typedef void (*SerialFrameHandler)(uint8_t* frame, size_t len);
+typedef void (*SerialPassHook)();
+
+// ─────────────────────────────────────────────────────────────────────
+// PERFECT HASH
+// ─────────────────────────────────────────────────────────────────────
+
+constexpr uint32_t serialCmdHash(const char* s, uint32_t h = 2166136261u ^ SERIAL_CMD_SEED) {
+  return *s ? serialCmdHash(s + 1, (h ^ (uint8_t)*s) * 16777619u) : h;
+}
+
+constexpr uint8_t serialCmdSlot(uint32_t h) {
+  return (h ^ (h >> 16)) & (SERIAL_CMD_SLOTS - 1);
+}
+
+// Same hash over a token that is not NUL-terminated
+inline uint32_t serialCmdHash(StrView s) {
+  uint32_t h = 2166136261u ^ SERIAL_CMD_SEED;
+  for (size_t i = 0; i < s.length(); i++) h = (h ^ (uint8_t)s[i]) * 16777619u;
+  return h;
+}
+
+constexpr bool serialCmdUniqueFrom(const SerialCommand* t, int n, int i, int j) {
+  return j >= n || (serialCmdSlot(serialCmdHash(t[i].name)) != serialCmdSlot(serialCmdHash(t[j].name)) &&
+                    serialCmdUniqueFrom(t, n, i, j + 1));
+}
+
+// No two names share a slot - use in a static_assert next to the table
+constexpr bool serialCmdPerfect(const SerialCommand* t, int n, int i = 0) {
+  return n <= SERIAL_CMD_SLOTS && (i >= n || (serialCmdUniqueFrom(t, n, i, i + 1) && serialCmdPerfect(t, n, i + 1)));
+}
+
+// ─────────────────────────────────────────────────────────────────────
+// STATE + STATS
+// ─────────────────────────────────────────────────────────────────────
+
+struct SerialStats {
+  uint32_t lines;
+  uint32_t bytes;
+  uint32_t unknown;           // no such command, or arguments rejected
+  uint32_t tooLong;
+  uint32_t wrapped;           // lines/frames copied out because they wrapped the ring
+  uint32_t frames;
+  uint32_t framesTooLong;
+  uint16_t ringPeak;          // most bytes waiting
+  uint8_t maxLinesPerPass;
+  uint32_t lookupCycles;      // hash + compare, all lines
+  uint32_t lookupMaxCycles;
+  uint32_t handlerMaxUs;
+  const char* handlerMaxCmd;
+  uint32_t passMaxUs;         // whole serialPoll(), read + every line
+  uint32_t resetMs;
+};
+
+char serialRing[SERIAL_RX_RING];
+uint32_t serialHead = 0;      // bytes written (free-running)
+uint32_t serialTail = 0;      // start of the current line
+uint32_t serialScan = 0;      // next byte to look at for '\n'
+bool serialDropping = false;  // inside a too-long line or frame, until its end
+bool serialInFrame = false;   // after a 0x00 with nothing before it - '\n' is data
+char serialWrapLine[SERIAL_FRAME_MAX > SERIAL_LINE_MAX ? SERIAL_FRAME_MAX : SERIAL_LINE_MAX];
+
+SerialFrameHandler serialFrameHandler = nullptr;
+SerialPassHook serialPassEnd = nullptr;
+
+const SerialCommand* serialCmdTable = nullptr;
+int8_t serialCmdIndex[SERIAL_CMD_SLOTS];
+SerialStats serialStats;
+
+void serialCmdInit(const SerialCommand* table, int count) {
+  serialCmdTable = table;
+  memset(serialCmdIndex, -1, sizeof(serialCmdIndex));
+  for (int i = 0; i < count; i++) serialCmdIndex[serialCmdSlot(serialCmdHash(table[i].name))] = i;
+  memset(&serialStats, 0, sizeof(serialStats));
+}
+
+// Without a handler, frames are counted and dropped. `passEnd` runs after
+// every serialPoll() (batched replies)
+void serialFrameInit(SerialFrameHandler handler, SerialPassHook passEnd) {
+  serialFrameHandler = handler;
+  serialPassEnd = passEnd;
+}
+
+// Bytes not scanned yet - for the idle/animation input checks. Half a
+// line already scanned is not input until its newline arrives
+bool serialPending() {
+  return serialHead != serialScan || Serial.available() > 0;
+}
+
+// ─────────────────────────────────────────────────────────────────────
+// DISPATCH
+// ─────────────────────────────────────────────────────────────────────
+
+const SerialCommand* serialCmdFind(StrView token) {
+  uint32_t c0 = ESP.getCycleCount();
+  int8_t i = serialCmdTable ? serialCmdIndex[serialCmdSlot(serialCmdHash(token))] : -1;
+  const SerialCommand* cmd = i >= 0 && token == serialCmdTable[i].name ? &serialCmdTable[i] : nullptr;
+  uint32_t cycles = ESP.getCycleCount() - c0;
+  serialStats.lookupCycles += cycles;
+  if (cycles > serialStats.lookupMaxCycles) serialStats.lookupMaxCycles = cycles;
+  return cmd;
+}
+
+void serialDispatchLine(StrView line) {
+  line = line.trim();
+  if (line.isEmpty()) return;
+  HeapTag heapTag(HEAP_TAG_SERIAL);
+  serialStats.lines++;
+
+  int space = line.indexOf(' ');
+  StrView token = line.substring(0, space < 0 ? line.length() : space);
+  StrView args = space < 0 ? StrView() : line.substring(space + 1).trim();
+
+  const SerialCommand* cmd = serialCmdFind(token);
+  if (!cmd) {
+    serialStats.unknown++;
+    return;
+  }
+  uint32_t t0 = micros();
+  if (!cmd->run(args)) serialStats.unknown++;
+  uint32_t us = micros() - t0;
+  if (us > serialStats.handlerMaxUs) {
+    serialStats.handlerMaxUs = us;
+    serialStats.handlerMaxCmd = cmd->name;
+  }
+}
+
+void serialDispatchFrame(char* frame, size_t len) {
+  HeapTag heapTag(HEAP_TAG_SERIAL);
+  serialStats.frames++;
+  if (serialFrameHandler) serialFrameHandler((uint8_t*)frame, len);
+}
+
+// ─────────────────────────────────────────────────────────────────────
+// LINE ASSEMBLER
+// ─────────────────────────────────────────────────────────────────────
+
+// Copy what the UART holds into the ring - never waits for more
+void serialFill() {
+  int avail = Serial.available();
+  while (avail > 0) {
+    uint32_t room = SERIAL_RX_RING - (serialHead - serialTail);
+    if (!room) break;
+    uint32_t at = serialHead & (SERIAL_RX_RING - 1);
+    uint32_t chunk = SERIAL_RX_RING - at;   // contiguous up to the end of the ring
+    if (chunk > room) chunk = room;
+    if (chunk > (uint32_t)avail) chunk = avail;
+    size_t n = Serial.readBytes(serialRing + at, chunk);
+    if (!n) break;
+    serialHead += n;
+    serialStats.bytes += n;
+    avail -= n;
+  }
+  uint32_t waiting = serialHead - serialTail;
+  if (waiting > serialStats.ringPeak) serialStats.ringPeak = waiting;
+}
+
+// Start of [serialTail, end) - in place unless it wraps. Writable, so
+// frames decode where they lie
+char* serialSegment(uint32_t end) {
+  uint32_t len = end - serialTail;
+  uint32_t at = serialTail & (SERIAL_RX_RING - 1);
+  if (at + len <= SERIAL_RX_RING) return serialRing + at;
+  uint32_t first = SERIAL_RX_RING - at;
+  memcpy(serialWrapLine, serialRing + at, first);
+  memcpy(serialWrapLine + first, serialRing, len - first);
+  serialStats.wrapped++;
+  return serialWrapLine;
+}
+
+void serialPoll() {
+  uint32_t t0 = micros();
+  uint8_t lines = 0;
+  bool more = true;
+  while (more && lines < SERIAL_LINES_PER_PASS) {
+    serialFill();
+    more = false;
+    while (serialScan != serialHead && lines < SERIAL_LINES_PER_PASS) {
+      char c = serialRing[serialScan & (SERIAL_RX_RING - 1)];
+      serialScan++;
+      if (c == '\0') {                    // ends a frame, or opens one if nothing precedes it
+        uint32_t len = serialScan - 1 - serialTail;
+        if (!serialDropping && len) {
+          serialDispatchFrame(serialSegment(serialScan - 1), len);
+          lines++;
+        }
+        serialInFrame = !serialDropping && !len;
+        serialDropping = false;
+        serialTail = serialScan;
+        more = true;
+        continue;
+      }
+      if (c != '\n' || serialInFrame) {
+        uint32_t limit = serialInFrame ? SERIAL_FRAME_MAX : SERIAL_LINE_MAX;
+        if (!serialDropping && serialScan - serialTail > limit) {
+          serialDropping = true;          // too long - skip to its end
+          if (serialInFrame) {
+            serialStats.framesTooLong++;
+            serialInFrame = false;        // not a frame - the next '\n' ends it too
+          } else {
+            serialStats.tooLong++;
+            Serial.println("ERROR: line too long");
+          }
+        }
+        if (serialDropping) serialTail = serialScan;
+        continue;
+      }
+      if (serialDropping) {
+        serialDropping = false;
+      } else {
+        uint32_t len = serialScan - 1 - serialTail;
+        serialDispatchLine(StrView(serialSegment(serialScan - 1), len));
+        lines++;
+      }
+      serialTail = serialScan;
+      more = true;                        // ring space freed - the UART may hold more
+    }
+  }
+  if (lines > serialStats.maxLinesPerPass) serialStats.maxLinesPerPass = lines;
+  if (serialPassEnd) serialPassEnd();
+
+  uint32_t us = micros() - t0;
+  if (us > serialStats.passMaxUs) serialStats.passMaxUs = us;
+}
+
+// ─────────────────────────────────────────────────────────────────────
+// REPORT
+// ─────────────────────────────────────────────────────────────────────
+
+void resetSerialStats() {
+  memset(&serialStats, 0, sizeof(serialStats));
+  serialStats.resetMs = millis();
+}
+
+void printSerialReport() {
+  const SerialStats& s = serialStats;
+  Serial.println("\n━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━");
+  Serial.println("   SERIAL COMMANDS");
+  Serial.println("━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━");
+  uint32_t secs = (millis() - s.resetMs) / 1000;
+  Serial.printf("   %-14s%u lines, %u B in %u s (%u lines/s)\n", "Traffic:", s.lines, s.bytes, secs,
+                secs ? s.lines / secs : s.lines);
+  Serial.printf("   %-14s%u unknown, %u too long, %u wrapped the ring\n", "Rejected:",
+                s.unknown, s.tooLong, s.wrapped);
+  Serial.printf("   %-14s%u binary, %u too long\n", "Frames:", s.frames, s.framesTooLong);
+  Serial.printf("   %-14s%u / %u B peak, up to %u lines in one pass (max %u)\n", "Ring:",
+                s.ringPeak, SERIAL_RX_RING, s.maxLinesPerPass, SERIAL_LINES_PER_PASS);
+  Serial.printf("   %-14savg %u, max %u cycles (hash + compare)\n", "Lookup:",
+                s.lines ? s.lookupCycles / s.lines : 0, s.lookupMaxCycles);
+  Serial.printf("   %-14s%u us (%s)\n", "Slowest cmd:", s.handlerMaxUs, s.handlerMaxCmd ? s.handlerMaxCmd : "-");
+  Serial.printf("   %-14s%u us, read + dispatch\n", "Slowest pass:", s.passMaxUs);
+  Serial.println("━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━\n");
+}
+
+#endif // SERIAL_CMD_H
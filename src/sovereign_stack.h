@@ -14,100 +14,117 @@
  * Based on: BLACKROAD_FORKIES_CANONICAL_STACK.md
  */
 
+#include "status_model.h"
+
 // ─────────────────────────────────────────────────────────────────────
-// STACK COMPONENT STATUS
+// STACK COMPONENTS (flash)
 // ─────────────────────────────────────────────────────────────────────
 
-struct StackComponent {
-  String name;
-  String category;      // "identity", "mesh", "ai", "crm", "database"
-  String status;        // "active", "degraded", "offline", "unknown"
-  bool sovereign;       // true if self-hosted (Layer 1), false if SaaS (Layer 2)
-  String license;       // "MIT", "Apache-2.0", "GPLv3", etc.
-  unsigned long lastCheck;
+enum StackCategory : uint8_t {
+  CAT_IDENTITY,
+  CAT_MESH,
+  CAT_DATABASE,
+  CAT_DEVOPS,
+  CAT_AI,
+  CAT_CRM,
+  CAT_INFRASTRUCTURE,
+  CAT_PAYMENTS,
+  CAT_COUNT
 };
 
-StackComponent sovereignStack[20];
-int stackComponentCount = 0;
-
-// ─────────────────────────────────────────────────────────────────────
-// INITIALIZE SOVEREIGN STACK COMPONENTS
-// ─────────────────────────────────────────────────────────────────────
-
-void initSovereignStack() {
-  Serial.println("\n🏗️ Initializing Sovereign Stack Monitor...");
+const char* const STACK_CATEGORY_NAMES[CAT_COUNT] = {
+  "identity", "mesh", "database", "devops", "ai", "crm", "infrastructure", "payments",
+};
 
-  stackComponentCount = 0;
+// Never changes at runtime - stays in flash, nothing is copied at init
+struct StackComponent {
+  const char* name;
+  StackCategory category;
+  bool sovereign;        // true if self-hosted (Layer 1), false if SaaS (Layer 2)
+  const char* license;   // "MIT", "Apache-2.0", "GPLv3", etc.
+  ComponentStatus initial;
+};
 
+constexpr StackComponent STACK_COMPONENTS[] = {
   // LAYER 1: INFRASTRUCTURE (Sovereign - Self-Hosted)
-  // ─────────────────────────────────────────────────────────────────────
-
-  // Identity & Auth
-  sovereignStack[stackComponentCount++] = {
-    "Keycloak", "identity", "unknown", true, "Apache-2.0", 0
-  };
-
-  sovereignStack[stackComponentCount++] = {
-    "Authelia", "identity", "unknown", true, "Apache-2.0", 0
-  };
+  { "Keycloak",    CAT_IDENTITY,       true,  "Apache-2.0", COMP_UNKNOWN },   // Identity & Auth
+  { "Authelia",    CAT_IDENTITY,       true,  "Apache-2.0", COMP_UNKNOWN },
+  { "Headscale",   CAT_MESH,           true,  "MIT",        COMP_UNKNOWN },   // Network Mesh
+  { "Tailscale",   CAT_MESH,           false, "BSD-3",      COMP_ACTIVE },    // Using their control plane
+  { "PostgreSQL",  CAT_DATABASE,       true,  "PostgreSQL", COMP_UNKNOWN },   // Databases
+  { "Qdrant",      CAT_DATABASE,       true,  "Apache-2.0", COMP_UNKNOWN },
+  { "Forgejo",     CAT_DEVOPS,         true,  "MIT",        COMP_UNKNOWN },   // Version Control
+  { "vLLM",        CAT_AI,             true,  "Apache-2.0", COMP_UNKNOWN },   // AI Stack
+  { "Ollama",      CAT_AI,             true,  "MIT",        COMP_UNKNOWN },
+  { "EspoCRM",     CAT_CRM,            true,  "GPLv3",      COMP_UNKNOWN },   // CRM
 
-  // Network Mesh
-  sovereignStack[stackComponentCount++] = {
-    "Headscale", "mesh", "unknown", true, "MIT", 0
-  };
+  // LAYER 2: SERVICES (External APIs - Used but not controlled)
+  { "Cloudflare",  CAT_INFRASTRUCTURE, false, "N/A",        COMP_ACTIVE },
+  { "GitHub",      CAT_DEVOPS,         false, "N/A",        COMP_ACTIVE },
+  { "HuggingFace", CAT_AI,             false, "N/A",        COMP_UNKNOWN },
+  { "Stripe",      CAT_PAYMENTS,       false, "N/A",        COMP_UNKNOWN },
+};
 
-  sovereignStack[stackComponentCount++] = {
-    "Tailscale", "mesh", "active", false, "BSD-3", 0  // Using their control plane
-  };
+#define STACK_COMPONENT_COUNT ((int)(sizeof(STACK_COMPONENTS) / sizeof(STACK_COMPONENTS[0])))
+static_assert(STACK_COMPONENT_COUNT <= 32, "StackState masks are 32 bits");
 
-  // Databases
-  sovereignStack[stackComponentCount++] = {
-    "PostgreSQL", "database", "unknown", true, "PostgreSQL", 0
-  };
+// ─────────────────────────────────────────────────────────────────────
+// RUNTIME STATE
+// ─────────────────────────────────────────────────────────────────────
 
-  sovereignStack[stackComponentCount++] = {
-    "Qdrant", "database", "unknown", true, "Apache-2.0", 0
-  };
+// Only what changes, one array per field; bit i of a mask = component i
+struct StackState {
+  ComponentStatus status[STACK_COMPONENT_COUNT];
+  uint32_t lastCheck[STACK_COMPONENT_COUNT];
+  uint32_t sovereignMask;   // from STACK_COMPONENTS
+  uint32_t forkableMask;    // sovereign + OSI license, checked once at init
+};
 
-  // Version Control
-  sovereignStack[stackComponentCount++] = {
-    "Forgejo", "devops", "unknown", true, "MIT", 0
-  };
+StackState stackState;
 
-  // AI Stack
-  sovereignStack[stackComponentCount++] = {
-    "vLLM", "ai", "unknown", true, "Apache-2.0", 0
-  };
+// ─────────────────────────────────────────────────────────────────────
+// FORKIES CHECK - Can we fork everything?
+// ─────────────────────────────────────────────────────────────────────
 
-  sovereignStack[stackComponentCount++] = {
-    "Ollama", "ai", "unknown", true, "MIT", 0
+bool isForkableLicense(const char* license) {
+  // OSI-approved open source licenses
+  const char* forkable[] = {
+    "MIT", "Apache-2.0", "BSD", "GPLv3", "AGPLv3", "MPL-2.0",
+    "LGPLv3", "PostgreSQL", "ISC"
   };
 
-  // CRM
-  sovereignStack[stackComponentCount++] = {
-    "EspoCRM", "crm", "unknown", true, "GPLv3", 0
-  };
+  for (int i = 0; i < 9; i++) {
+    if (license && strstr(license, forkable[i])) {
+      return true;
+    }
+  }
 
-  // LAYER 2: SERVICES (External APIs - Used but not controlled)
-  // ─────────────────────────────────────────────────────────────────────
+  return false;
+}
 
-  sovereignStack[stackComponentCount++] = {
-    "Cloudflare", "infrastructure", "active", false, "N/A", 0
-  };
+int getForkableCount() {
+  return __builtin_popcount(stackState.forkableMask & stackState.sovereignMask);
+}
 
-  sovereignStack[stackComponentCount++] = {
-    "GitHub", "devops", "active", false, "N/A", 0
-  };
+// ─────────────────────────────────────────────────────────────────────
+// INITIALIZE SOVEREIGN STACK COMPONENTS
+// ─────────────────────────────────────────────────────────────────────
 
-  sovereignStack[stackComponentCount++] = {
-    "HuggingFace", "ai", "unknown", false, "N/A", 0
-  };
+void initSovereignStack() {
+  Serial.println("\n🏗️ Initializing Sovereign Stack Monitor...");
 
-  sovereignStack[stackComponentCount++] = {
-    "Stripe", "payments", "unknown", false, "N/A", 0
-  };
+  stackState.sovereignMask = 0;
+  stackState.forkableMask = 0;
+  for (int i = 0; i < STACK_COMPONENT_COUNT; i++) {
+    const StackComponent& c = STACK_COMPONENTS[i];
+    stackState.status[i] = c.initial;
+    stackState.lastCheck[i] = 0;
+    if (c.sovereign) stackState.sovereignMask |= 1u << i;
+    if (c.sovereign && isForkableLicense(c.license)) stackState.forkableMask |= 1u << i;
+  }
 
-  Serial.printf("  ✓ Initialized %d stack components\n", stackComponentCount);
+  Serial.printf("  ✓ Initialized %d stack components (%u B state)\n", STACK_COMPONENT_COUNT,
+                (unsigned)sizeof(stackState));
   Serial.println("  ✓ Sovereign stack monitor ready\n");
 }
 
@@ -115,36 +132,31 @@ void initSovereignStack() {
 // CHECK COMPONENT HEALTH
 // ─────────────────────────────────────────────────────────────────────
 
-String checkComponentHealth(String category) {
+ComponentStatus checkComponentHealth(StackCategory category) {
   // Map category to navigation state
-  if (category == "mesh") {
-    return navState.meshHealthy ? "active" : "degraded";
-  }
-  else if (category == "crm") {
-    return navState.crmHealthy ? "active" : "degraded";
-  }
-  else if (category == "ai") {
-    return navState.aiHealthy ? "active" : "degraded";
+  switch (category) {
+    case CAT_MESH: return navState.meshHealthy ? COMP_ACTIVE : COMP_DEGRADED;
+    case CAT_CRM:  return navState.crmHealthy ? COMP_ACTIVE : COMP_DEGRADED;
+    case CAT_AI:   return navState.aiHealthy ? COMP_ACTIVE : COMP_DEGRADED;
+    default:       return COMP_UNKNOWN;  // identity, database, ... not monitored yet
   }
-  else if (category == "identity" || category == "database") {
-    return "unknown";  // Not monitored yet
-  }
-  return "unknown";
 }
 
 void updateStackHealth() {
   Serial.println("\n🔍 Checking sovereign stack health...");
 
-  for (int i = 0; i < stackComponentCount; i++) {
-    String prevStatus = sovereignStack[i].status;
-    sovereignStack[i].status = checkComponentHealth(sovereignStack[i].category);
-    sovereignStack[i].lastCheck = millis();
+  uint32_t now = millis();
+  for (int i = 0; i < STACK_COMPONENT_COUNT; i++) {
+    ComponentStatus prevStatus = stackState.status[i];
+    ComponentStatus status = checkComponentHealth(STACK_COMPONENTS[i].category);
+    stackState.status[i] = status;
+    stackState.lastCheck[i] = now;
 
-    if (prevStatus != sovereignStack[i].status) {
+    if (status != prevStatus) {
       Serial.printf("  %s: %s → %s\n",
-        sovereignStack[i].name.c_str(),
-        prevStatus.c_str(),
-        sovereignStack[i].status.c_str()
+        STACK_COMPONENTS[i].name,
+        COMPONENT_STATUS_NAMES[prevStatus],
+        COMPONENT_STATUS_NAMES[status]
       );
     }
   }
@@ -166,62 +178,25 @@ struct SovereigntyMetrics {
 SovereigntyMetrics getSovereigntyMetrics() {
   SovereigntyMetrics metrics = {0};
 
-  metrics.totalComponents = stackComponentCount;
-
-  for (int i = 0; i < stackComponentCount; i++) {
-    if (sovereignStack[i].sovereign) {
-      metrics.sovereignComponents++;
-    }
+  metrics.totalComponents = STACK_COMPONENT_COUNT;
+  metrics.sovereignComponents = __builtin_popcount(stackState.sovereignMask);
 
-    if (sovereignStack[i].status == "active") {
-      metrics.activeComponents++;
-    } else if (sovereignStack[i].status == "degraded") {
-      metrics.degradedComponents++;
-    } else if (sovereignStack[i].status == "offline") {
-      metrics.offlineComponents++;
-    }
-  }
+  int byStatus[4] = {0};
+  for (int i = 0; i < STACK_COMPONENT_COUNT; i++) byStatus[stackState.status[i]]++;
+  metrics.activeComponents = byStatus[COMP_ACTIVE];
+  metrics.degradedComponents = byStatus[COMP_DEGRADED];
+  metrics.offlineComponents = byStatus[COMP_OFFLINE];
 
   metrics.sovereigntyScore = (float)metrics.sovereignComponents / metrics.totalComponents * 100.0;
 
   return metrics;
 }
 
-// ─────────────────────────────────────────────────────────────────────
-// FORKIES CHECK - Can we fork everything?
-// ─────────────────────────────────────────────────────────────────────
-
-bool isForkableLicense(String license) {
-  // OSI-approved open source licenses
-  const char* forkable[] = {
-    "MIT", "Apache-2.0", "BSD", "GPLv3", "AGPLv3", "MPL-2.0",
-    "LGPLv3", "PostgreSQL", "ISC"
-  };
-
-  for (int i = 0; i < 9; i++) {
-    if (license.indexOf(forkable[i]) >= 0) {
-      return true;
-    }
-  }
-
-  return false;
-}
-
-int getForkableCount() {
-  int count = 0;
-  for (int i = 0; i < stackComponentCount; i++) {
-    if (sovereignStack[i].sovereign && isForkableLicense(sovereignStack[i].license)) {
-      count++;
-    }
-  }
-  return count;
-}
-
 // ─────────────────────────────────────────────────────────────────────
 // SOVEREIGNTY STATUS SUMMARY
 // ─────────────────────────────────────────────────────────────────────
 
-String getSovereigntyStatus() {
+const char* getSovereigntyStatus() {
   SovereigntyMetrics metrics = getSovereigntyMetrics();
 
   if (metrics.sovereigntyScore >= 80.0) {
@@ -0,0 +1,325 @@
+#ifndef STALL_DETECTOR_H
+#define STALL_DETECTOR_H
+
+/*
+ * ═══════════════════════════════════════════════════════════════════════
+ * BLACKROAD STALL DETECTOR - where loop() was when it blew its budget
+ * ═══════════════════════════════════════════════════════════════════════
+ *
+ * stallArm() at the top of loop() starts a one-shot esp_timer for
+ * STALL_BUDGET_MS; stallDisarm() before loopIdle() stops it. If it fires,
+ * a sampler task pinned to loop()'s core at a higher priority wakes up -
+ * loop() is preempted (or blocked) and its registers are saved on its
+ * stack - and walks loop()'s backtrace from that frame. The record goes
+ * into a ring together with the loop() phase (serial, touch, events,
+ * ...) and gets its duration when loop() finally disarms.
+ *
+ * Watchdog: loop() is subscribed to the task watchdog (enableLoopWDT,
+ * 5 s). A stall still running at STALL_WDT_WARN_MS is sampled again and
+ * printed right away, before the watchdog fires. The watchdog ISR hook
+ * copies the open stall into RTC memory, so after a watchdog or panic
+ * reset STALLS shows where the previous boot was stuck.
+ *
+ * STALLS lists the ring newest first; decode the PCs with
+ * xtensa-esp32-elf-addr2line -pfiaC -e firmware.elf. STALL_SAMPLER=0
+ * (host build) has no timer or backtrace: a stall is charged to the
+ * phase that was running when the pass crossed the budget, nothing more.
+ */
+
+// ─────────────────────────────────────────────────────────────────────
+// CONFIGURATION
+// ─────────────────────────────────────────────────────────────────────
+
+#ifndef STALL_SAMPLER
+#ifdef HOST_BUILD
+#define STALL_SAMPLER 0
+#else
+#define STALL_SAMPLER 1
+#endif
+#endif
+
+#include <esp_system.h>
+#if STALL_SAMPLER
+#include <esp_timer.h>
+#include <esp_task_wdt.h>
+#include <esp_debug_helpers.h>
+#include <freertos/task_snapshot.h>
+#include <freertos/xtensa_context.h>
+#endif
+
+#define STALL_BUDGET_MS         300      // a loop() pass longer than this is a stall
+#define STALL_WDT_WARN_MS       4000     // task watchdog (enableLoopWDT) is 5 s
+#define STALL_RING              12
+#define STALL_DEPTH             8        // backtrace frames kept
+#define STALL_TASK_STACK        3072
+#define STALL_TASK_PRIORITY     5        // above loop() (1) on its core
+#define STALL_RTC_MAGIC         0x57A11ED5
+
+// ─────────────────────────────────────────────────────────────────────
+// RECORDS
+// ─────────────────────────────────────────────────────────────────────
+
+struct StallRecord {
+  uint32_t atMs;                // loop() pass start
+  uint32_t durationMs;          // 0 while still stalled
+  const char* phase;            // stallPhase() when sampled
+  uint8_t depth;
+  uint32_t pcs[STALL_DEPTH];    // pcs[0] = where loop() was
+};
+
+struct StallStats {
+  uint32_t passes;
+  uint32_t stalls;
+  uint32_t maxStallMs;
+  uint32_t samples;             // backtraces taken (budget + watchdog warning)
+  uint32_t wdtWarnings;
+  uint32_t wdtFires;
+};
+
+// Survives a watchdog/panic reset (not a power cycle)
+struct StallRtcRecord {
+  uint32_t magic;
+  uint32_t atMs;
+  uint32_t depth;
+  uint32_t pcs[STALL_DEPTH];
+  char phase[12];
+};
+
+StallRecord stallRing[STALL_RING];
+uint8_t stallNext = 0;
+StallStats stallStats;
+volatile int8_t stallOpen = -1;              // record of the pass in progress
+volatile bool stallArmed = false;
+volatile const char* stallPhaseName = "loop";
+uint32_t stallArmUs = 0;
+uint32_t stallArmMs = 0;
+
+RTC_NOINIT_ATTR StallRtcRecord stallRtc;
+StallRtcRecord stallPrevBoot;                // copied out at boot
+esp_reset_reason_t stallPrevReason = ESP_RST_UNKNOWN;
+
+#if STALL_SAMPLER
+esp_timer_handle_t stallTimer = nullptr;
+TaskHandle_t stallLoopTask = nullptr;
+TaskHandle_t stallSamplerTask = nullptr;
+volatile uint8_t stallSampleCount = 0;       // samples this pass: 1 budget, 2 warning
+#endif
+
+// ─────────────────────────────────────────────────────────────────────
+// SAMPLING
+// ─────────────────────────────────────────────────────────────────────
+
+// The open record; the sampler creates it on the first sample of a pass
+StallRecord& stallRecordOpen() {
+  if (stallOpen < 0) {
+    StallRecord& r = stallRing[stallNext];
+    memset(&r, 0, sizeof(r));
+    r.atMs = stallArmMs;
+    stallOpen = stallNext;
+    stallNext = (stallNext + 1) % STALL_RING;
+  }
+  return stallRing[stallOpen];
+}
+
+void stallRtcSave(const StallRecord& r) {
+  stallRtc.atMs = r.atMs;
+  stallRtc.depth = r.depth;
+  for (int i = 0; i < STALL_DEPTH; i++) stallRtc.pcs[i] = r.pcs[i];
+  strlcpy(stallRtc.phase, r.phase ? r.phase : "?", sizeof(stallRtc.phase));
+  stallRtc.magic = STALL_RTC_MAGIC;
+}
+
+void printStallRecord(const char* label, uint32_t atMs, uint32_t ms, const char* phase,
+                      uint8_t depth, const uint32_t* pcs) {
+  char dur[12];
+  if (ms) snprintf(dur, sizeof(dur), "%lu", (unsigned long)ms);
+  else snprintf(dur, sizeof(dur), "open");
+  Serial.printf("   %-12s %8lu ms %7s %-8s", label, (unsigned long)atMs, dur, phase);
+  for (int i = 0; i < depth; i++) Serial.printf(" 0x%08x", pcs[i]);
+  Serial.println();
+}
+
+#if STALL_SAMPLER
+// loop() is not running (we outrank it on its core): read its saved frame
+uint8_t stallBacktrace(uint32_t* pcs) {
+  TaskSnapshot_t snap;
+  vTaskGetSnapshot(stallLoopTask, &snap);
+  XtExcFrame* f = (XtExcFrame*)snap.pxTopOfStack;
+
+  esp_backtrace_frame_t frame;
+  if (f->exit) {
+    // Preempted: full exception frame
+    frame.pc = f->pc;
+    frame.sp = f->a1;
+    frame.next_pc = f->a0;
+  } else {
+    // Blocked (delay, notify wait, mutex): solicited frame
+    XtSolFrame* s = (XtSolFrame*)f;
+    frame.pc = s->pc;
+    frame.sp = s->a1;
+    frame.next_pc = s->a0;
+  }
+
+  uint8_t depth = 0;
+  pcs[depth++] = esp_cpu_process_stack_pc(frame.pc);
+  while (depth < STALL_DEPTH && frame.next_pc && esp_backtrace_get_next_frame(&frame)) {
+    if (!esp_ptr_executable((void*)esp_cpu_process_stack_pc(frame.pc))) break;
+    pcs[depth++] = esp_cpu_process_stack_pc(frame.pc);
+  }
+  return depth;
+}
+
+void stallSamplerLoop(void*) {
+  for (;;) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    if (!stallArmed) continue;   // the pass ended between the timer and us
+
+    StallRecord& r = stallRecordOpen();
+    r.phase = (const char*)stallPhaseName;
+    r.depth = stallBacktrace(r.pcs);
+    stallStats.samples++;
+    stallRtcSave(r);
+
+    if (stallSampleCount == 1) {
+      // Give the watchdog warning its own sample
+      esp_timer_start_once(stallTimer, (STALL_WDT_WARN_MS - STALL_BUDGET_MS) * 1000ULL);
+    } else {
+      stallStats.wdtWarnings++;
+      Serial.printf("\n⚠️  STALL: loop() blocked %u ms in %s - task watchdog at 5 s\n",
+                    (unsigned)((micros() - stallArmUs) / 1000), r.phase);
+      printStallRecord("Stuck at", r.atMs, 0, r.phase, r.depth, r.pcs);
+    }
+  }
+}
+
+void stallTimerFired(void*) {
+  stallSampleCount++;
+  xTaskNotifyGive(stallSamplerTask);
+}
+
+// Task watchdog ISR (weak hook in ESP-IDF): keep the stall for the next boot
+extern "C" void esp_task_wdt_isr_user_handler(void) {
+  stallStats.wdtFires++;
+  if (stallOpen >= 0) stallRtcSave(stallRing[stallOpen]);
+}
+#endif
+
+// ─────────────────────────────────────────────────────────────────────
+// LOOP HOOKS
+// ─────────────────────────────────────────────────────────────────────
+
+// No sampler: charge the stall to the phase that was running when the
+// pass crossed the budget, found when that phase ends
+void stallCheckPhase() {
+#if !STALL_SAMPLER
+  if (stallOpen < 0 && micros() - stallArmUs >= STALL_BUDGET_MS * 1000UL) {
+    stallRecordOpen().phase = (const char*)stallPhaseName;
+  }
+#endif
+}
+
+// What loop() is doing, for the record (string literals only)
+inline void stallPhase(const char* name) {
+  stallCheckPhase();
+  stallPhaseName = name;
+}
+
+void stallArm() {
+  stallArmUs = micros();
+  stallArmMs = millis();
+  stallPhaseName = "loop";
+  stallStats.passes++;
+#if STALL_SAMPLER
+  stallSampleCount = 0;
+  stallArmed = true;
+  if (stallTimer) esp_timer_start_once(stallTimer, STALL_BUDGET_MS * 1000ULL);
+#else
+  stallArmed = true;
+#endif
+}
+
+void stallDisarm() {
+#if STALL_SAMPLER
+  if (stallTimer) esp_timer_stop(stallTimer);
+#endif
+  stallArmed = false;
+  stallCheckPhase();
+  if (stallOpen < 0) return;
+  uint32_t ms = (micros() - stallArmUs) / 1000;
+
+  StallRecord& r = stallRing[stallOpen];
+  r.durationMs = ms ? ms : 1;
+  stallStats.stalls++;
+  if (ms > stallStats.maxStallMs) stallStats.maxStallMs = ms;
+  stallOpen = -1;
+  stallRtc.magic = 0;   // finished - nothing for the next boot
+}
+
+// ─────────────────────────────────────────────────────────────────────
+// SETUP + REPORT
+// ─────────────────────────────────────────────────────────────────────
+
+// From setup() (loop()'s task)
+void initStallDetector() {
+  stallPrevReason = esp_reset_reason();
+  bool crashed = stallPrevReason == ESP_RST_TASK_WDT || stallPrevReason == ESP_RST_INT_WDT ||
+                 stallPrevReason == ESP_RST_WDT || stallPrevReason == ESP_RST_PANIC;
+  if (crashed && stallRtc.magic == STALL_RTC_MAGIC) {
+    stallPrevBoot = stallRtc;
+    stallPrevBoot.phase[sizeof(stallPrevBoot.phase) - 1] = '\0';
+    Serial.printf("⚠️  Previous boot reset (reason %d) during a loop() stall in %s - see STALLS\n",
+                  (int)stallPrevReason, stallPrevBoot.phase);
+  }
+  stallRtc.magic = 0;
+
+#if STALL_SAMPLER
+  stallLoopTask = xTaskGetCurrentTaskHandle();
+  xTaskCreatePinnedToCore(stallSamplerLoop, "stall", STALL_TASK_STACK, nullptr,
+                          STALL_TASK_PRIORITY, &stallSamplerTask, xPortGetCoreID());
+  esp_timer_create_args_t args = {};
+  args.callback = stallTimerFired;
+  args.name = "stall";
+  esp_timer_create(&args, &stallTimer);
+  enableLoopWDT();   // the Arduino loop task feeds it between passes
+#endif
+}
+
+void resetStallStats() {
+  memset(&stallStats, 0, sizeof(stallStats));
+  memset(stallRing, 0, sizeof(stallRing));
+  stallNext = 0;
+  stallOpen = -1;
+}
+
+void printStallReport() {
+  const StallStats& s = stallStats;
+
+  Serial.println("\n━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━");
+  Serial.println("   LOOP STALLS");
+  Serial.println("━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━");
+  Serial.printf("   Budget:       %d ms per loop() pass, warning at %d ms, task watchdog 5 s\n",
+                STALL_BUDGET_MS, STALL_WDT_WARN_MS);
+  Serial.printf("   Sampler:      %s\n", STALL_SAMPLER ? "esp_timer + backtrace on loop()'s core" : "phase only (host)");
+  Serial.printf("   Passes:       %u, %u stalls, worst %u ms, %u samples\n",
+                s.passes, s.stalls, s.maxStallMs, s.samples);
+  Serial.printf("   Watchdog:     %u warnings, %u fired\n", s.wdtWarnings, s.wdtFires);
+
+  if (stallPrevBoot.magic == STALL_RTC_MAGIC) {
+    Serial.printf("   Last boot:    reset reason %d while stalled\n", (int)stallPrevReason);
+    printStallRecord("Prev boot", stallPrevBoot.atMs, 0, stallPrevBoot.phase,
+                     stallPrevBoot.depth, stallPrevBoot.pcs);
+  }
+
+  Serial.printf("   %-12s %11s %7s %-8s %s\n", "Stall", "At", "ms", "Phase", "Backtrace");
+  for (int i = 1; i <= STALL_RING; i++) {
+    const StallRecord& r = stallRing[(stallNext + STALL_RING - i) % STALL_RING];
+    if (!r.phase) continue;
+    char label[8];
+    snprintf(label, sizeof(label), "#%d", i);
+    printStallRecord(label, r.atMs, r.durationMs, r.phase, r.depth, r.pcs);
+  }
+  if (STALL_SAMPLER) Serial.println("   Decode PCs with xtensa-esp32-elf-addr2line -pfiaC -e firmware.elf");
+  Serial.println("━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━\n");
+}
+
+#endif // STALL_DETECTOR_H
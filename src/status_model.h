@@ -0,0 +1,136 @@
+#ifndef STATUS_MODEL_H
+#define STATUS_MODEL_H
+
+/*
+ * ═══════════════════════════════════════════════════════════════════════
+ * BLACKROAD STATUS MODEL - every state as a one-byte enum
+ * ═══════════════════════════════════════════════════════════════════════
+ *
+ * Mesh nodes, stack components, the AI endpoint and hot leads all report
+ * their state as text ("active", "degraded", "Evaluating"). Keeping that
+ * text meant a char array per field in every nav snapshot copy and a
+ * strcmp chain wherever it was compared or coloured.
+ *
+ * Each state is parsed once at ingest (fetcher or health check) into an
+ * enum. Everything after that - change detection, counting, colouring,
+ * printing - is a compare or an index into one of the flash tables here:
+ *
+ *   XXX_NAMES[s]     display / log text
+ *   XXX_COLORS[s]    draw colour (include after the COLOR_* defines)
+ *
+ * Parsers are case-insensitive and map anything unrecognised to the
+ * enum's UNKNOWN value, so every value stays a valid table index.
+ */
+
+#include <Arduino.h>
+
+// ─────────────────────────────────────────────────────────────────────
+// PARSER
+// ─────────────────────────────────────────────────────────────────────
+
+// Index of `s` in names[0..count), `fallback` if absent or nullptr
+inline uint8_t parseStatus(const char* s, const char* const* names, uint8_t count, uint8_t fallback) {
+  if (!s) return fallback;
+  for (uint8_t i = 0; i < count; i++) {
+    if (!strcasecmp(s, names[i])) return i;
+  }
+  return fallback;
+}
+
+// ─────────────────────────────────────────────────────────────────────
+// MESH NODES (dynamic_nav.h)
+// ─────────────────────────────────────────────────────────────────────
+
+enum NodeStatus : uint8_t {
+  NODE_UNKNOWN,
+  NODE_ACTIVE,
+  NODE_IDLE,
+  NODE_OFFLINE,
+  NODE_STATUS_COUNT
+};
+
+const char* const NODE_STATUS_NAMES[NODE_STATUS_COUNT] = { "unknown", "active", "idle", "offline" };
+
+const uint16_t NODE_STATUS_COLORS[NODE_STATUS_COUNT] = {
+  COLOR_WHITE, COLOR_VIVID_PUR, COLOR_SUNRISE, COLOR_HOT_PINK,
+};
+
+inline NodeStatus parseNodeStatus(const char* s) {
+  return (NodeStatus)parseStatus(s, NODE_STATUS_NAMES, NODE_STATUS_COUNT, NODE_UNKNOWN);
+}
+
+// ─────────────────────────────────────────────────────────────────────
+// STACK COMPONENTS (sovereign_stack.h)
+// ─────────────────────────────────────────────────────────────────────
+
+enum ComponentStatus : uint8_t {
+  COMP_UNKNOWN,
+  COMP_ACTIVE,
+  COMP_DEGRADED,
+  COMP_OFFLINE,
+  COMP_STATUS_COUNT
+};
+
+const char* const COMPONENT_STATUS_NAMES[COMP_STATUS_COUNT] = { "unknown", "active", "degraded", "offline" };
+
+const uint16_t COMPONENT_STATUS_COLORS[COMP_STATUS_COUNT] = {
+  COLOR_DARK_GRAY, COLOR_VIVID_PUR, COLOR_SUNRISE, COLOR_HOT_PINK,
+};
+
+// ─────────────────────────────────────────────────────────────────────
+// AI ENDPOINT (dynamic_nav.h)
+// ─────────────────────────────────────────────────────────────────────
+
+enum AIStatus : uint8_t {
+  AI_UNKNOWN,
+  AI_RUNNING,
+  AI_IDLE,
+  AI_LOADING,
+  AI_STATUS_COUNT
+};
+
+const char* const AI_STATUS_NAMES[AI_STATUS_COUNT] = { "unknown", "running", "idle", "loading" };
+
+inline AIStatus parseAIStatus(const char* s) {
+  return (AIStatus)parseStatus(s, AI_STATUS_NAMES, AI_STATUS_COUNT, AI_UNKNOWN);
+}
+
+// ─────────────────────────────────────────────────────────────────────
+// HOT LEADS (dynamic_nav.h)
+// ─────────────────────────────────────────────────────────────────────
+
+enum LeadTemperature : uint8_t {
+  TEMP_UNKNOWN,
+  TEMP_COLD,
+  TEMP_WARM,
+  TEMP_HOT,
+  TEMP_BURNING,
+  TEMP_COUNT
+};
+
+const char* const LEAD_TEMPERATURE_NAMES[TEMP_COUNT] = { "unknown", "cold", "warm", "hot", "burning" };
+
+inline LeadTemperature parseLeadTemperature(const char* s) {
+  return (LeadTemperature)parseStatus(s, LEAD_TEMPERATURE_NAMES, TEMP_COUNT, TEMP_UNKNOWN);
+}
+
+// Funnel order; shown on the hot-leads cards as-is
+enum LeadStage : uint8_t {
+  STAGE_UNKNOWN,
+  STAGE_AWARE,
+  STAGE_CURIOUS,
+  STAGE_EVALUATING,
+  STAGE_READY,
+  STAGE_CUSTOMER,
+  STAGE_COUNT
+};
+
+const char* const LEAD_STAGE_NAMES[STAGE_COUNT] = {
+  "Unknown", "Aware", "Curious", "Evaluating", "Ready", "Customer",
+};
+
+inline LeadStage parseLeadStage(const char* s) {
+  return (LeadStage)parseStatus(s, LEAD_STAGE_NAMES, STAGE_COUNT, STAGE_UNKNOWN);
+}
+
+#endif // STATUS_MODEL_H
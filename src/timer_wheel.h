@@ -0,0 +1,295 @@
+#ifndef TIMER_WHEEL_H
+#define TIMER_WHEEL_H
+
+/*
+ * ═══════════════════════════════════════════════════════════════════════
+ * BLACKROAD TIMER WHEEL - periodic + deferred work for loop()
+ * ═══════════════════════════════════════════════════════════════════════
+ *
+ * Hierarchical wheel with 1 ms ticks, 4 levels of 64 slots:
+ *
+ *   level 0    1 ms slots       due within 64 ms
+ *   level 1   64 ms slots       due within 4.1 s
+ *   level 2  4.1 s slots        due within 4.4 min
+ *   level 3  4.4 min slots      due within 4.7 h
+ *
+ * Insert and cancel are O(1) (doubly linked slot lists). Each level keeps
+ * a 64-bit occupancy mask, so the next tick with work on it is a rotate +
+ * count-trailing-zeros per level: timerService() jumps straight from one
+ * busy tick to the next instead of walking every millisecond, and loop()
+ * can sleep exactly until timerUsUntilNext(). When a level's slot comes
+ * up its timers cascade one level down with their exact deadline.
+ *
+ * Callbacks run from loop() (timerService), never from an ISR. Lateness
+ * (firing time - deadline) is kept per timer; TIMERS prints it together
+ * with loop() idle time.
+ */
+
+// ─────────────────────────────────────────────────────────────────────
+// CONFIGURATION
+// ─────────────────────────────────────────────────────────────────────
+
+#define TIMER_MAX          16
+#define TIMER_LEVELS       4
+#define TIMER_SLOT_BITS    6
+#define TIMER_SLOTS        (1 << TIMER_SLOT_BITS)
+#define TIMER_MAX_DELTA    ((1UL << (TIMER_SLOT_BITS * TIMER_LEVELS)) - 1)
+#define TIMER_EXPIRED      TIMER_LEVELS   // pseudo level: detached, firing this tick
+
+typedef void (*TimerFn)(int arg);
+
+// ─────────────────────────────────────────────────────────────────────
+// TIMERS
+// ─────────────────────────────────────────────────────────────────────
+
+struct Timer {
+  bool active;
+  uint8_t level;        // 0..3, TIMER_EXPIRED
+  uint8_t slot;
+  int8_t prev, next;    // slot list, -1 = end
+  uint32_t dueMs;
+  uint32_t periodMs;    // 0 = one-shot
+  TimerFn fn;
+  int arg;
+  const char* name;
+  uint32_t fires;
+  uint32_t missed;      // periods skipped because loop() was busy
+  uint32_t lateSumUs;
+  uint32_t maxLateUs;
+};
+
+struct TimerWheelStats {
+  uint32_t fires;
+  uint32_t cascades;    // timers moved down a level
+  uint32_t busyTicks;   // ticks that had work (the rest are skipped)
+  uint32_t full;        // timerEvery/After with no free timer
+  uint32_t lateSumUs;
+  uint32_t maxLateUs;
+};
+
+Timer timers[TIMER_MAX];
+int8_t timerSlots[TIMER_LEVELS + 1][TIMER_SLOTS];   // list heads, -1 = empty
+uint64_t timerOccupied[TIMER_LEVELS];
+uint32_t timerWheelNow = 0;                          // last tick processed
+bool timerWheelReady = false;
+TimerWheelStats timerStats;
+
+// ─────────────────────────────────────────────────────────────────────
+// SLOT LISTS
+// ─────────────────────────────────────────────────────────────────────
+
+void timerUnlink(int8_t id) {
+  Timer& t = timers[id];
+  if (t.prev >= 0) timers[t.prev].next = t.next;
+  else timerSlots[t.level][t.slot] = t.next;
+  if (t.next >= 0) timers[t.next].prev = t.prev;
+  if (t.level < TIMER_LEVELS && timerSlots[t.level][t.slot] < 0) {
+    timerOccupied[t.level] &= ~(1ULL << t.slot);
+  }
+}
+
+void timerLink(int8_t id, uint8_t level, uint8_t slot) {
+  Timer& t = timers[id];
+  t.level = level;
+  t.slot = slot;
+  t.prev = -1;
+  t.next = timerSlots[level][slot];
+  if (t.next >= 0) timers[t.next].prev = id;
+  timerSlots[level][slot] = id;
+  if (level < TIMER_LEVELS) timerOccupied[level] |= 1ULL << slot;
+}
+
+// Place by distance from `base`, the first tick not yet processed;
+// overdue timers fire on `base`
+void timerPlace(int8_t id, uint32_t base) {
+  uint32_t tick = timers[id].dueMs;
+  uint32_t delta = tick - base;
+  if ((int32_t)delta < 0) {
+    delta = 0;
+    tick = base;
+  } else if (delta > TIMER_MAX_DELTA) {
+    delta = TIMER_MAX_DELTA;   // parks on level 3 and cascades again later
+    tick = base + TIMER_MAX_DELTA;
+  }
+
+  uint8_t level = 0;
+  while (level < TIMER_LEVELS - 1 && delta >= (1UL << (TIMER_SLOT_BITS * (level + 1)))) level++;
+  timerLink(id, level, (tick >> (TIMER_SLOT_BITS * level)) & (TIMER_SLOTS - 1));
+}
+
+void timerWheelInit() {
+  memset(timerSlots, -1, sizeof(timerSlots));
+  memset(timerOccupied, 0, sizeof(timerOccupied));
+  timerWheelNow = millis();
+  timerWheelReady = true;
+}
+
+// ─────────────────────────────────────────────────────────────────────
+// API
+// ─────────────────────────────────────────────────────────────────────
+
+int8_t timerStart(uint32_t delayMs, uint32_t periodMs, TimerFn fn, const char* name, int arg) {
+  if (!timerWheelReady) timerWheelInit();
+  for (int8_t id = 0; id < TIMER_MAX; id++) {
+    Timer& t = timers[id];
+    if (t.active) continue;
+    memset(&t, 0, sizeof(t));
+    t.active = true;
+    t.dueMs = millis() + delayMs;
+    t.periodMs = periodMs;
+    t.fn = fn;
+    t.arg = arg;
+    t.name = name;
+    timerPlace(id, timerWheelNow + 1);
+    return id;
+  }
+  timerStats.full++;
+  return -1;
+}
+
+// Run `fn` every `periodMs`, first time one period from now
+int8_t timerEvery(uint32_t periodMs, TimerFn fn, const char* name, int arg = 0) {
+  return timerStart(periodMs, periodMs, fn, name, arg);
+}
+
+// Run `fn` once, `delayMs` from now
+int8_t timerAfter(uint32_t delayMs, TimerFn fn, const char* name, int arg = 0) {
+  return timerStart(delayMs, 0, fn, name, arg);
+}
+
+void timerCancel(int8_t id) {
+  if (id < 0 || id >= TIMER_MAX || !timers[id].active) return;
+  timerUnlink(id);
+  timers[id].active = false;
+}
+
+// ─────────────────────────────────────────────────────────────────────
+// EXPIRY
+// ─────────────────────────────────────────────────────────────────────
+
+inline uint64_t timerRotr(uint64_t v, uint8_t n) {
+  return n ? (v >> n) | (v << (64 - n)) : v;
+}
+
+// Next tick after timerWheelNow at which `level` has a slot to process
+bool timerLevelNext(uint8_t level, uint32_t& tick) {
+  if (!timerOccupied[level]) return false;
+  uint8_t shift = TIMER_SLOT_BITS * level;
+  uint32_t first = ((timerWheelNow >> shift) + 1) << shift;   // next slot boundary
+  uint64_t ahead = timerRotr(timerOccupied[level], (first >> shift) & (TIMER_SLOTS - 1));
+  tick = first + ((uint32_t)__builtin_ctzll(ahead) << shift);
+  return true;
+}
+
+bool timerNextTick(uint32_t& tick) {
+  bool found = false;
+  for (uint8_t level = 0; level < TIMER_LEVELS; level++) {
+    uint32_t t;
+    if (!timerLevelNext(level, t)) continue;
+    if (!found || (int32_t)(t - tick) < 0) tick = t;
+    found = true;
+  }
+  return found;
+}
+
+void timerFire(int8_t id) {
+  Timer& t = timers[id];
+  uint32_t late = micros() - t.dueMs * 1000UL;
+  t.fires++;
+  t.lateSumUs += late;
+  if (late > t.maxLateUs) t.maxLateUs = late;
+  timerStats.fires++;
+  timerStats.lateSumUs += late;
+  if (late > timerStats.maxLateUs) timerStats.maxLateUs = late;
+
+  if (t.periodMs) {
+    // Keep the phase; periods loop() slept through are skipped, not replayed
+    t.dueMs += t.periodMs;
+    while ((int32_t)(t.dueMs - timerWheelNow) <= 0) {
+      t.dueMs += t.periodMs;
+      t.missed++;
+    }
+    timerPlace(id, timerWheelNow + 1);
+  } else {
+    t.active = false;
+  }
+  t.fn(t.arg);
+}
+
+void timerProcessTick(uint32_t tick) {
+  timerStats.busyTicks++;
+
+  // Higher levels first, so their timers can land in this tick's level-0 slot
+  for (uint8_t level = TIMER_LEVELS - 1; level >= 1; level--) {
+    uint8_t shift = TIMER_SLOT_BITS * level;
+    if (tick & ((1UL << shift) - 1)) continue;
+    uint8_t slot = (tick >> shift) & (TIMER_SLOTS - 1);
+    int8_t id;
+    while ((id = timerSlots[level][slot]) >= 0) {
+      timerUnlink(id);
+      timerPlace(id, tick);
+      timerStats.cascades++;
+    }
+  }
+
+  // Detach the due slot first: callbacks may start or cancel timers
+  timerWheelNow = tick;
+  uint8_t slot = tick & (TIMER_SLOTS - 1);
+  int8_t id;
+  while ((id = timerSlots[0][slot]) >= 0) {
+    timerUnlink(id);
+    timerLink(id, TIMER_EXPIRED, 0);
+  }
+  while ((id = timerSlots[TIMER_EXPIRED][0]) >= 0) {
+    timerUnlink(id);
+    timerFire(id);
+  }
+}
+
+// Fire everything due by now; called once per loop() pass
+void timerService() {
+  if (!timerWheelReady) return;
+  uint32_t now = millis();
+  uint32_t tick;
+  while (timerNextTick(tick) && (int32_t)(tick - now) <= 0) timerProcessTick(tick);
+  if ((int32_t)(now - timerWheelNow) > 0) timerWheelNow = now;
+}
+
+// µs until the next busy tick, -1 if none. A lower bound on the next
+// deadline: a cascade tick may come first, but no timer is due before it
+int32_t timerUsUntilNext() {
+  uint32_t tick;
+  if (!timerWheelReady || !timerNextTick(tick)) return -1;
+  int32_t us = (int32_t)(tick * 1000UL - micros());
+  return us > 0 ? us : 0;
+}
+
+// ─────────────────────────────────────────────────────────────────────
+// REPORT
+// ─────────────────────────────────────────────────────────────────────
+
+void resetTimerStats() {
+  memset(&timerStats, 0, sizeof(timerStats));
+  for (int i = 0; i < TIMER_MAX; i++) {
+    timers[i].fires = timers[i].missed = 0;
+    timers[i].lateSumUs = timers[i].maxLateUs = 0;
+  }
+}
+
+void printTimerList() {
+  uint32_t now = millis();
+  Serial.printf("   %-16s %8s %8s %6s %8s %8s\n", "Timer", "Period", "Next", "Fires", "Late avg", "Late max");
+  for (int i = 0; i < TIMER_MAX; i++) {
+    const Timer& t = timers[i];
+    if (!t.active && !t.fires) continue;
+    char period[16], next[16];
+    if (t.periodMs) snprintf(period, sizeof(period), "%lums", (unsigned long)t.periodMs);
+    else snprintf(period, sizeof(period), "once");
+    if (t.active) snprintf(next, sizeof(next), "%ldms", (long)(int32_t)(t.dueMs - now));
+    else snprintf(next, sizeof(next), "done");
+    Serial.printf("   %-16s %8s %8s %6u %6uus %6uus\n", t.name, period, next, t.fires,
+                  t.fires ? t.lateSumUs / t.fires : 0, t.maxLateUs);
+  }
+}
+
+#endif // TIMER_WHEEL_H
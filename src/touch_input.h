@@ -0,0 +1,415 @@
+#ifndef TOUCH_INPUT_H
+#define TOUCH_INPUT_H
+
+/*
+ * ═══════════════════════════════════════════════════════════════════════
+ * BLACKROAD TOUCH INPUT - IRQ-driven XPT2046 sampler + event queue
+ * ═══════════════════════════════════════════════════════════════════════
+ *
+ * PENIRQ (GPIO36) wakes a sampler task on core 0, which reads the XPT2046
+ * every TOUCH_SAMPLE_PERIOD_MS while the pen is down:
+ *
+ * - Each round oversamples X/Y and takes the median, rejects rounds whose
+ *   spread or pressure (Z1/Z2) says "noise", then smooths with an IIR
+ * - Accepted rounds become DOWN/MOVE/UP events with micros() stamps
+ * - Events go through a single-producer/single-consumer ring; the UI
+ *   drains it in handleTouch() and never waits on the controller
+ *
+ * Touch is on its own SPI bus (VSPI), so the task never contends with the
+ * display. TOUCH_SAMPLER_TASK=0 (host build) runs the same sampler from
+ * touchService() in loop() instead of a task.
+ *
+ * Expects XPT2046_* pins and touchSPI from main.cpp.
+ */
+
+#include <atomic>
+
+// ─────────────────────────────────────────────────────────────────────
+// CONFIGURATION
+// ─────────────────────────────────────────────────────────────────────
+
+#ifndef TOUCH_SAMPLER_TASK
+#ifdef HOST_BUILD
+#define TOUCH_SAMPLER_TASK 0
+#else
+#define TOUCH_SAMPLER_TASK 1
+#endif
+#endif
+
+#define TOUCH_SAMPLE_PERIOD_MS  5     // 200 Hz while the pen is down
+#define TOUCH_OVERSAMPLE        5     // reads per axis per round (median)
+#define TOUCH_MAX_SPREAD        120   // raw counts between 2nd and 4th of 5
+#define TOUCH_MIN_PRESSURE      300   // Z = Z1 + 4095 - Z2
+#define TOUCH_RELEASE_ROUNDS    2     // bad rounds with pen still down before UP
+#define TOUCH_QUEUE_SIZE        32
+#define TOUCH_TASK_STACK        3072
+#define TOUCH_TASK_PRIORITY     3
+#define TOUCH_TASK_CORE         0     // Arduino loop() runs on core 1
+#define TOUCH_WAKE_BIT          0x01  // notification bit set on touchWakeTask
+
+#define XPT_READ_X   0x90
+#define XPT_READ_Y   0xD0
+#define XPT_READ_Z1  0xB0
+#define XPT_READ_Z2  0xC0
+
+// ─────────────────────────────────────────────────────────────────────
+// EVENTS + SPSC QUEUE
+// ─────────────────────────────────────────────────────────────────────
+
+enum TouchEventType : uint8_t {
+  TOUCH_DOWN,
+  TOUCH_MOVE,
+  TOUCH_UP
+};
+
+struct TouchEvent {
+  TouchEventType type;
+  int16_t x, y;       // screen coordinates (landscape)
+  uint16_t z;         // pressure, 0 on UP
+  uint32_t us;        // micros() of the sampling round
+  uint32_t irqUs;     // PENIRQ edge that started the stroke
+};
+
+TouchEvent touchQueue[TOUCH_QUEUE_SIZE];
+std::atomic<uint8_t> touchQueueHead(0);   // written by the sampler only
+std::atomic<uint8_t> touchQueueTail(0);   // written by the UI only
+
+// ─────────────────────────────────────────────────────────────────────
+// STATS
+// ─────────────────────────────────────────────────────────────────────
+
+// Written by the sampler
+struct TouchSamplerStats {
+  uint32_t irqs;             // PENIRQ falling edges
+  uint32_t rounds;           // sampling rounds (each = 2*N + 2 conversions)
+  uint32_t penPeriods;       // pen-down periods seen by the sampler
+  uint32_t strokes;          // periods that produced a DOWN
+  uint32_t falseTouches;     // periods with no accepted round
+  uint32_t rejectedNoise;    // rounds rejected for X/Y spread
+  uint32_t rejectedPressure; // rounds rejected for low Z
+  uint32_t overflows;        // events dropped with the queue full
+  uint32_t intervals;        // round-to-round gaps measured inside strokes
+  uint32_t jitterSumUs;
+  uint32_t maxJitterUs;
+  uint32_t irqToDownSumUs;   // PENIRQ edge -> first DOWN event
+  uint32_t irqToDownMaxUs;
+};
+
+// Written by the UI
+struct TouchHandlerStats {
+  uint32_t events;
+  uint32_t latencySumUs;     // event stamp -> dequeued by handleTouch()
+  uint32_t maxLatencyUs;
+};
+
+TouchSamplerStats touchSamplerStats;
+TouchHandlerStats touchHandlerStats;
+
+// ─────────────────────────────────────────────────────────────────────
+// SAMPLER STATE (sampler context only)
+// ─────────────────────────────────────────────────────────────────────
+
+volatile uint32_t touchIrqUs = 0;
+volatile bool touchIrqFlag = false;
+
+bool touchPenPeriod = false;   // IRQ low since the last pen-up
+bool touchDown = false;        // DOWN emitted, UP not yet
+int32_t touchFiltX = 0;        // IIR state, screen px << 4
+int32_t touchFiltY = 0;
+int16_t touchLastX = 0;
+int16_t touchLastY = 0;
+uint8_t touchBadRounds = 0;
+uint32_t touchLastRoundUs = 0;
+
+#if TOUCH_SAMPLER_TASK
+TaskHandle_t touchTaskHandle = nullptr;
+TaskHandle_t touchWakeTask = nullptr;   // notified per event (loop() may sleep)
+#endif
+
+void IRAM_ATTR touchIrqHandler() {
+  touchIrqUs = micros();
+  touchIrqFlag = true;
+  touchSamplerStats.irqs++;
+#if TOUCH_SAMPLER_TASK
+  BaseType_t woken = pdFALSE;
+  if (touchTaskHandle) vTaskNotifyGiveFromISR(touchTaskHandle, &woken);
+  if (woken) portYIELD_FROM_ISR();
+#endif
+}
+
+// PENIRQ went low during light sleep, so the edge interrupt never fired
+void touchWakeKick() {
+  touchIrqUs = micros();
+  touchIrqFlag = true;
+  touchSamplerStats.irqs++;
+#if TOUCH_SAMPLER_TASK
+  if (touchTaskHandle) xTaskNotifyGive(touchTaskHandle);
+#endif
+}
+
+uint8_t touchQueueFree() {
+  uint8_t head = touchQueueHead.load(std::memory_order_relaxed);
+  uint8_t tail = touchQueueTail.load(std::memory_order_acquire);
+  return (uint8_t)(TOUCH_QUEUE_SIZE - 1 - (uint8_t)(head - tail + TOUCH_QUEUE_SIZE) % TOUCH_QUEUE_SIZE);
+}
+
+bool touchQueuePush(const TouchEvent& e) {
+  // Keep the last slot for UP so a stalled UI never misses a release
+  if (touchQueueFree() < (e.type == TOUCH_MOVE ? 2 : 1)) {
+    touchSamplerStats.overflows++;
+    return false;
+  }
+  uint8_t head = touchQueueHead.load(std::memory_order_relaxed);
+  touchQueue[head] = e;
+  touchQueueHead.store((uint8_t)((head + 1) % TOUCH_QUEUE_SIZE), std::memory_order_release);
+  return true;
+}
+
+// ─────────────────────────────────────────────────────────────────────
+// XPT2046 READS
+// ─────────────────────────────────────────────────────────────────────
+
+uint16_t touchReadChannel(uint8_t command) {
+  touchSPI.transfer(command);
+  return touchSPI.transfer16(0x0000) >> 3;
+}
+
+// Insertion sort - N is the oversample count, so tiny
+void touchSort(uint16_t* v, int n) {
+  for (int i = 1; i < n; i++) {
+    uint16_t key = v[i];
+    int j = i - 1;
+    while (j >= 0 && v[j] > key) { v[j + 1] = v[j]; j--; }
+    v[j + 1] = key;
+  }
+}
+
+struct TouchRaw {
+  uint16_t x, y, z;
+};
+
+// One round: N reads per axis plus pressure. false = reject the round.
+bool touchReadRound(TouchRaw& raw) {
+  uint16_t xs[TOUCH_OVERSAMPLE], ys[TOUCH_OVERSAMPLE];
+
+  touchSPI.beginTransaction(SPISettings(2000000, MSBFIRST, SPI_MODE0));
+  digitalWrite(XPT2046_CS, LOW);
+  uint16_t z1 = touchReadChannel(XPT_READ_Z1);
+  uint16_t z2 = touchReadChannel(XPT_READ_Z2);
+  for (int i = 0; i < TOUCH_OVERSAMPLE; i++) {
+    xs[i] = touchReadChannel(XPT_READ_X);
+    ys[i] = touchReadChannel(XPT_READ_Y);
+  }
+  digitalWrite(XPT2046_CS, HIGH);
+  touchSPI.endTransaction();
+
+  int z = (int)z1 + 4095 - (int)z2;
+  if (z1 == 0 || z < TOUCH_MIN_PRESSURE) {
+    touchSamplerStats.rejectedPressure++;
+    return false;
+  }
+
+  touchSort(xs, TOUCH_OVERSAMPLE);
+  touchSort(ys, TOUCH_OVERSAMPLE);
+  // Inner spread ignores one outlier on each side
+  int lo = TOUCH_OVERSAMPLE / 4, hi = TOUCH_OVERSAMPLE - 1 - TOUCH_OVERSAMPLE / 4;
+  if (xs[hi] - xs[lo] > TOUCH_MAX_SPREAD || ys[hi] - ys[lo] > TOUCH_MAX_SPREAD) {
+    touchSamplerStats.rejectedNoise++;
+    return false;
+  }
+
+  raw.x = xs[TOUCH_OVERSAMPLE / 2];
+  raw.y = ys[TOUCH_OVERSAMPLE / 2];
+  raw.z = (uint16_t)constrain(z, 0, 4095);
+  return true;
+}
+
+// LANDSCAPE rotation 1: raw Y becomes X, raw X becomes inverted Y
+void touchRawToScreen(const TouchRaw& raw, int& x, int& y) {
+  x = constrain(map(raw.y, 200, 3700, 0, 320), 0, 320);
+  y = constrain(map(raw.x, 3700, 200, 0, 240), 0, 240);
+}
+
+// ─────────────────────────────────────────────────────────────────────
+// SAMPLER
+// ─────────────────────────────────────────────────────────────────────
+
+void touchEmit(TouchEventType type, uint16_t z, uint32_t us) {
+  TouchEvent e;
+  e.type = type;
+  e.x = touchLastX;
+  e.y = touchLastY;
+  e.z = z;
+  e.us = us;
+  e.irqUs = touchIrqUs;
+  touchQueuePush(e);
+#if TOUCH_SAMPLER_TASK
+  if (touchWakeTask) xTaskNotify(touchWakeTask, TOUCH_WAKE_BIT, eSetBits);
+#endif
+}
+
+void touchPenUp(uint32_t now) {
+  if (touchDown) {
+    touchEmit(TOUCH_UP, 0, now);
+  } else if (touchPenPeriod) {
+    touchSamplerStats.falseTouches++;
+  }
+  touchDown = false;
+  touchPenPeriod = false;
+  touchBadRounds = 0;
+}
+
+// One sampling round. Returns true while a touch is in progress.
+bool touchSampleRound() {
+  uint32_t now = micros();
+  bool penDown = digitalRead(XPT2046_IRQ) == LOW;
+
+  if (!penDown) {
+    touchPenUp(now);
+    return false;
+  }
+
+  if (!touchPenPeriod) {
+    touchPenPeriod = true;
+    touchSamplerStats.penPeriods++;
+    if (!touchIrqFlag) touchIrqUs = now;   // edge missed or no ISR
+  } else if (touchDown) {
+    uint32_t gap = now - touchLastRoundUs;
+    uint32_t period = TOUCH_SAMPLE_PERIOD_MS * 1000UL;
+    uint32_t jitter = gap > period ? gap - period : period - gap;
+    touchSamplerStats.intervals++;
+    touchSamplerStats.jitterSumUs += jitter;
+    if (jitter > touchSamplerStats.maxJitterUs) touchSamplerStats.maxJitterUs = jitter;
+  }
+  touchIrqFlag = false;
+  touchLastRoundUs = now;
+  touchSamplerStats.rounds++;
+
+  TouchRaw raw;
+  int x = 0, y = 0;
+  bool good = touchReadRound(raw);
+  if (good) {
+    touchRawToScreen(raw, x, y);
+    good = !(x == 0 && y == 0);   // (0,0) ghost from the controller
+  }
+
+  if (!good) {
+    if (touchDown && ++touchBadRounds >= TOUCH_RELEASE_ROUNDS) touchPenUp(now);
+    return true;
+  }
+  touchBadRounds = 0;
+
+  if (!touchDown) {
+    touchDown = true;
+    touchFiltX = x << 4;
+    touchFiltY = y << 4;
+    touchLastX = x;
+    touchLastY = y;
+    touchSamplerStats.strokes++;
+    uint32_t irqToDown = now - touchIrqUs;
+    touchSamplerStats.irqToDownSumUs += irqToDown;
+    if (irqToDown > touchSamplerStats.irqToDownMaxUs) touchSamplerStats.irqToDownMaxUs = irqToDown;
+    touchEmit(TOUCH_DOWN, raw.z, now);
+    return true;
+  }
+
+  // IIR, alpha 1/2: steadies a held finger, one round of lag on drags
+  touchFiltX += ((x << 4) - touchFiltX) / 2;
+  touchFiltY += ((y << 4) - touchFiltY) / 2;
+  int16_t fx = (int16_t)((touchFiltX + 8) >> 4);
+  int16_t fy = (int16_t)((touchFiltY + 8) >> 4);
+  if (fx != touchLastX || fy != touchLastY) {
+    touchLastX = fx;
+    touchLastY = fy;
+    touchEmit(TOUCH_MOVE, raw.z, now);
+  }
+  return true;
+}
+
+#if TOUCH_SAMPLER_TASK
+void touchSamplerTask(void*) {
+  for (;;) {
+    // Sleep until PENIRQ; the timeout catches an edge lost to a glitch
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(100));
+    if (digitalRead(XPT2046_IRQ) != LOW) continue;
+
+    TickType_t wake = xTaskGetTickCount();
+    while (touchSampleRound()) {
+      vTaskDelayUntil(&wake, pdMS_TO_TICKS(TOUCH_SAMPLE_PERIOD_MS));
+    }
+  }
+}
+#endif
+
+// ─────────────────────────────────────────────────────────────────────
+// UI SIDE
+// ─────────────────────────────────────────────────────────────────────
+
+void resetTouchStats() {
+  memset(&touchSamplerStats, 0, sizeof(touchSamplerStats));
+  memset(&touchHandlerStats, 0, sizeof(touchHandlerStats));
+}
+
+void initTouchInput() {
+  resetTouchStats();
+  attachInterrupt(digitalPinToInterrupt(XPT2046_IRQ), touchIrqHandler, FALLING);
+#if TOUCH_SAMPLER_TASK
+  xTaskCreatePinnedToCore(touchSamplerTask, "touch", TOUCH_TASK_STACK, nullptr,
+                          TOUCH_TASK_PRIORITY, &touchTaskHandle, TOUCH_TASK_CORE);
+#endif
+}
+
+// Without the task, loop() drives the sampler at the same period
+void touchService() {
+#if !TOUCH_SAMPLER_TASK
+  static uint32_t nextRoundUs = 0;
+  bool active = touchDown || touchPenPeriod || touchIrqFlag || digitalRead(XPT2046_IRQ) == LOW;
+  if (!active || (int32_t)(micros() - nextRoundUs) < 0) return;
+  nextRoundUs = micros() + TOUCH_SAMPLE_PERIOD_MS * 1000UL;
+  touchSampleRound();
+#endif
+}
+
+bool touchEventsPending() {
+  return touchQueueTail.load(std::memory_order_relaxed) != touchQueueHead.load(std::memory_order_acquire);
+}
+
+bool touchNextEvent(TouchEvent& e) {
+  uint8_t tail = touchQueueTail.load(std::memory_order_relaxed);
+  if (tail == touchQueueHead.load(std::memory_order_acquire)) return false;
+  e = touchQueue[tail];
+  touchQueueTail.store((uint8_t)((tail + 1) % TOUCH_QUEUE_SIZE), std::memory_order_release);
+
+  uint32_t latency = micros() - e.us;
+  touchHandlerStats.events++;
+  touchHandlerStats.latencySumUs += latency;
+  if (latency > touchHandlerStats.maxLatencyUs) touchHandlerStats.maxLatencyUs = latency;
+  return true;
+}
+
+void printTouchReport() {
+  const TouchSamplerStats& s = touchSamplerStats;
+  const TouchHandlerStats& h = touchHandlerStats;
+  uint32_t avgJitter = s.intervals ? s.jitterSumUs / s.intervals : 0;
+  uint32_t avgIrq = s.strokes ? s.irqToDownSumUs / s.strokes : 0;
+  uint32_t avgLatency = h.events ? h.latencySumUs / h.events : 0;
+  float falseRate = s.penPeriods ? s.falseTouches * 100.0 / s.penPeriods : 0;
+
+  Serial.println("\n━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━");
+  Serial.println("   TOUCH INPUT");
+  Serial.println("━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━");
+  Serial.printf("   Sampler:      %s, %d ms period, %dx oversample\n",
+                TOUCH_SAMPLER_TASK ? "task (core 0)" : "loop()", TOUCH_SAMPLE_PERIOD_MS, TOUCH_OVERSAMPLE);
+  Serial.printf("   IRQ edges:    %u\n", s.irqs);
+  Serial.printf("   Rounds:       %u (%u noisy, %u low Z rejected)\n",
+                s.rounds, s.rejectedNoise, s.rejectedPressure);
+  Serial.printf("   Touches:      %u strokes, %u false (%.1f%%)\n", s.strokes, s.falseTouches, falseRate);
+  Serial.printf("   Jitter:       %u us avg, %u us max\n", avgJitter, s.maxJitterUs);
+  Serial.printf("   IRQ -> DOWN:  %u us avg, %u us max\n", avgIrq, s.irqToDownMaxUs);
+  Serial.printf("   -> handler:   %u us avg, %u us max (%u events)\n", avgLatency, h.maxLatencyUs, h.events);
+  Serial.printf("   Queue:        %u/%d used, %u dropped\n",
+                (unsigned)(TOUCH_QUEUE_SIZE - 1 - touchQueueFree()), TOUCH_QUEUE_SIZE - 1, s.overflows);
+  Serial.println("━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━\n");
+}
+
+#endif // TOUCH_INPUT_H
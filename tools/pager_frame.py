@@ -0,0 +1,280 @@
+#!/usr/bin/env python3
+"""
+BlackRoad pager frames - host side of src/pager_frame.h
+
+    0x00  COBS( type | seq | payload | crc16-ccitt-false LE )  0x00
+
+A Link keeps up to WINDOW requests in flight, matches the device's SACK
+frames to them by seq and resends any seq not acknowledged within
+RESEND_S. Text the firmware prints between frames is kept in Link.text,
+one line per entry.
+
+Usage:
+    tools/pager_frame.py /dev/ttyUSB0 alert LINEAR P1 "api-gateway 5xx above 2%"
+    tools/pager_frame.py /dev/ttyUSB0 status|ping|ack|standby
+
+Prints the result ("ok", "duplicate", ...) and exits 1 unless it is the
+expected one for the request.
+"""
+
+import os
+import select
+import sys
+import termios
+import threading
+import time
+import tty
+
+PF_PING, PF_STATUS, PF_ALERT, PF_ACK, PF_STANDBY, PF_HELLO = 1, 2, 3, 4, 5, 6
+PF_SACK = 0x80
+RESULTS = ("ok", "duplicate", "ready", "standby", "alert", "acked", "bad request")
+WINDOW = 8          # PAGER_WINDOW
+FRAME_MAX = 190     # PAGER_FRAME_MAX, decoded
+ENCODED_MAX = 192   # SERIAL_FRAME_MAX, on the wire without the 0x00s
+RESEND_S = 0.25
+
+
+# ─────────────────────────────────────────────────────────────────────
+# CRC + COBS
+# ─────────────────────────────────────────────────────────────────────
+
+def crc16(data):
+    crc = 0xFFFF
+    for b in data:
+        crc ^= b << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021 if crc & 0x8000 else crc << 1) & 0xFFFF
+    return crc
+
+
+def cobs_encode(data):
+    out = bytearray([0])
+    code_at, run = 0, 1
+    for b in data:
+        if b:
+            out.append(b)
+            run += 1
+        if not b or run == 0xFF:
+            out[code_at] = run
+            code_at = len(out)
+            out.append(0)
+            run = 1
+    out[code_at] = run
+    return bytes(out)
+
+
+def cobs_decode(data):
+    out = bytearray()
+    i = 0
+    while i < len(data):
+        code = data[i]
+        i += 1
+        if not code or i + code - 1 > len(data):
+            return None
+        out += data[i:i + code - 1]
+        i += code - 1
+        if code != 0xFF and i < len(data):
+            out.append(0)
+    return bytes(out)
+
+
+def frame(type_, seq, payload=b""):
+    body = bytes([type_, seq & 0xFF]) + payload
+    crc = crc16(body)
+    return b"\0" + cobs_encode(body + bytes([crc & 0xFF, crc >> 8])) + b"\0"
+
+
+def alert_payload(source, priority, message=""):
+    return source.encode() + b"\0" + priority.encode() + b"\0" + message.encode()
+
+
+# ─────────────────────────────────────────────────────────────────────
+# LINK
+# ─────────────────────────────────────────────────────────────────────
+
+class Deframer:
+    """Splits a byte stream as serialPoll() does: every 0x00 ends a frame
+    (the bytes since the last newline or 0x00), and a 0x00 with nothing
+    before it opens one, inside which newline is data. Nothing counts
+    delimiters, so a lost one costs a frame or two, not the session"""
+
+    def __init__(self):
+        self.buf = b""
+        self.opened = False
+
+    def feed(self, data):
+        """[(is_frame, bytes)] for every frame and text line data completes"""
+        out = []
+        buf = self.buf + data
+        i = 0
+        while True:
+            z = buf.find(b"\0", i)
+            end = z if z >= 0 else len(buf)
+            if self.opened and end - i > ENCODED_MAX:
+                self.opened = False     # not a frame - the next newline ends it too
+            n = -1 if self.opened else buf.find(b"\n", i, end)
+            if n >= 0:
+                out.append((False, buf[i:n]))
+                i = n + 1
+            elif z >= 0:
+                if z > i:
+                    out.append((True, buf[i:z]))
+                self.opened = z == i
+                i = z + 1
+            else:
+                break
+        self.buf = buf[i:]
+        return out
+
+
+class Link:
+    """Pipelined requests over one fd (tty or pty master)"""
+
+    def __init__(self, fd, window=WINDOW):
+        self.fd = fd
+        self.window = window
+        self.seq = 0
+        self.inflight = {}      # seq -> [frame bytes, last sent at, first sent at]
+        self.results = {}       # seq -> (result, monotonic time)
+        self.on_result = None   # called (seq, result, seconds since first send)
+        self.text = []
+        self.resends = 0
+        self.cond = threading.Condition()
+        self.closed = False
+        self.stopping = False
+        self.thread = threading.Thread(target=self._reader, daemon=True)
+        self.thread.start()
+
+    def _reader(self):
+        deframer = Deframer()
+        while not self.stopping:
+            if not select.select([self.fd], [], [], 0.1)[0]:
+                continue
+            try:
+                data = os.read(self.fd, 4096)
+            except OSError:
+                data = b""
+            if not data:
+                break
+            now = time.monotonic()
+            for is_frame, seg in deframer.feed(data):
+                if is_frame:
+                    self._sack(seg, now)
+                else:
+                    self.text.append(seg.decode(errors="replace").rstrip("\r"))
+        with self.cond:
+            self.closed = True
+            self.cond.notify_all()
+
+    def close(self):
+        """Stop the reader thread; the caller closes the fd"""
+        self.stopping = True
+        self.thread.join()
+
+    def _sack(self, seg, now):
+        raw = cobs_decode(seg)
+        if not raw or len(raw) < 4 or crc16(raw[:-2]) != raw[-2] | raw[-1] << 8 or raw[0] != PF_SACK:
+            return
+        pairs = raw[2:-2]
+        with self.cond:
+            for i in range(0, min(len(pairs), 2 * raw[1]), 2):
+                seq, res = pairs[i], pairs[i + 1]
+                if seq in self.inflight:
+                    name = RESULTS[res] if res < len(RESULTS) else str(res)
+                    sent = self.inflight.pop(seq)[2]
+                    self.results[seq] = (name, now)
+                    if self.on_result:
+                        self.on_result(seq, name, now - sent)
+            self.cond.notify_all()
+
+    def _write(self, data):
+        while data:
+            data = data[os.write(self.fd, data):]
+
+    def _resend_due(self):
+        now = time.monotonic()
+        for seq, entry in list(self.inflight.items()):
+            if now - entry[1] > RESEND_S:
+                entry[1] = now
+                self.resends += 1
+                self._write(entry[0])
+
+    def send(self, type_, payload=b""):
+        """Queue one request once the window has room; returns its seq"""
+        with self.cond:
+            while len(self.inflight) >= self.window and not self.closed:
+                self._resend_due()
+                self.cond.wait(RESEND_S / 2)
+            seq = self.seq
+            self.seq = (self.seq + 1) & 0xFF
+            data = frame(type_, seq, payload)
+            now = time.monotonic()
+            self.inflight[seq] = [data, now, now]
+            self.results.pop(seq, None)
+        self._write(data)
+        return seq
+
+    def wait(self, seq, timeout=5.0):
+        """(result, time) for seq; resends while waiting"""
+        deadline = time.monotonic() + timeout
+        with self.cond:
+            while seq not in self.results:
+                if self.closed or time.monotonic() > deadline:
+                    return None
+                self._resend_due()
+                self.cond.wait(RESEND_S / 2)
+            return self.results[seq]
+
+    def drain(self, timeout=10.0):
+        deadline = time.monotonic() + timeout
+        with self.cond:
+            while self.inflight and not self.closed and time.monotonic() < deadline:
+                self._resend_due()
+                self.cond.wait(RESEND_S / 2)
+            return not self.inflight
+
+    def hello(self):
+        """New session: the device forgets seqs from an earlier one"""
+        res = self.wait(self.send(PF_HELLO))
+        return res is not None and res[0] == "ready"
+
+
+# ─────────────────────────────────────────────────────────────────────
+# CLI
+# ─────────────────────────────────────────────────────────────────────
+
+REQUESTS = {
+    "ping": (PF_PING, "ready"),
+    "status": (PF_STATUS, None),
+    "ack": (PF_ACK, "acked"),
+    "standby": (PF_STANDBY, "ok"),
+    "alert": (PF_ALERT, "ok"),
+}
+
+
+def main():
+    if len(sys.argv) < 3 or sys.argv[2] not in REQUESTS or (sys.argv[2] == "alert" and len(sys.argv) < 5):
+        print(__doc__.strip().split("\n\n")[3], file=sys.stderr)
+        return 2
+    fd = os.open(sys.argv[1], os.O_RDWR | os.O_NOCTTY)
+    tty.setraw(fd)
+    attrs = termios.tcgetattr(fd)
+    attrs[4] = attrs[5] = termios.B115200
+    termios.tcsetattr(fd, termios.TCSANOW, attrs)
+
+    link = Link(fd)
+    if not link.hello():
+        print("no reply from %s" % sys.argv[1], file=sys.stderr)
+        return 1
+    type_, expect = REQUESTS[sys.argv[2]]
+    payload = alert_payload(*sys.argv[3:6]) if type_ == PF_ALERT else b""
+    if len(payload) + 4 > FRAME_MAX:
+        print("alert too long: %d B, max %d" % (len(payload) + 4, FRAME_MAX), file=sys.stderr)
+        return 2
+    res = link.wait(link.send(type_, payload))
+    print(res[0] if res else "timeout")
+    return 0 if res and (expect is None or res[0] == expect) else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,506 @@
+#!/usr/bin/env python3
+"""
+BlackRoad serial command bench
+
+Runs the native host build with UART0 on a pty (--serial-port) and
+drives it the way the pager bridge does:
+
+    round trip   PING one at a time, time to READY (p50 / p99 / max)
+    throughput   N mixed ALERT / PING / STATUS lines written as fast as
+                 the pty takes them; every line gets exactly one reply
+                 (OK | DUPLICATE | READY | STATE ...)
+    report       the firmware's SERIAL report, then the runner's worst
+                 loop() pass in wall-clock time
+
+The host clock follows the wall clock, so loop() runs at its device rate
+(delay(10) per pass) and throughput is bounded by SERIAL_LINES_PER_PASS
+per pass, as on the board. Cycle and microsecond columns of the SERIAL
+report are only meaningful on the board - the host clock does not move
+while a handler runs.
+
+Usage:
+    pio run -e native
+    tools/serial_bench.py [--program .pio/build/native/program] [--lines 5000]
+                          [--pings 200] [--max-stall-ms MS]
+    tools/serial_bench.py --alerts 1000   # text protocol vs pager frames
+    tools/serial_bench.py --resync        # one 0x00 delimiter lost
+    tools/serial_bench.py --find-seed     # after adding a command
+
+--alerts N raises N distinct alerts three ways, each on a fresh runner:
+text ALERT lines one at a time (the bridge cannot match an OK to its
+line otherwise), pager frames one at a time, and pager frames with a
+window of 8 in flight (tools/pager_frame.py). Frames carry a ~70 B
+message body the text protocol has no room for.
+
+--resync drops single 0x00 delimiters. The host-side Deframer gets a
+stream of text lines and frames with each delimiter removed in turn;
+only the frame that lost it, the one after and the text between may go
+missing. The runner gets a framed PING without its opening 0x00, then
+one without its closing 0x00, each followed by 7 more frames (one
+window) and a text PING; every frame must be answered and the PING must
+get its READY.
+
+--find-seed searches for a SERIAL_CMD_SEED that maps every name in
+SERIAL_COMMANDS (src/main.cpp) to its own slot, same hash as
+src/serial_cmd.h.
+
+Exit status 1 when a reply is missing or the worst pass exceeds
+--max-stall-ms, 2 when the program cannot be started.
+"""
+
+import argparse
+import os
+import random
+import re
+import select
+import subprocess
+import sys
+import threading
+import time
+import tty
+
+import pager_frame
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+REPLY = re.compile(r"^(OK|DUPLICATE|READY|STATE \w+)$")
+SOURCES = ("LINEAR", "SLACK", "GITHUB", "RAILWAY", "CLOUDFLARE", "STRIPE")
+PRIORITIES = ("P1", "P2", "P3", "CRITICAL", "URGENT", "SOS")
+
+
+# ─────────────────────────────────────────────────────────────────────
+# PERFECT HASH SEED (mirror of serialCmdHash / serialCmdSlot)
+# ─────────────────────────────────────────────────────────────────────
+
+def header_define(name):
+    text = open(os.path.join(ROOT, "src", "serial_cmd.h")).read()
+    return int(re.search(r"#define %s\s+(\w+)" % name, text).group(1).rstrip("u"), 0)
+
+
+def command_names():
+    text = open(os.path.join(ROOT, "src", "main.cpp")).read()
+    table = text[text.index("SERIAL_COMMANDS[] = {"):]
+    table = table[:table.index("};")]
+    return re.findall(r'\{\s*"([^"]+)"', table)
+
+
+def slot(name, seed, slots):
+    h = (2166136261 ^ seed) & 0xFFFFFFFF
+    for c in name.encode():
+        h = ((h ^ c) * 16777619) & 0xFFFFFFFF
+    return (h ^ (h >> 16)) & (slots - 1)
+
+
+def find_seed():
+    names = command_names()
+    slots = header_define("SERIAL_CMD_SLOTS")
+    current = header_define("SERIAL_CMD_SEED")
+    for seed in [current] + list(range(1 << 20)):
+        if len({slot(n, seed, slots) for n in names}) == len(names):
+            state = "current seed still works" if seed == current else "new seed"
+            print("%d commands, %d slots: %s" % (len(names), slots, state))
+            print("#define SERIAL_CMD_SEED          0x%08Xu" % seed)
+            return 0
+    print("no seed below 2^20 - raise SERIAL_CMD_SLOTS", file=sys.stderr)
+    return 1
+
+
+# ─────────────────────────────────────────────────────────────────────
+# PTY SESSION
+# ─────────────────────────────────────────────────────────────────────
+
+class Port:
+    """Master side of the pty; a thread splits the firmware output into lines"""
+
+    def __init__(self, fd):
+        self.fd = fd
+        self.lines = []
+        self.cond = threading.Condition()
+        self.closed = False
+        self.stopping = False
+        self.thread = threading.Thread(target=self._reader, daemon=True)
+        self.thread.start()
+
+    def _reader(self):
+        buf = b""
+        while not self.stopping:
+            if not select.select([self.fd], [], [], 0.1)[0]:
+                continue
+            try:
+                data = os.read(self.fd, 4096)
+            except OSError:
+                data = b""
+            if not data:
+                break
+            buf += data
+            *done, buf = buf.split(b"\n")
+            with self.cond:
+                now = time.monotonic()
+                self.lines += [(now, l.decode(errors="replace").rstrip("\r")) for l in done]
+                self.cond.notify_all()
+        with self.cond:
+            self.closed = True
+            self.cond.notify_all()
+
+    def close(self):
+        """Stop reading - a read() still blocked would keep the pty open"""
+        self.stopping = True
+        self.thread.join()
+
+    def send(self, text):
+        data = text.encode()
+        while data:
+            data = data[os.write(self.fd, data):]
+
+    def wait(self, start, match, timeout=10.0):
+        """Index of the first line at or after `start` for which match() holds"""
+        deadline = time.monotonic() + timeout
+        i = start
+        with self.cond:
+            while True:
+                while i < len(self.lines):
+                    if match(self.lines[i][1]):
+                        return i
+                    i += 1
+                left = deadline - time.monotonic()
+                if left <= 0 or self.closed:
+                    return None
+                self.cond.wait(left)
+
+
+def percentile(values, p):
+    values = sorted(values)
+    return values[min(len(values) - 1, int(len(values) * p / 100))]
+
+
+def traffic(count, rng):
+    lines = []
+    for _ in range(count):
+        r = rng.random()
+        if r < 0.4:
+            lines.append("ALERT %s %s" % (rng.choice(SOURCES), rng.choice(PRIORITIES)))
+        elif r < 0.7:
+            lines.append("PING")
+        else:
+            lines.append("STATUS")
+    return lines
+
+
+def launch(args):
+    """(process, master fd, slave fd) with the program on the pty's slave side"""
+    master, slave = os.openpty()
+    tty.setraw(master)
+    try:
+        proc = subprocess.Popen([args.program, "--serial-port", os.ttyname(slave)],
+                                stdout=subprocess.DEVNULL, stderr=subprocess.PIPE, cwd=args.cwd)
+    except OSError as e:
+        print("serial_bench: %s: %s" % (args.program, e), file=sys.stderr)
+        os.close(master)
+        os.close(slave)
+        return None
+    return proc, master, slave
+
+
+def finish(proc, master, slave, reader):
+    """Close the pty so the runner exits; its "Serial port:" summary lines"""
+    reader.close()
+    os.close(master)
+    os.close(slave)
+    try:
+        _, err = proc.communicate(timeout=10)
+    except subprocess.TimeoutExpired:
+        proc.kill()
+        _, err = proc.communicate()
+    return [l for l in err.decode(errors="replace").splitlines() if l.startswith("Serial port:")]
+
+
+def bench(args):
+    started = launch(args)
+    if not started:
+        return 2
+    proc, master, slave = started
+    port = Port(master)
+    ok = True
+
+    # Boot: setup() runs before the port opens, so wait for the first READY
+    start = len(port.lines)
+    for _ in range(50):
+        port.send("PING\n")
+        if port.wait(start, lambda l: l == "READY", 0.2) is not None:
+            break
+    else:
+        print("serial_bench: no READY from %s" % args.program, file=sys.stderr)
+        proc.kill()
+        return 2
+    time.sleep(0.2)
+    start = len(port.lines)
+    port.send("STANDBY\nSERIAL RESET\n")
+    port.wait(start, lambda l: l == "OK")
+    port.wait(start + 1, lambda l: l == "OK")
+
+    # Round trip
+    rtt = []
+    for _ in range(args.pings):
+        start = len(port.lines)
+        t0 = time.monotonic()
+        port.send("PING\n")
+        i = port.wait(start, lambda l: l == "READY")
+        if i is None:
+            ok = False
+            break
+        rtt.append((port.lines[i][0] - t0) * 1000)
+
+    # Throughput
+    lines = traffic(args.lines, random.Random(1))
+    payload = "".join(l + "\n" for l in lines)
+    start = len(port.lines)
+    t0 = time.monotonic()
+    writer = threading.Thread(target=port.send, args=(payload,))
+    writer.start()
+    got = 0
+    i = start
+    while got < len(lines):
+        i = port.wait(i, lambda l: REPLY.match(l) is not None)
+        if i is None:
+            ok = False
+            break
+        got += 1
+        i += 1
+    elapsed = time.monotonic() - t0
+    writer.join()
+
+    # Firmware's own view, then close the port so the runner exits
+    start = len(port.lines)
+    port.send("SERIAL\n")
+    first = port.wait(start, lambda l: "SERIAL COMMANDS" in l)
+    last = port.wait(first + 2, lambda l: l.startswith("━")) if first is not None else None
+    report = [l for _, l in port.lines[first - 1:last + 1]] if last is not None else []
+    summary = finish(proc, master, slave, port)
+    worst = re.search(r"worst pass (\d+) us", summary[-1]) if summary else None
+
+    print("━" * 69)
+    print("   SERIAL BENCH  %s" % os.path.basename(args.program))
+    print("━" * 69)
+    if rtt:
+        print("   %-14sp50 %.2f ms  p99 %.2f ms  max %.2f ms  (%d PINGs)" %
+              ("Round trip:", percentile(rtt, 50), percentile(rtt, 99), max(rtt), len(rtt)))
+    rate = got / elapsed if elapsed else 0
+    bytes_per_s = len(payload) * got / len(lines) / elapsed if elapsed else 0
+    print("   %-14s%d / %d replies in %.2f s: %.0f lines/s, %.0f B/s (115200 baud: 11520 B/s)" %
+          ("Throughput:", got, len(lines), elapsed, rate, bytes_per_s))
+    if worst:
+        print("   %-14s%.2f ms worst loop() pass (wall clock)" % ("Stall:", int(worst.group(1)) / 1000))
+    for l in summary:
+        print("   " + l)
+    for l in report:
+        print(l)
+
+    if got < len(lines):
+        print("✗ %d replies missing" % (len(lines) - got))
+        ok = False
+    if args.max_stall_ms is not None and worst and int(worst.group(1)) > args.max_stall_ms * 1000:
+        print("✗ worst pass over %.1f ms" % args.max_stall_ms)
+        ok = False
+    return 0 if ok else 1
+
+
+# ─────────────────────────────────────────────────────────────────────
+# ALERTS: TEXT vs FRAMES
+# ─────────────────────────────────────────────────────────────────────
+
+def alert_message(i):
+    return "api-gateway 5xx at %d.%d%% on octavia for 5 min (alert %d), runbook ops/5xx" % (2 + i % 7, i % 10, i)
+
+
+def boot_text(port):
+    start = len(port.lines)
+    for _ in range(50):
+        port.send("PING\n")
+        if port.wait(start, lambda l: l == "READY", 0.2) is not None:
+            return True
+    return False
+
+
+def text_alerts(args):
+    """ALERT, wait for OK/DUPLICATE, next. (rtts in s, elapsed, resends, summary)"""
+    started = launch(args)
+    if not started:
+        return None
+    proc, master, slave = started
+    port = Port(master)
+    rtt = []
+    t0 = time.monotonic()
+    if boot_text(port):
+        time.sleep(0.2)
+        t0 = time.monotonic()
+        for i in range(args.alerts):
+            start = len(port.lines)
+            sent = time.monotonic()
+            port.send("ALERT S%05d P1\n" % i)
+            j = port.wait(start, lambda l: l in ("OK", "DUPLICATE"))
+            if j is None:
+                break
+            rtt.append(port.lines[j][0] - sent)
+    elapsed = time.monotonic() - t0
+    return rtt, elapsed, 0, finish(proc, master, slave, port)
+
+
+def frame_alerts(args, window):
+    """PF_ALERT with a message body, `window` in flight"""
+    started = launch(args)
+    if not started:
+        return None
+    proc, master, slave = started
+    link = pager_frame.Link(master, window)
+    rtt = []
+    link.on_result = lambda seq, result, secs: rtt.append(secs)
+    t0 = time.monotonic()
+    if any(link.hello() for _ in range(3)):
+        time.sleep(0.2)
+        del rtt[:]
+        t0 = time.monotonic()
+        for i in range(args.alerts):
+            link.send(pager_frame.PF_ALERT,
+                      pager_frame.alert_payload("S%05d" % i, "P1", alert_message(i)))
+        link.drain()
+    elapsed = time.monotonic() - t0
+    return rtt, elapsed, link.resends, finish(proc, master, slave, link)
+
+
+def bench_alerts(args):
+    runs = (("text, 1 in flight", lambda: text_alerts(args), "-"),
+            ("frames, window 1", lambda: frame_alerts(args, 1), "%d B" % len(alert_message(0))),
+            ("frames, window %d" % pager_frame.WINDOW, lambda: frame_alerts(args, pager_frame.WINDOW),
+             "%d B" % len(alert_message(0))))
+    print("━" * 69)
+    print("   PAGER ALERTS  %d per protocol, %s" % (args.alerts, os.path.basename(args.program)))
+    print("━" * 69)
+    print("   %-19s %8s %8s %8s %8s %7s %6s" % ("Protocol", "alerts/s", "p50 ms", "p99 ms", "max ms", "resent", "body"))
+    ok = True
+    for name, run, body in runs:
+        r = run()
+        if r is None:
+            return 2
+        rtt, elapsed, resends, summary = r
+        ms = [x * 1000 for x in rtt] or [0]
+        print("   %-19s %8.0f %8.2f %8.2f %8.2f %7d %6s" % (name, len(rtt) / elapsed if elapsed else 0,
+              percentile(ms, 50), percentile(ms, 99), max(ms), resends, body))
+        for l in summary:
+            print("      " + l)
+        if len(rtt) < args.alerts:
+            print("✗ %s: %d of %d alerts answered" % (name, len(rtt), args.alerts))
+            ok = False
+    return 0 if ok else 1
+
+
+# ─────────────────────────────────────────────────────────────────────
+# RESYNC: ONE 0x00 LOST
+# ─────────────────────────────────────────────────────────────────────
+
+def frame_seq(seg):
+    """seq of an intact frame, None for anything its CRC rejects"""
+    raw = pager_frame.cobs_decode(seg)
+    if not raw or len(raw) < 4 or pager_frame.crc16(raw[:-2]) != raw[-2] | raw[-1] << 8:
+        return None
+    return raw[1]
+
+
+def deframer_resync(count=8):
+    """(recovered, cases): each delimiter of a text + frame stream dropped once"""
+    # a '\n' in every payload - it is data inside a frame
+    stream = b"".join(b"LINE %d\r\n" % i + pager_frame.frame(pager_frame.PF_ALERT, i, b"S\0P1\0x\ny%d" % i)
+                      for i in range(count))
+    zeros = [i for i, b in enumerate(stream) if b == 0]
+    recovered = 0
+    for case, z in enumerate([None] + zeros):
+        data = stream if z is None else stream[:z] + stream[z + 1:]
+        lost = set() if z is None else {stream.count(b"\0", 0, z) // 2, stream.count(b"\0", 0, z) // 2 + 1}
+        deframer = pager_frame.Deframer()
+        seqs, text = set(), set()
+        for at in range(0, len(data), 7):       # arrives in pieces, as from a tty
+            for is_frame, seg in deframer.feed(data[at:at + 7]):
+                if is_frame:
+                    seqs.add(frame_seq(seg))
+                else:
+                    text.add(seg.rstrip(b"\r"))
+        want = set(range(count)) - lost
+        if want <= seqs and {b"LINE %d" % i for i in want - {min(lost or {0}) + 1}} <= text:
+            recovered += 1
+    return recovered, len(zeros) + 1
+
+
+def send_cut(link, cut):
+    """link.send(PF_PING) with cut() applied to the bytes on the wire"""
+    write = link._write
+    link._write = lambda data: write(cut(data))
+    try:
+        return link.send(pager_frame.PF_PING)
+    finally:
+        link._write = write
+
+
+def device_resync(args):
+    """[(case, answered, sent, resent, READY seen)] from one runner"""
+    started = launch(args)
+    if not started:
+        return None
+    proc, master, slave = started
+    link = pager_frame.Link(master)
+    results = []
+    if any(link.hello() for _ in range(3)):
+        time.sleep(0.2)
+        for case, cut in (("opening lost", lambda d: d[1:]), ("closing lost", lambda d: d[:-1])):
+            resends = link.resends
+            seqs = [send_cut(link, cut)] + [link.send(pager_frame.PF_PING) for _ in range(pager_frame.WINDOW - 1)]
+            link.drain()
+            answered = sum(1 for q in seqs if link.results.get(q, ("",))[0] == "ready")
+            start = len(link.text)
+            link._write(b"PING\n")
+            deadline = time.monotonic() + 2.0
+            while "READY" not in link.text[start:] and time.monotonic() < deadline:
+                time.sleep(0.02)
+            results.append((case, answered, len(seqs), link.resends - resends, "READY" in link.text[start:]))
+    finish(proc, master, slave, link)
+    return results
+
+
+def bench_resync(args):
+    recovered, cases = deframer_resync()
+    results = device_resync(args)
+    if results is None:
+        return 2
+    print("━" * 69)
+    print("   RESYNC  one 0x00 lost, %s" % os.path.basename(args.program))
+    print("━" * 69)
+    print("   %-14s%d / %d streams recovered (pager_frame.Deframer)" % ("Host reader:", recovered, cases))
+    ok = recovered == cases and len(results) == 2
+    for case, answered, sent, resent, ready in results:
+        print("   %-14s%d / %d frames answered, %d resent, text PING %s" %
+              (case + ":", answered, sent, resent, "READY" if ready else "no reply"))
+        ok = ok and answered == sent and ready
+    if not results:
+        print("✗ no reply to PF_HELLO")
+    return 0 if ok else 1
+
+
+def main():
+    ap = argparse.ArgumentParser(description="Serial command throughput and loop stall over a pty")
+    ap.add_argument("--program", default=os.path.join(ROOT, ".pio", "build", "native", "program"))
+    ap.add_argument("--cwd", default=None, help="runner working directory (frames land in out/)")
+    ap.add_argument("--lines", type=int, default=5000)
+    ap.add_argument("--pings", type=int, default=200)
+    ap.add_argument("--max-stall-ms", type=float, default=None)
+    ap.add_argument("--alerts", type=int, default=0, help="compare text and framed alerts instead")
+    ap.add_argument("--resync", action="store_true", help="drop single 0x00 delimiters instead")
+    ap.add_argument("--find-seed", action="store_true")
+    args = ap.parse_args()
+    if args.find_seed:
+        return find_seed()
+    if args.alerts:
+        return bench_alerts(args)
+    if args.resync:
+        return bench_resync(args)
+    return bench(args)
+
+
+if __name__ == "__main__":
+    sys.exit(main())
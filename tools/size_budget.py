@@ -0,0 +1,170 @@
+#!/usr/bin/env python3
+"""
+BlackRoad static size budget
+
+Charges every symbol in the firmware ELF to the source module that
+defines it and fails when a module's static RAM or flash goes over its
+budget in BUDGETS below.
+
+The modules are header-only and all land in main.cpp.o, so the linker
+map only knows one object file. The attribution comes from the ELF's
+DWARF line info instead (nm -l: symbol -> file:line), which the
+PlatformIO builds carry by default.
+
+    ram    anything linked into internal DRAM or IRAM
+    flash  code and rodata, plus the initializers of .data and IRAM
+
+ESP32 ELFs are classified by address; other ELFs (the native host
+build) by nm symbol type: b/B ram, d/D both, everything else flash.
+
+Usage:
+    pio run -e esp32dev -t size_budget          (tools/size_budget_pio.py)
+    tools/size_budget.py firmware.elf [--nm xtensa-esp32-elf-nm] [--top N]
+
+Exit status 1 when any budget is exceeded, 2 when nm fails or the ELF
+has no line info.
+"""
+
+import argparse
+import os
+import re
+import subprocess
+import sys
+from collections import defaultdict
+
+# Bytes per module: (static RAM, flash), seeded from the native build
+# (64-bit pointers, x86 code) with ~25% RAM and 2x flash headroom - the
+# device numbers come in under them. Modules not listed only appear in
+# the report. Raise a budget in the same change that needs it.
+#
+# heap_trace.h is left out: its table scales with HEAP_TRACE_SLOTS and is
+# bounded by a static_assert in the header instead.
+BUDGETS = {
+    "main.cpp":            (6912,  208896),
+    "home_cache.h":        (9984,  8192),
+    "app_tasks.h":         (6912,  8192),
+    "render_profiler.h":   (4864,  11264),
+    "dynamic_nav.h":       (3328,  14336),
+    "screen_layouts.h":    (2304,  8192),
+    "hit_test.h":          (2048,  7168),
+    "input_latency.h":     (2048,  4096),
+    "event_bus.h":         (1792,  5120),
+    "timer_wheel.h":       (1792,  5120),
+    "stall_detector.h":    (1280,  4096),
+    "touch_input.h":       (768,   5120),
+    "sovereign_stack.h":   (768,   4096),
+    "json_arena.h":        (768,   4096),
+    "serial_cmd.h":        (1088,  5120),
+    "feedback.h":          (768,   5120),
+    "gestures.h":          (768,   5120),
+    "animation.h":         (768,   5120),
+    "power_idle.h":        (256,   5120),
+    "pager_frame.h":       (256,   4096),
+    "alert_dedupe.h":      (256,   4096),
+    "mem_placement.h":     (256,   4096),
+    "status_model.h":      (256,   4096),
+    "performance.h":       (256,   5120),
+    "layout.h":            (256,   4096),
+    "alerts.h":            (256,   5120),
+    "premium_ui.h":        (256,   11264),
+}
+
+DRAM = (0x3FFAE000, 0x40000000)
+IRAM = (0x40080000, 0x400A0000)
+FLASH = ((0x3F400000, 0x3F800000), (0x400C2000, 0x40C00000))
+LINE = re.compile(r"^([0-9a-fA-F]+)\s+([0-9a-fA-F]+)\s+(\w)\s+(.+?)(?:\t(.+):\d+)?$")
+
+
+def module_of(path):
+    """src/ and host/ files by name, everything else (toolchain, libs) pooled"""
+    if not path:
+        return "(no line info)"
+    norm = path.replace("\\", "/")
+    for root in ("/src/", "/host/"):
+        if root in norm:
+            rel = norm.split(root, 1)[1]
+            return rel if root == "/src/" else "host/" + rel
+    return "(libraries)"
+
+
+def within(addr, span):
+    return span[0] <= addr < span[1]
+
+
+def placement(addr, kind, esp):
+    """(counts toward RAM, counts toward flash)"""
+    if esp:
+        if within(addr, DRAM):
+            return True, kind in "dD"
+        if within(addr, IRAM):
+            return True, True
+        return False, any(within(addr, f) for f in FLASH)
+    return kind in "bBdD", kind not in "bB"
+
+
+def read_symbols(nm, elf):
+    try:
+        out = subprocess.run([nm, "-S", "-l", "-C", "--defined-only", elf],
+                             check=True, capture_output=True, text=True).stdout
+    except (OSError, subprocess.CalledProcessError) as e:
+        print("size_budget: %s failed: %s" % (nm, e), file=sys.stderr)
+        sys.exit(2)
+    for line in out.splitlines():
+        m = LINE.match(line)
+        if not m:
+            continue   # no size: labels, section markers
+        addr, size, kind, name, path = m.groups()
+        yield int(addr, 16), int(size, 16), kind, name, module_of(path)
+
+
+def main():
+    ap = argparse.ArgumentParser(description="Per-module static RAM/flash budget")
+    ap.add_argument("elf")
+    ap.add_argument("--nm", default="xtensa-esp32-elf-nm")
+    ap.add_argument("--top", type=int, default=0, help="largest N symbols per over-budget module")
+    args = ap.parse_args()
+
+    symbols = list(read_symbols(args.nm, args.elf))
+    if not any(s[4] in BUDGETS for s in symbols):
+        print("size_budget: no symbols from src/ in %s - built without -g?" % args.elf, file=sys.stderr)
+        return 2
+    esp = any(within(s[0], DRAM) or within(s[0], FLASH[0]) for s in symbols)
+    ram = defaultdict(int)
+    flash = defaultdict(int)
+    syms = defaultdict(list)
+    for addr, size, kind, name, mod in symbols:
+        in_ram, in_flash = placement(addr, kind, esp)
+        ram[mod] += size if in_ram else 0
+        flash[mod] += size if in_flash else 0
+        syms[mod].append((size, kind, name))
+
+    mods = sorted(set(ram) | set(flash), key=lambda m: (-ram[m], m))
+    over = []
+    print("━" * 69)
+    print("   STATIC SIZE BUDGET  %s" % os.path.basename(args.elf))
+    print("━" * 69)
+    print("   %-22s %9s %9s %9s %9s" % ("Module", "RAM", "budget", "Flash", "budget"))
+    for m in mods:
+        rb, fb = BUDGETS.get(m, (None, None))
+        flag = ""
+        if rb is not None and (ram[m] > rb or flash[m] > fb):
+            flag = "  OVER"
+            over.append(m)
+        print("   %-22s %9d %9s %9d %9s%s" % (m, ram[m], rb if rb is not None else "-",
+                                            flash[m], fb if fb is not None else "-", flag))
+    print("   %-22s %9d %9s %9d" % ("Total", sum(ram.values()), "", sum(flash.values())))
+    print("━" * 69)
+
+    for m in over:
+        rb, fb = BUDGETS[m]
+        print("✗ %s: RAM %d / %d B, flash %d / %d B" % (m, ram[m], rb, flash[m], fb))
+        for size, kind, name in sorted(syms[m], reverse=True)[:args.top]:
+            print("     %7d %s %s" % (size, kind, name))
+    if over:
+        return 1
+    print("✓ all %d budgeted modules within budget" % sum(1 for m in mods if m in BUDGETS))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,18 @@
+# PlatformIO hook for tools/size_budget.py (extra_scripts in platformio.ini):
+#
+#   pio run -e esp32dev -t size_budget
+#
+# builds the firmware, then fails the target if any module is over its
+# static RAM/flash budget.
+
+Import("env")
+
+nm = env.subst("$CC").replace("gcc", "nm")
+
+env.AddCustomTarget(
+    name="size_budget",
+    dependencies="$BUILD_DIR/${PROGNAME}.elf",
+    actions='"$PYTHONEXE" "$PROJECT_DIR/tools/size_budget.py" "$BUILD_DIR/${PROGNAME}.elf" --nm "%s" --top 8' % nm,
+    title="Size budget",
+    description="Per-module static RAM/flash against tools/size_budget.py",
+)